@@ -222,6 +222,13 @@ void BufferWriter::AppendVertexPCU(Vertex_PCU const& vert)
     AppendVec2(vert.m_uvTexCoords);
 }
 
+//----------------------------------------------------------------------------------------------------
+void BufferWriter::AppendBytes(void const* data, size_t const size)
+{
+    uint8_t const* bytes = static_cast<uint8_t const*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+}
+
 //----------------------------------------------------------------------------------------------------
 void BufferWriter::OverwriteUint32(size_t position, unsigned int value)
 {
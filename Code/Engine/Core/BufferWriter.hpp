@@ -50,6 +50,9 @@ public:
     void AppendPlane2(Plane2 const& plane);
     void AppendVertexPCU(Vertex_PCU const& vert);
 
+    // Raw bytes, copied as-is (no endian swap). For POD arrays read back in place.
+    void AppendBytes(void const* data, size_t size);
+
     // Random-access overwrite
     void OverwriteUint32(size_t position, unsigned int value);
 
@@ -9,7 +9,8 @@
 //
 // Design Rationale:
 //   - Header-only template: Zero runtime overhead, full compiler optimization
-//   - SPSC over MPMC: Simpler, faster (single writer thread)
+//   - SPSC over MPMC: Simpler, faster (single writer thread); see MPMCCommandQueueBase for
+//     queues with several producers
 //   - Ring buffer over linked list: Cache-friendly, bounded memory
 //   - Lock-free over mutex: Predictable latency, no priority inversion
 //   - Bounded capacity: Backpressure prevents memory runaway
@@ -306,8 +307,8 @@ bool CommandQueueBase<CommandType>::Submit(CommandType const& command)
 //      b. Read command from buffer
 //      c. Invoke processor callback
 //      d. Advance head index
-//      e. Increment consumption counter
 //   4. Update head position with release semantics
+//   5. Add the number processed to the consumption counter (one atomic op per drain)
 //
 // Memory Ordering:
 //   - m_tail.load (acquire): Ensures commands written by producer are visible to consumer
@@ -326,6 +327,8 @@ void CommandQueueBase<CommandType>::ConsumeAll(ProcessorFunc&& processor)
 	// Load current producer position (acquire ordering to synchronize with producer's release)
 	size_t currentTail = m_tail.load(std::memory_order_acquire);
 
+	uint64_t consumedCount = 0;
+
 	// Process all commands from head to tail
 	while (currentHead != currentTail)
 	{
@@ -340,13 +343,17 @@ void CommandQueueBase<CommandType>::ConsumeAll(ProcessorFunc&& processor)
 
 		// Advance head index
 		currentHead = NextIndex(currentHead);
-
-		// Increment consumption counter
-		m_totalConsumed.fetch_add(1, std::memory_order_relaxed);
+		++consumedCount;
 	}
 
 	// Update consumer head position (release ordering to synchronize with producer's acquire)
 	m_head.store(currentHead, std::memory_order_release);
+
+	// Increment consumption counter once per drain (statistics only)
+	if (consumedCount > 0)
+	{
+		m_totalConsumed.fetch_add(consumedCount, std::memory_order_relaxed);
+	}
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------
+// CpuFeatures.cpp
+// Engine Core Module - Runtime SIMD Detection
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/CpuFeatures.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <immintrin.h>
+#include <intrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    eSimdLevel DetectSimdLevel()
+    {
+        int cpuInfo[4] = {};
+        __cpuid(cpuInfo, 0);
+        int const highestLeaf = cpuInfo[0];
+
+        __cpuid(cpuInfo, 1);
+        bool const hasOsXSave = (cpuInfo[2] & (1 << 27)) != 0;
+        bool const hasAvx     = (cpuInfo[2] & (1 << 28)) != 0;
+
+        // XCR0 bits 1 and 2: the OS saves XMM and YMM registers on context switch
+        if (!hasOsXSave || !hasAvx || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return eSimdLevel::SSE2;
+        }
+
+        if (highestLeaf < 7)
+        {
+            return eSimdLevel::AVX;
+        }
+
+        __cpuidex(cpuInfo, 7, 0);
+        bool const hasAvx2 = (cpuInfo[1] & (1 << 5)) != 0;
+        return hasAvx2 ? eSimdLevel::AVX2 : eSimdLevel::AVX;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+eSimdLevel GetSimdLevel()
+{
+    static eSimdLevel const s_simdLevel = DetectSimdLevel();
+    return s_simdLevel;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetSimdLevelName(eSimdLevel const level)
+{
+    switch (level)
+    {
+    case eSimdLevel::SCALAR: return "Scalar";
+    case eSimdLevel::SSE2:   return "SSE2";
+    case eSimdLevel::AVX:    return "AVX";
+    case eSimdLevel::AVX2:   return "AVX2";
+    }
+    return "Unknown";
+}
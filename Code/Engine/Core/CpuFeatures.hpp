@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------------------------------
+// CpuFeatures.hpp
+// Engine Core Module - Runtime SIMD Detection
+//
+// Purpose:
+//   Report the widest SIMD instruction set the CPU and OS support, so kernels built with SSE2 as
+//   the baseline can switch to AVX / AVX2 paths at runtime.
+//
+// Design Rationale:
+//   - CPUID bits alone are not enough for AVX: the OS must also save YMM state (OSXSAVE + XGETBV)
+//   - Detected once (function-local static); later queries are a load
+//   - eSimdLevel is ordered, so kernels cap it with (std::min)(GetSimdLevel(), requestedMaximum)
+//     for benchmarks and A/B checks
+//
+// Thread Safety:
+//   - Safe from any thread
+//
+// Author: Runtime SIMD Dispatch
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+enum class eSimdLevel : uint8_t
+{
+    SCALAR,
+    SSE2,       // x64 baseline
+    AVX,        // 8-wide float
+    AVX2        // 8-wide integer
+};
+
+//----------------------------------------------------------------------------------------------------
+eSimdLevel  GetSimdLevel();
+char const* GetSimdLevelName(eSimdLevel level);
@@ -156,20 +156,8 @@ void DevConsole::Execute(String const& consoleCommandText,
     {
         AddLine(INFO_MAJOR, g_devConsole->m_inputText);
 
-        StringList registeredEventNames = g_eventSystem->GetAllRegisteredEventNames();
-
-        // Case-insensitive command validation (matches FireEvent's HCIS-based lookup)
-        bool isCommandValid = false;
-        for (String const& name : registeredEventNames)
-        {
-            if (_stricmp(name.c_str(), command.c_str()) == 0)
-            {
-                isCommandValid = true;
-                break;
-            }
-        }
-
-        if (!isCommandValid)
+        // Case-insensitive command validation (same lookup FireEvent uses)
+        if (!g_eventSystem->HasSubscribers(command))
         {
             AddLine(ERROR, "Your command: '" + command + "' is not valid!");
         }
@@ -206,6 +206,22 @@ void GEngine::Construct()
         sJobSubsystemConfig sJobSubsystemConfig;
         sJobSubsystemConfig.m_genericThreadNum = numGenericThreads;
         sJobSubsystemConfig.m_ioThreadNum      = numIOThreads;
+
+        // Optional scheduler selection: "core": { "jobSystem": { "schedulerMode": "WorkStealing" } }
+        if (bHasEngineSubsystemConfig &&
+            subsystemConfig.contains("core") &&
+            subsystemConfig["core"].contains("jobSystem"))
+        {
+            auto const& jobSystemConfig = subsystemConfig["core"]["jobSystem"];
+
+            if (jobSystemConfig.value("schedulerMode", "SharedQueue") == "WorkStealing")
+            {
+                sJobSubsystemConfig.m_schedulerMode = eJobSchedulerMode::WORK_STEALING;
+            }
+
+            sJobSubsystemConfig.m_workerDequeCapacity = jobSystemConfig.value("workerDequeCapacity", sJobSubsystemConfig.m_workerDequeCapacity);
+        }
+
         JobSystem* jobSystem                   = new JobSystem(sJobSubsystemConfig);
         g_jobSystem                            = jobSystem;
         DebuggerPrintf("(GEngine::Construct)JobSystem: ENABLED\n");
@@ -11,6 +11,141 @@
 //----------------------------------------------------------------------------------------------------
 EventSystem* g_eventSystem = nullptr;
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t constexpr MIN_SLOT_COUNT        = 32;
+    size_t constexpr EVENT_NAME_STACK_SIZE = 128;
+
+    //------------------------------------------------------------------------------------------------
+    char ToLowerAscii(char const c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Event names are case-insensitive: both lookups go through the lower-case spelling
+    template <typename InternFunction>
+    EventID LookUpLowerCase(std::string_view const eventName, InternFunction intern)
+    {
+        if (eventName.size() <= EVENT_NAME_STACK_SIZE)
+        {
+            char lowerCase[EVENT_NAME_STACK_SIZE];
+            for (size_t i = 0; i < eventName.size(); ++i)
+            {
+                lowerCase[i] = ToLowerAscii(eventName[i]);
+            }
+            return intern(std::string_view(lowerCase, eventName.size()));
+        }
+
+        String lowerCase(eventName);
+        for (char& c : lowerCase)
+        {
+            c = ToLowerAscii(c);
+        }
+        return intern(lowerCase);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    size_t GetHomeSlot(EventID const eventID, size_t const slotCount)
+    {
+        return (static_cast<size_t>(eventID) * 2654435761u) & (slotCount - 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// EventArgs
+//----------------------------------------------------------------------------------------------------
+void EventArgs::SetValue(std::string_view const keyName, char const* value)
+{
+    RemoveInlineArg(keyName);
+    NamedProperties::SetValue(keyName, value);
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string EventArgs::GetValue(std::string_view const keyName, char const* defaultValue) const
+{
+    return GetValue<std::string>(keyName, std::string(defaultValue));
+}
+
+//----------------------------------------------------------------------------------------------------
+EventArgs::sInlineArg const* EventArgs::FindInlineArg(std::string_view const keyName) const
+{
+    if (keyName.size() > EVENT_ARG_MAX_INLINE_KEY_LENGTH)
+    {
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < m_inlineArgCount; ++i)
+    {
+        sInlineArg const& arg = m_inlineArgs[i];
+        if (arg.m_keyLength != keyName.size())
+        {
+            continue;
+        }
+
+        bool matches = true;
+        for (size_t c = 0; c < keyName.size() && matches; ++c)
+        {
+            matches = ToLowerAscii(arg.m_key[c]) == ToLowerAscii(keyName[c]);
+        }
+        if (matches)
+        {
+            return &arg;
+        }
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventArgs::SetInlineArg(std::string_view const keyName, sInlineArg const& value)
+{
+    if (keyName.size() > EVENT_ARG_MAX_INLINE_KEY_LENGTH)
+    {
+        return false;
+    }
+
+    sInlineArg* arg = const_cast<sInlineArg*>(FindInlineArg(keyName));
+    if (arg == nullptr)
+    {
+        if (m_inlineArgCount == EVENT_ARG_INLINE_SLOT_COUNT)
+        {
+            return false;
+        }
+        arg = &m_inlineArgs[m_inlineArgCount++];
+    }
+
+    *arg = value;
+    std::memcpy(arg->m_key, keyName.data(), keyName.size());
+    arg->m_keyLength = static_cast<uint8_t>(keyName.size());
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventArgs::RemoveInlineArg(std::string_view const keyName)
+{
+    sInlineArg const* const arg = FindInlineArg(keyName);
+    if (arg != nullptr)
+    {
+        m_inlineArgs[arg - m_inlineArgs.data()] = m_inlineArgs[--m_inlineArgCount];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+String EventArgs::FormatInlineArg(sInlineArg const& arg)
+{
+    switch (arg.m_type)
+    {
+    case eInlineArgType::BOOL:     return arg.m_signed != 0 ? "true" : "false";
+    case eInlineArgType::SIGNED:   return Stringf("%lld", static_cast<long long>(arg.m_signed));
+    case eInlineArgType::UNSIGNED: return Stringf("%llu", static_cast<unsigned long long>(arg.m_unsigned));
+    case eInlineArgType::FLOAT:    return Stringf("%g", arg.m_double);
+    }
+    return String();
+}
+
+//----------------------------------------------------------------------------------------------------
+// EventSystem
 //----------------------------------------------------------------------------------------------------
 EventSystem::EventSystem(sEventSystemConfig const& config)
     : m_config(config)
@@ -27,7 +162,8 @@ void EventSystem::Startup()
 void EventSystem::Shutdown()
 {
     std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-    m_subscriptionsByEventName.clear();
+    m_slots.clear();
+    m_usedSlotCount = 0;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -41,65 +177,87 @@ void EventSystem::EndFrame()
 }
 
 //----------------------------------------------------------------------------------------------------
-void EventSystem::SubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction const functionPtr)
+EventID EventSystem::InternEventName(std::string_view const eventName)
 {
-    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+    return LookUpLowerCase(eventName, [](std::string_view const lowerCase) { return InternString(lowerCase); });
+}
+
+//----------------------------------------------------------------------------------------------------
+EventID EventSystem::FindEventID(std::string_view const eventName)
+{
+    return LookUpLowerCase(eventName, [](std::string_view const lowerCase) { return FindInternedString(lowerCase); });
+}
 
+//----------------------------------------------------------------------------------------------------
+void EventSystem::SubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction const functionPtr)
+{
     sEventSubscription newSubscription;
     newSubscription.callbackFunction = functionPtr;
 
-    HashedCaseInsensitiveString hcisName(eventName);
-    SubscriptionList& subscriptions = m_subscriptionsByEventName[hcisName];
-
-    subscriptions.push_back(newSubscription);
+    AddSubscription(eventName, newSubscription);
 }
 
 //----------------------------------------------------------------------------------------------------
 void EventSystem::UnsubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction const functionPtr)
 {
-    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-
-    HashedCaseInsensitiveString hcisName(eventName);
-    auto const iter = m_subscriptionsByEventName.find(hcisName);
-
-    if (iter != m_subscriptionsByEventName.end())
+    EventID const eventID = FindEventID(eventName);
+    if (eventID == EVENT_ID_INVALID)
     {
-        SubscriptionList& subscriptions = iter->second;
+        return;
+    }
 
-        subscriptions.erase(
-            std::remove_if(subscriptions.begin(), subscriptions.end(),
-                           [functionPtr](sEventSubscription const& subscription)
-                           {
-                               return subscription.callbackFunction == functionPtr;
-                           }),
-            subscriptions.end()
-        );
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
 
-        // If the list is empty, remove the entry from the map
-        if (subscriptions.empty())
-        {
-            m_subscriptionsByEventName.erase(iter);
-        }
+    sEventSlot* const slot = FindSlotLocked(eventID);
+    if (slot != nullptr)
+    {
+        slot->m_subscriptions = RemoveIf(slot->m_subscriptions,
+                                         [functionPtr](sEventSubscription const& subscription)
+                                         {
+                                             return subscription.callbackFunction == functionPtr;
+                                         });
     }
 }
 
 //----------------------------------------------------------------------------------------------------
 void EventSystem::FireEvent(String const& eventName, EventArgs& args)
 {
-    // Make a local copy of the subscription list to avoid holding mutex during callback execution
-    SubscriptionList subscriptionsCopy;
+    FireEvent(FindEventID(eventName), args);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventSystem::FireEvent(String const& eventName)
+{
+    EventArgs emptyArgs;
+    FireEvent(FindEventID(eventName), emptyArgs);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventSystem::FireEvent(EventID const eventID, EventArgs& args)
+{
+    if (eventID == EVENT_ID_INVALID)
+    {
+        return;
+    }
+
+    // Hold a reference to the published list; subscribers changing it meanwhile publish a new one
+    SubscriptionListPtr subscriptions;
     {
         std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        HashedCaseInsensitiveString hcisName(eventName);
-        auto const iter = m_subscriptionsByEventName.find(hcisName);
-        if (iter != m_subscriptionsByEventName.end())
+        sEventSlot const* const     slot = FindSlotLocked(eventID);
+        if (slot != nullptr)
         {
-            subscriptionsCopy = iter->second;  // Copy the subscription list
+            subscriptions = slot->m_subscriptions;
         }
     }
 
+    if (subscriptions == nullptr)
+    {
+        return;
+    }
+
     // Execute callbacks without holding the mutex (callbacks might subscribe/unsubscribe)
-    for (sEventSubscription const& subscription : subscriptionsCopy)
+    for (sEventSubscription const& subscription : *subscriptions)
     {
         bool consumed = false;
 
@@ -120,10 +278,24 @@ void EventSystem::FireEvent(String const& eventName, EventArgs& args)
 }
 
 //----------------------------------------------------------------------------------------------------
-void EventSystem::FireEvent(String const& eventName)
+void EventSystem::FireEvent(EventID const eventID)
 {
     EventArgs emptyArgs;
-    FireEvent(eventName, emptyArgs);
+    FireEvent(eventID, emptyArgs);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventSystem::HasSubscribers(String const& eventName) const
+{
+    EventID const eventID = FindEventID(eventName);
+    if (eventID == EVENT_ID_INVALID)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+    sEventSlot const* const     slot = FindSlotLocked(eventID);
+    return slot != nullptr && slot->m_subscriptions != nullptr;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -132,11 +304,14 @@ StringList EventSystem::GetAllRegisteredEventNames() const
     std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
 
     std::vector<String> eventNames;
-    eventNames.reserve(m_subscriptionsByEventName.size());
+    eventNames.reserve(m_usedSlotCount);
 
-    for (auto const& pair : m_subscriptionsByEventName)
+    for (sEventSlot const& slot : m_slots)
     {
-        eventNames.push_back(pair.first.GetOriginalString());
+        if (slot.m_subscriptions != nullptr)
+        {
+            eventNames.push_back(GetInternedString(slot.m_displayName));
+        }
     }
 
     return eventNames;
@@ -147,27 +322,138 @@ void EventSystem::UnsubscribeAllEventCallbacksForObject(void* object)
 {
     std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
 
-    for (auto iter = m_subscriptionsByEventName.begin(); iter != m_subscriptionsByEventName.end(); )
+    for (sEventSlot& slot : m_slots)
+    {
+        slot.m_subscriptions = RemoveIf(slot.m_subscriptions,
+                                        [object](sEventSubscription const& sub)
+                                        {
+                                            return sub.objectInstance == object;
+                                        });
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventSystem::AddSubscription(String const& eventName, sEventSubscription const& subscription)
+{
+    EventID const eventID = InternEventName(eventName);
+    if (eventID == EVENT_ID_INVALID)
+    {
+        DAEMON_LOG(LogEvent, eLogVerbosity::Warning, "EventSystem: ignoring subscription to an empty event name");
+        return;
+    }
+    InternedStringID const displayName = InternString(eventName);
+
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+
+    sEventSlot& slot = FindOrAddSlotLocked(eventID);
+
+    auto subscriptions = slot.m_subscriptions != nullptr ? std::make_shared<SubscriptionList>(*slot.m_subscriptions)
+                                                         : std::make_shared<SubscriptionList>();
+    subscriptions->push_back(subscription);
+
+    if (slot.m_subscriptions == nullptr)
+    {
+        slot.m_displayName = displayName;
+    }
+    slot.m_subscriptions = std::move(subscriptions);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventSystem::RemoveMemberSubscriptions(String const& eventName, void* object)
+{
+    EventID const eventID = FindEventID(eventName);
+    if (eventID == EVENT_ID_INVALID)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+
+    sEventSlot* const slot = FindSlotLocked(eventID);
+    if (slot != nullptr)
+    {
+        slot->m_subscriptions = RemoveIf(slot->m_subscriptions,
+                                         [object](sEventSubscription const& sub)
+                                         {
+                                             return sub.objectInstance == object && sub.callbackFunction == nullptr;
+                                         });
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+EventSystem::sEventSlot* EventSystem::FindSlotLocked(EventID const eventID)
+{
+    return const_cast<sEventSlot*>(static_cast<EventSystem const*>(this)->FindSlotLocked(eventID));
+}
+
+//----------------------------------------------------------------------------------------------------
+EventSystem::sEventSlot const* EventSystem::FindSlotLocked(EventID const eventID) const
+{
+    if (m_slots.empty())
+    {
+        return nullptr;
+    }
+
+    size_t const mask = m_slots.size() - 1;
+    for (size_t index = GetHomeSlot(eventID, m_slots.size());; index = (index + 1) & mask)
+    {
+        sEventSlot const& slot = m_slots[index];
+        if (slot.m_eventID == eventID)
+        {
+            return &slot;
+        }
+        if (slot.m_eventID == EVENT_ID_INVALID)
+        {
+            return nullptr;     // At most half full, so a probe always reaches an unused slot
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+EventSystem::sEventSlot& EventSystem::FindOrAddSlotLocked(EventID const eventID)
+{
+    if (sEventSlot* const existing = FindSlotLocked(eventID))
+    {
+        return *existing;
+    }
+
+    if ((m_usedSlotCount + 1) * 2 > m_slots.size())
     {
-        SubscriptionList& subscriptions = iter->second;
+        GrowLocked();
+    }
+
+    size_t const mask  = m_slots.size() - 1;
+    size_t       index = GetHomeSlot(eventID, m_slots.size());
+    while (m_slots[index].m_eventID != EVENT_ID_INVALID)
+    {
+        index = (index + 1) & mask;
+    }
+
+    ++m_usedSlotCount;
+    m_slots[index].m_eventID = eventID;
+    return m_slots[index];
+}
 
-        subscriptions.erase(
-            std::remove_if(subscriptions.begin(), subscriptions.end(),
-                           [object](sEventSubscription const& sub)
-                           {
-                               return sub.objectInstance == object;
-                           }),
-            subscriptions.end()
-        );
+//----------------------------------------------------------------------------------------------------
+void EventSystem::GrowLocked()
+{
+    std::vector<sEventSlot> oldSlots = std::move(m_slots);
+    m_slots.assign((std::max)(MIN_SLOT_COUNT, oldSlots.size() * 2), sEventSlot{});
 
-        if (subscriptions.empty())
+    size_t const mask = m_slots.size() - 1;
+    for (sEventSlot& oldSlot : oldSlots)
+    {
+        if (oldSlot.m_eventID == EVENT_ID_INVALID)
         {
-            iter = m_subscriptionsByEventName.erase(iter);
+            continue;
         }
-        else
+
+        size_t index = GetHomeSlot(oldSlot.m_eventID, m_slots.size());
+        while (m_slots[index].m_eventID != EVENT_ID_INVALID)
         {
-            ++iter;
+            index = (index + 1) & mask;
         }
+        m_slots[index] = std::move(oldSlot);
     }
 }
 
@@ -209,6 +495,24 @@ void FireEvent(String const& eventName)
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+void FireEvent(EventID const eventID, EventArgs& args)
+{
+    if (g_eventSystem != nullptr)
+    {
+        g_eventSystem->FireEvent(eventID, args);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void FireEvent(EventID const eventID)
+{
+    if (g_eventSystem != nullptr)
+    {
+        g_eventSystem->FireEvent(eventID);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void UnsubscribeAllEventCallbacksForObject(void* object)
 {
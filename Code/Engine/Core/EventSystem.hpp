@@ -6,19 +6,84 @@
 #pragma once
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Core/HashedCaseInsensitiveString.hpp"
+#include "Engine/Core/InternedString.hpp"
 #include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Core/StringUtils.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <functional>
-#include <map>
+#include <memory>
 #include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
+//----------------------------------------------------------------------------------------------------
+// EventArgs: NamedProperties plus a compact typed argument block.
+// Arithmetic values (int, float, bool, ...) under keys of up to EVENT_ARG_MAX_INLINE_KEY_LENGTH
+// characters live in fixed inline slots: no heap, no RTTI. Everything else falls through to
+// NamedProperties. Inline values read back as any arithmetic type (static_cast) or as a String.
+//----------------------------------------------------------------------------------------------------
+size_t constexpr EVENT_ARG_INLINE_SLOT_COUNT     = 6;
+size_t constexpr EVENT_ARG_MAX_INLINE_KEY_LENGTH = 22;
+
+class EventArgs : public NamedProperties
+{
+public:
+    template <typename T>
+    void SetValue(std::string_view keyName, T const& value);
+
+    template <typename T>
+    T GetValue(std::string_view keyName, T const& defaultValue) const;
+
+    void        SetValue(std::string_view keyName, char const* value);
+    std::string GetValue(std::string_view keyName, char const* defaultValue) const;
+
+private:
+    enum class eInlineArgType : uint8_t
+    {
+        BOOL,
+        SIGNED,     // m_signed
+        UNSIGNED,   // m_unsigned
+        FLOAT,      // m_double (floats widen exactly)
+    };
+
+    struct sInlineArg
+    {
+        char           m_key[EVENT_ARG_MAX_INLINE_KEY_LENGTH] = {};
+        uint8_t        m_keyLength                            = 0;
+        eInlineArgType m_type                                 = eInlineArgType::BOOL;
+        union
+        {
+            int64_t  m_signed = 0;
+            uint64_t m_unsigned;
+            double   m_double;
+        };
+    };
+
+    template <typename T>
+    static bool constexpr IS_INLINE_TYPE = std::is_arithmetic_v<T> && !std::is_same_v<T, char>;
+
+    sInlineArg const* FindInlineArg(std::string_view keyName) const;
+    bool              SetInlineArg(std::string_view keyName, sInlineArg const& value);   // false: key too long or slots full
+    void              RemoveInlineArg(std::string_view keyName);
+    static String     FormatInlineArg(sInlineArg const& arg);
+
+    std::array<sInlineArg, EVENT_ARG_INLINE_SLOT_COUNT> m_inlineArgs;
+    uint8_t                                             m_inlineArgCount = 0;
+};
 
 //----------------------------------------------------------------------------------------------------
-using EventArgs             = NamedProperties;
 using EventCallbackFunction = bool (*)(EventArgs& args);
 
+// Case-insensitive event name, interned. Stable for the life of the process, so hot callers can
+// look one up once (EventSystem::InternEventName) and fire by ID.
+using EventID = InternedStringID;
+EventID constexpr EVENT_ID_INVALID = INTERNED_STRING_ID_EMPTY;
+
 //----------------------------------------------------------------------------------------------------
 struct sEventSubscription
 {
@@ -35,6 +100,11 @@ struct sEventSystemConfig
 //----------------------------------------------------------------------------------------------------
 using SubscriptionList = std::vector<sEventSubscription>;
 
+//----------------------------------------------------------------------------------------------------
+// Subscriptions live in a flat open-addressing table keyed by EventID. Each event's list is
+// immutable once published: subscribe / unsubscribe build a new list and swap the pointer, so
+// FireEvent only takes a reference under the lock and never copies or allocates. Callbacks run
+// unlocked and may subscribe / unsubscribe; the list being dispatched stays alive until they return.
 //----------------------------------------------------------------------------------------------------
 class EventSystem
 {
@@ -47,10 +117,15 @@ public:
     void BeginFrame();
     void EndFrame();
 
+    static EventID InternEventName(std::string_view eventName);   // Always valid (except for "")
+    static EventID FindEventID(std::string_view eventName);       // EVENT_ID_INVALID if never interned
+
     void SubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction functionPtr);
     void UnsubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction functionPtr);
     void FireEvent(String const& eventName, EventArgs& args);
     void FireEvent(String const& eventName);
+    void FireEvent(EventID eventID, EventArgs& args);
+    void FireEvent(EventID eventID);
 
     // Member function subscription
     template <typename ObjectType>
@@ -61,12 +136,35 @@ public:
 
     void UnsubscribeAllEventCallbacksForObject(void* object);
 
+    bool       HasSubscribers(String const& eventName) const;
     StringList GetAllRegisteredEventNames() const;
 
 protected:
-    sEventSystemConfig                 m_config;
-    std::map<HashedCaseInsensitiveString, SubscriptionList> m_subscriptionsByEventName;
-    mutable std::mutex                 m_subscriptionsMutex;  // Thread-safe access to m_subscriptionsByEventName
+    using SubscriptionListPtr = std::shared_ptr<SubscriptionList const>;
+
+    struct sEventSlot
+    {
+        EventID             m_eventID     = EVENT_ID_INVALID;          // EVENT_ID_INVALID = unused slot
+        InternedStringID    m_displayName = INTERNED_STRING_ID_EMPTY;  // Spelling of the first subscription
+        SubscriptionListPtr m_subscriptions;                           // nullptr once emptied; slots are never removed
+    };
+
+    void AddSubscription(String const& eventName, sEventSubscription const& subscription);
+    void RemoveMemberSubscriptions(String const& eventName, void* object);
+
+    // Callers hold m_subscriptionsMutex
+    sEventSlot*       FindSlotLocked(EventID eventID);
+    sEventSlot const* FindSlotLocked(EventID eventID) const;
+    sEventSlot&       FindOrAddSlotLocked(EventID eventID);
+    void              GrowLocked();
+
+    template <typename Predicate>
+    static SubscriptionListPtr RemoveIf(SubscriptionListPtr const& subscriptions, Predicate predicate);
+
+    sEventSystemConfig       m_config;
+    std::vector<sEventSlot>  m_slots;                // Power-of-two size, at most half full
+    size_t                   m_usedSlotCount = 0;
+    mutable std::mutex       m_subscriptionsMutex;   // Guards m_slots; never held during callbacks
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -76,17 +174,117 @@ void SubscribeEventCallbackFunction(String const& eventName, EventCallbackFuncti
 void UnsubscribeEventCallbackFunction(String const& eventName, EventCallbackFunction functionPtr);
 void FireEvent(String const& eventName, EventArgs& args);
 void FireEvent(String const& eventName);
+void FireEvent(EventID eventID, EventArgs& args);
+void FireEvent(EventID eventID);
 
 void UnsubscribeAllEventCallbacksForObject(void* object);
 
 //----------------------------------------------------------------------------------------------------
 // Template implementations
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void EventArgs::SetValue(std::string_view const keyName, T const& value)
+{
+    if constexpr (IS_INLINE_TYPE<T>)
+    {
+        sInlineArg arg;
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            arg.m_type   = eInlineArgType::BOOL;
+            arg.m_signed = value ? 1 : 0;
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            arg.m_type   = eInlineArgType::FLOAT;
+            arg.m_double = static_cast<double>(value);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            arg.m_type   = eInlineArgType::SIGNED;
+            arg.m_signed = static_cast<int64_t>(value);
+        }
+        else
+        {
+            arg.m_type     = eInlineArgType::UNSIGNED;
+            arg.m_unsigned = static_cast<uint64_t>(value);
+        }
+
+        if (SetInlineArg(keyName, arg))
+        {
+            return;
+        }
+    }
+
+    RemoveInlineArg(keyName);
+    NamedProperties::SetValue(keyName, value);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T EventArgs::GetValue(std::string_view const keyName, T const& defaultValue) const
+{
+    sInlineArg const* const arg = FindInlineArg(keyName);
+
+    if (arg == nullptr)
+    {
+        return NamedProperties::GetValue(keyName, defaultValue);
+    }
+
+    if constexpr (IS_INLINE_TYPE<T>)
+    {
+        switch (arg->m_type)
+        {
+        case eInlineArgType::BOOL:     return static_cast<T>(arg->m_signed != 0);
+        case eInlineArgType::SIGNED:   return static_cast<T>(arg->m_signed);
+        case eInlineArgType::UNSIGNED: return static_cast<T>(arg->m_unsigned);
+        case eInlineArgType::FLOAT:    return static_cast<T>(arg->m_double);
+        }
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return FormatInlineArg(*arg);
+    }
+
+    // Type mismatch — return default
+    return defaultValue;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Predicate>
+EventSystem::SubscriptionListPtr EventSystem::RemoveIf(SubscriptionListPtr const& subscriptions, Predicate predicate)
+{
+    if (subscriptions == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t const removeCount = static_cast<size_t>(std::count_if(subscriptions->begin(), subscriptions->end(), predicate));
+    if (removeCount == 0)
+    {
+        return subscriptions;   // Keep the published list
+    }
+    if (removeCount == subscriptions->size())
+    {
+        return nullptr;
+    }
+
+    auto remaining = std::make_shared<SubscriptionList>();
+    remaining->reserve(subscriptions->size() - removeCount);
+
+    for (sEventSubscription const& subscription : *subscriptions)
+    {
+        if (!predicate(subscription))
+        {
+            remaining->push_back(subscription);
+        }
+    }
+    return remaining;
+}
+
 //----------------------------------------------------------------------------------------------------
 template <typename ObjectType>
 void EventSystem::SubscribeEventCallbackObjectMethod(String const& eventName, ObjectType* object, bool (ObjectType::*method)(EventArgs&))
 {
-    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-
     sEventSubscription newSubscription;
     newSubscription.objectInstance = static_cast<void*>(object);
     newSubscription.memberCallback = [object, method](EventArgs& args) -> bool
@@ -94,38 +292,16 @@ void EventSystem::SubscribeEventCallbackObjectMethod(String const& eventName, Ob
         return (object->*method)(args);
     };
 
-    HashedCaseInsensitiveString hcisName(eventName);
-    m_subscriptionsByEventName[hcisName].push_back(newSubscription);
+    AddSubscription(eventName, newSubscription);
 }
 
 //----------------------------------------------------------------------------------------------------
+// Removes every member-method subscription of object to eventName
 template <typename ObjectType>
 void EventSystem::UnsubscribeEventCallbackObjectMethod(String const& eventName, ObjectType* object, bool (ObjectType::*method)(EventArgs&))
 {
-    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-
-    HashedCaseInsensitiveString hcisName(eventName);
-    auto iter = m_subscriptionsByEventName.find(hcisName);
-
-    if (iter != m_subscriptionsByEventName.end())
-    {
-        SubscriptionList& subscriptions = iter->second;
-
-        subscriptions.erase(
-            std::remove_if(subscriptions.begin(), subscriptions.end(),
-                           [object](sEventSubscription const& sub)
-                           {
-                               return sub.objectInstance == static_cast<void*>(object)
-                                   && sub.callbackFunction == nullptr;
-                           }),
-            subscriptions.end()
-        );
-
-        if (subscriptions.empty())
-        {
-            m_subscriptionsByEventName.erase(iter);
-        }
-    }
+    UNUSED(method)
+    RemoveMemberSubscriptions(eventName, static_cast<void*>(object));
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -5,19 +5,42 @@
 #include "Engine/Core/LogSubsystem.hpp"
 #include "Engine/Core/FileOutputDevice.hpp"
 
+#include <charconv>
 #include <fstream>
 #include <mutex>
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+	char const* GetVerbosityName(eLogVerbosity const verbosity)
+	{
+		switch (verbosity)
+		{
+		case eLogVerbosity::Fatal: return "Fatal";
+		case eLogVerbosity::Error: return "Error";
+		case eLogVerbosity::Warning: return "Warning";
+		case eLogVerbosity::Display: return "Display";
+		case eLogVerbosity::Log: return "Log";
+		case eLogVerbosity::Verbose: return "Verbose";
+		case eLogVerbosity::VeryVerbose: return "VeryVerbose";
+		default: return "Unknown";
+		}
+	}
+}
+
 //----------------------------------------------------------------------------------------------------
 // FileOutputDevice implementation
 //----------------------------------------------------------------------------------------------------
 
-FileOutputDevice::FileOutputDevice(const String& filePath)
+FileOutputDevice::FileOutputDevice(const String& filePath, sLogFlushPolicy const& flushPolicy)
 	: m_filePath(filePath)
+	, m_flushPolicy(flushPolicy)
 {
+	m_writeBuffer.reserve(m_flushPolicy.flushBytes + 4096);
+
 	// 嘗試直接開啟檔案
 	m_logFile.open(filePath, std::ios::out | std::ios::app);
 
@@ -47,6 +70,7 @@ FileOutputDevice::~FileOutputDevice()
 {
 	if (m_logFile.is_open())
 	{
+		WriteOutBuffer();
 		m_logFile.close();
 	}
 }
@@ -57,40 +81,28 @@ void FileOutputDevice::WriteLog(const LogEntry& entry)
 
 	if (m_logFile.is_open())
 	{
-		m_logFile << "[" << entry.m_timestamp << "] "
-		<< "[" << entry.m_threadId << "] "
-		<< "[" << entry.m_category << "] ";
-
-		// 轉換詳細程度為字串
-		const char* verbosityStr = "Unknown";
-		switch (entry.m_verbosity)
-		{
-		case eLogVerbosity::Fatal: verbosityStr = "Fatal";
-			break;
-		case eLogVerbosity::Error: verbosityStr = "Error";
-			break;
-		case eLogVerbosity::Warning: verbosityStr = "Warning";
-			break;
-		case eLogVerbosity::Display: verbosityStr = "Display";
-			break;
-		case eLogVerbosity::Log: verbosityStr = "Log";
-			break;
-		case eLogVerbosity::Verbose: verbosityStr = "Verbose";
-			break;
-		case eLogVerbosity::VeryVerbose: verbosityStr = "VeryVerbose";
-			break;
-		}
+		AppendFormattedLine(entry);
+		FlushIfDue(entry.m_verbosity <= eLogVerbosity::Error);
+	}
+}
 
-		m_logFile << "[" << verbosityStr << "] " << entry.m_message;
+void FileOutputDevice::WriteLogBatch(std::span<LogEntry const* const> const entries)
+{
+	std::lock_guard lock(m_fileMutex);
 
-		// 如果有檔案和行號資訊，也記錄下來
-		if (!entry.m_fileName.empty() && entry.m_lineNum > 0)
-		{
-			m_logFile << " (" << entry.m_fileName << ":" << entry.m_lineNum << ")";
-		}
+	if (!m_logFile.is_open())
+	{
+		return;
+	}
 
-		m_logFile << std::endl;
+	bool hasErrorEntry = false;
+	for (LogEntry const* entry : entries)
+	{
+		AppendFormattedLine(*entry);
+		hasErrorEntry |= entry->m_verbosity <= eLogVerbosity::Error;
 	}
+
+	FlushIfDue(hasErrorEntry);
 }
 
 void FileOutputDevice::Flush()
@@ -98,7 +110,7 @@ void FileOutputDevice::Flush()
 	std::lock_guard<std::mutex> lock(m_fileMutex);
 	if (m_logFile.is_open())
 	{
-		m_logFile.flush();
+		WriteOutBuffer();
 	}
 }
 
@@ -106,3 +118,63 @@ bool FileOutputDevice::IsAvailable() const
 {
 	return m_logFile.is_open();
 }
+
+//----------------------------------------------------------------------------------------------------
+// [timestamp] [threadId] [category] [verbosity] message (file:line)
+//----------------------------------------------------------------------------------------------------
+void FileOutputDevice::AppendFormattedLine(LogEntry const& entry)
+{
+	if (m_writeBuffer.empty())
+	{
+		m_bufferStartTime = std::chrono::steady_clock::now();
+	}
+
+	m_writeBuffer += '[';
+	m_writeBuffer += entry.m_timestamp;
+	m_writeBuffer += "] [";
+	m_writeBuffer += entry.m_threadId;
+	m_writeBuffer += "] [";
+	m_writeBuffer += entry.m_category;
+	m_writeBuffer += "] [";
+	m_writeBuffer += GetVerbosityName(entry.m_verbosity);
+	m_writeBuffer += "] ";
+	m_writeBuffer += entry.m_message;
+
+	// 如果有檔案和行號資訊，也記錄下來
+	if (!entry.m_fileName.empty() && entry.m_lineNum > 0)
+	{
+		char       lineText[16];
+		auto const result = std::to_chars(lineText, lineText + sizeof(lineText), entry.m_lineNum);
+
+		m_writeBuffer += " (";
+		m_writeBuffer += entry.m_fileName;
+		m_writeBuffer += ':';
+		m_writeBuffer.append(lineText, result.ptr);
+		m_writeBuffer += ')';
+	}
+
+	m_writeBuffer += '\n';
+}
+
+//----------------------------------------------------------------------------------------------------
+void FileOutputDevice::FlushIfDue(bool const hasErrorEntry)
+{
+	if (m_writeBuffer.size() >= m_flushPolicy.flushBytes ||
+		(hasErrorEntry && m_flushPolicy.flushOnError) ||
+		std::chrono::steady_clock::now() - m_bufferStartTime >= std::chrono::milliseconds(m_flushPolicy.flushIntervalMs))
+	{
+		WriteOutBuffer();
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+void FileOutputDevice::WriteOutBuffer()
+{
+	if (!m_writeBuffer.empty())
+	{
+		m_logFile.write(m_writeBuffer.data(), static_cast<std::streamsize>(m_writeBuffer.size()));
+		m_writeBuffer.clear();
+	}
+
+	m_logFile.flush();
+}
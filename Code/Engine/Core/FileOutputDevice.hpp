@@ -5,6 +5,7 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 
+#include <chrono>
 #include <fstream>
 #include <mutex>
 #include <string>
@@ -14,6 +15,7 @@
 
 //----------------------------------------------------------------------------------------------------
 // File output device (fallback when SmartFileOutputDevice fails)
+//   Lines are formatted into m_writeBuffer and reach the file in one write() per flush (see sLogFlushPolicy)
 //----------------------------------------------------------------------------------------------------
 class FileOutputDevice : public ILogOutputDevice
 {
@@ -22,11 +24,22 @@ private:
 	String             m_filePath;
 	mutable std::mutex m_fileMutex;
 
+	sLogFlushPolicy                       m_flushPolicy;
+	String                                m_writeBuffer;
+	std::chrono::steady_clock::time_point m_bufferStartTime;   // When the oldest buffered line was appended
+
 public:
-	explicit FileOutputDevice(const String& filePath);
+	explicit FileOutputDevice(const String& filePath, sLogFlushPolicy const& flushPolicy = sLogFlushPolicy{});
 	~FileOutputDevice();
 
 	void WriteLog(const LogEntry& entry) override;
+	void WriteLogBatch(std::span<LogEntry const* const> entries) override;
 	void Flush() override;
 	bool IsAvailable() const override;
+
+private:
+	// Callers hold m_fileMutex
+	void AppendFormattedLine(LogEntry const& entry);
+	void FlushIfDue(bool hasErrorEntry);
+	void WriteOutBuffer();
 };
@@ -8,25 +8,29 @@
 //   that handlers can interpret at runtime.
 //
 // Design Decisions:
-//   - std::any over v8::Persistent: Keeps Core module V8-free, consistent with RenderCommand pattern
-//   - std::any over std::variant: Payload schema is runtime-defined (not compile-time enumerable)
-//   - String type field: O(1) handler lookup via std::unordered_map in GenericCommandExecutor
-//   - Optional callback: Fire-and-forget commands have callbackId = 0
-//   - Default constructor required for CommandQueueBase ring buffer array initialization
+//   - GenericCommandPayload over v8::Persistent: Keeps Core module V8-free, consistent with RenderCommand pattern
+//   - GenericCommandPayload over std::variant: Payload schema is runtime-defined (not compile-time enumerable)
+//   - GenericCommandPayload over std::any: Guaranteed 48-byte inline buffer, so a JSON string payload
+//     does not allocate (std::any's small buffer is implementation-defined)
+//   - Interned type / agent IDs: Command types are interned once, when their handler is registered;
+//     submitters resolve IDs up front (and cache them), so building a command never touches the
+//     intern table and the executor indexes its handler table by ID instead of hashing a string
+//   - Optional callback: Fire-and-forget commands have callbackId = 0. The JS callback itself lives in
+//     GenericCommandExecutor's stored-callback map, not in the command
+//   - Default constructor required for MPMCCommandQueueBase ring buffer array initialization
 //
 // Thread Safety:
 //   - Immutable after construction (no mutation after submission to queue)
-//   - Copyable for CommandQueueBase SPSC ring buffer operations
-//   - std::any handles its own deep copy semantics
+//   - Copyable and movable for MPMCCommandQueueBase ring buffer operations
+//   - GetTypeName() / GetAgentName() read the global intern table (shared lock)
 //
 // Memory Layout:
-//   - type: ~32 bytes (SSO std::string)
-//   - payload: ~64 bytes (std::any with small buffer optimization)
-//   - agentId: ~32 bytes (SSO std::string)
+//   - payload: 56-64 bytes (48-byte inline buffer + operations pointer, aligned to max_align_t)
+//   - typeId: 4 bytes (InternedStringID)
+//   - agentId: 4 bytes (InternedStringID)
 //   - callbackId: 8 bytes (uint64_t)
-//   - callback: ~64 bytes (std::any)
 //   - timestamp: 8 bytes (uint64_t)
-//   Total: ~208 bytes per command (varies by payload size)
+//   Total: 80-96 bytes per command (platform alignment), no heap memory for payloads that fit inline
 //
 // Author: GenericCommand System - Phase 1
 // Date: 2026-02-10
@@ -35,52 +39,52 @@
 #pragma once
 
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Core/GenericCommandPayload.hpp"
+#include "Engine/Core/InternedString.hpp"
 #include "Engine/Core/StringUtils.hpp"
 //----------------------------------------------------------------------------------------------------
-#include <any>
 #include <chrono>
 
 //----------------------------------------------------------------------------------------------------
 // GenericCommand
 //
-// Type-erased command for the GenericCommandQueue SPSC ring buffer.
-// Carries a string-based type identifier, a flexible std::any payload,
-// and an optional callback for async result delivery.
+// Type-erased command for the GenericCommandQueue MPMC ring buffer.
+// Carries an interned type identifier, an inline GenericCommandPayload,
+// and an optional callback ID for async result delivery.
 //
 // Usage:
-//   GenericCommand cmd("CreateMesh", meshData, "agent-01", callbackId, callback);
-//   queue->Submit(cmd);
+//   GenericCommand cmd(FindInternedString("CreateMesh"), meshData, agentId, callbackId);
+//   queue->Submit(std::move(cmd));
 //
 // The GenericCommandExecutor dispatches commands to registered handlers
-// based on the type field.
+// based on the typeId field.
 //----------------------------------------------------------------------------------------------------
 struct GenericCommand
 {
-	String   type;         // Command type identifier for handler lookup (e.g., "CreateMesh")
-	std::any payload;      // Type-erased payload data (interpreted by handler)
-	String   agentId;      // Submitting agent identifier (for rate limiting and audit)
-	uint64_t callbackId;   // Callback identifier (0 = no callback, fire-and-forget)
-	std::any callback;     // Optional callback function (ScriptCallback, stored as std::any)
-	uint64_t timestamp;    // Submission timestamp in milliseconds (for audit trail)
+	GenericCommandPayload payload;      // Type-erased payload data (interpreted by handler)
+	InternedStringID      typeId;       // Interned command type (e.g., "CreateMesh") for handler lookup
+	InternedStringID      agentId;      // Interned submitting agent name (for rate limiting and audit)
+	uint64_t              callbackId;   // Callback identifier (0 = no callback, fire-and-forget)
+	uint64_t              timestamp;    // Submission timestamp in milliseconds (for audit trail)
 
-	// Default constructor (required for CommandQueueBase ring buffer array initialization)
+	// Default constructor (required for MPMCCommandQueueBase ring buffer array initialization)
 	GenericCommand()
-	    : callbackId(0)
+	    : typeId(INTERNED_STRING_ID_EMPTY)
+	    , agentId(INTERNED_STRING_ID_EMPTY)
+	    , callbackId(0)
 	    , timestamp(0)
 	{
 	}
 
-	// Explicit constructor for command creation with callback
-	GenericCommand(String const& commandType,
-	               std::any      commandPayload,
-	               String const& submittingAgentId,
-	               uint64_t      cmdCallbackId = 0,
-	               std::any      cmdCallback   = std::any{})
-	    : type(commandType)
-	    , payload(std::move(commandPayload))
+	// Explicit constructor for command creation; callers resolve (and cache) the interned IDs
+	GenericCommand(InternedStringID      commandTypeId,
+	               GenericCommandPayload commandPayload,
+	               InternedStringID      submittingAgentId,
+	               uint64_t              cmdCallbackId = 0)
+	    : payload(std::move(commandPayload))
+	    , typeId(commandTypeId)
 	    , agentId(submittingAgentId)
 	    , callbackId(cmdCallbackId)
-	    , callback(std::move(cmdCallback))
 	    , timestamp(static_cast<uint64_t>(
 	          std::chrono::duration_cast<std::chrono::milliseconds>(
 	              std::chrono::steady_clock::now().time_since_epoch())
@@ -90,4 +94,8 @@ struct GenericCommand
 
 	// Check if this command has a callback
 	bool HasCallback() const { return callbackId != 0; }
+
+	// Resolve interned IDs back to names (logging, diagnostics)
+	String const& GetTypeName() const { return GetInternedString(typeId); }
+	String const& GetAgentName() const { return GetInternedString(agentId); }
 };
@@ -49,9 +49,12 @@ GenericCommandExecutor::~GenericCommandExecutor()
 
 bool GenericCommandExecutor::RegisterHandler(String const& commandType, HandlerFunc handler)
 {
+	InternedStringID const typeId = InternString(commandType);
+
 	std::lock_guard<std::mutex> lock(m_handlerMutex);
 
-	if (m_handlers.find(commandType) != m_handlers.end())
+	HandlerFunc& slot = GetOrGrow(m_handlers, m_typeRemap.FindOrAdd(typeId));
+	if (slot)
 	{
 		DAEMON_LOG(LogCore, eLogVerbosity::Warning,
 		           Stringf("GenericCommandExecutor: Handler already registered for type '%s'",
@@ -59,21 +62,24 @@ bool GenericCommandExecutor::RegisterHandler(String const& commandType, HandlerF
 		return false;
 	}
 
-	m_handlers[commandType] = std::move(handler);
+	slot = std::move(handler);
+	++m_handlerCount;
 
 	DAEMON_LOG(LogCore, eLogVerbosity::Log,
 	           Stringf("GenericCommandExecutor: Registered handler for '%s' (total: %zu)",
-	               commandType.c_str(), m_handlers.size()));
+	               commandType.c_str(), m_handlerCount));
 	return true;
 }
 
 //----------------------------------------------------------------------------------------------------
 bool GenericCommandExecutor::UnregisterHandler(String const& commandType)
 {
+	InternedStringID const typeId = FindInternedString(commandType);
+
 	std::lock_guard<std::mutex> lock(m_handlerMutex);
 
-	auto it = m_handlers.find(commandType);
-	if (it == m_handlers.end())
+	uint32_t const typeIndex = m_typeRemap.Find(typeId);
+	if (typeIndex >= m_handlers.size() || !m_handlers[typeIndex])
 	{
 		DAEMON_LOG(LogCore, eLogVerbosity::Warning,
 		           Stringf("GenericCommandExecutor: No handler registered for type '%s'",
@@ -81,19 +87,27 @@ bool GenericCommandExecutor::UnregisterHandler(String const& commandType)
 		return false;
 	}
 
-	m_handlers.erase(it);
+	m_handlers[typeIndex] = nullptr;
+	--m_handlerCount;
 
 	DAEMON_LOG(LogCore, eLogVerbosity::Log,
 	           Stringf("GenericCommandExecutor: Unregistered handler for '%s' (remaining: %zu)",
-	               commandType.c_str(), m_handlers.size()));
+	               commandType.c_str(), m_handlerCount));
 	return true;
 }
 
 //----------------------------------------------------------------------------------------------------
 bool GenericCommandExecutor::HasHandler(String const& commandType) const
+{
+	return HasHandler(FindInternedString(commandType));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool GenericCommandExecutor::HasHandler(InternedStringID commandTypeId) const
 {
 	std::lock_guard<std::mutex> lock(m_handlerMutex);
-	return m_handlers.find(commandType) != m_handlers.end();
+	uint32_t const typeIndex = m_typeRemap.Find(commandTypeId);
+	return typeIndex < m_handlers.size() && static_cast<bool>(m_handlers[typeIndex]);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -102,11 +116,14 @@ std::vector<String> GenericCommandExecutor::GetRegisteredTypes() const
 	std::lock_guard<std::mutex> lock(m_handlerMutex);
 
 	std::vector<String> types;
-	types.reserve(m_handlers.size());
+	types.reserve(m_handlerCount);
 
-	for (auto const& pair : m_handlers)
+	for (uint32_t typeIndex = 0; typeIndex < m_handlers.size(); ++typeIndex)
 	{
-		types.push_back(pair.first);
+		if (m_handlers[typeIndex])
+		{
+			types.push_back(GetInternedString(m_typeRemap.GetId(typeIndex)));
+		}
 	}
 
 	return types;
@@ -119,15 +136,16 @@ std::vector<String> GenericCommandExecutor::GetRegisteredTypes() const
 void GenericCommandExecutor::ExecuteCommand(GenericCommand const& command)
 {
 	// Track per-agent submission count
-	AgentStatistics& agentStats = m_agentStats[command.agentId];
+	uint32_t const   agentIndex = m_agentRemap.FindOrAdd(command.agentId);
+	AgentStatistics& agentStats = GetOrGrow(m_agentStats, agentIndex);
 	++agentStats.submitted;
 
 	//------------------------------------------------------------------------------------------------
 	// Rate Limit Check (token bucket, O(1), <1µs)
 	//------------------------------------------------------------------------------------------------
-	if (m_rateLimitPerAgent > 0 && !command.agentId.empty())
+	if (m_rateLimitPerAgent > 0 && command.agentId != INTERNED_STRING_ID_EMPTY)
 	{
-		auto& state = m_agentRateLimits[command.agentId];
+		RateLimitState& state = GetOrGrow(m_agentRateLimits, agentIndex);
 
 		// Initialize new agent state
 		if (state.lastRefillTime == 0.0)
@@ -147,7 +165,7 @@ void GenericCommandExecutor::ExecuteCommand(GenericCommand const& command)
 			{
 				DAEMON_LOG(LogCore, eLogVerbosity::Warning,
 				           Stringf("GenericCommandExecutor: Rate limited agent '%s' (rejected: %u, limit: %u/sec)",
-				               command.agentId.c_str(), state.rejectedCount, m_rateLimitPerAgent));
+				               command.GetAgentName().c_str(), state.rejectedCount, m_rateLimitPerAgent));
 			}
 
 			// If command has a callback, deliver error result
@@ -163,17 +181,18 @@ void GenericCommandExecutor::ExecuteCommand(GenericCommand const& command)
 		}
 	}
 
-	// Look up handler (lock-free read - safe because registration completes before game loop)
-	auto it = m_handlers.find(command.type);
+	// Look up handler by type index (lock-free read - safe because registration completes before game loop)
+	uint32_t const     typeIndex = m_typeRemap.Find(command.typeId);
+	HandlerFunc const* handler   = typeIndex < m_handlers.size() ? &m_handlers[typeIndex] : nullptr;
 
-	if (it == m_handlers.end())
+	if (handler == nullptr || !*handler)
 	{
 		++m_totalUnhandled;
 		++agentStats.unhandled;
 
 		DAEMON_LOG(LogCore, eLogVerbosity::Warning,
 		           Stringf("GenericCommandExecutor: No handler for command type '%s' from agent '%s'",
-		               command.type.c_str(), command.agentId.c_str()));
+		               command.GetTypeName().c_str(), command.GetAgentName().c_str()));
 
 		// Deliver error callback so JS caller gets notified
 		if (command.callbackId != 0)
@@ -188,51 +207,53 @@ void GenericCommandExecutor::ExecuteCommand(GenericCommand const& command)
 	}
 
 	// Execute handler with error isolation
+	CommandStatistics::TypeStats& typeStats = GetOrGrow(m_typeStats, typeIndex);
+
 	HandlerResult result;
 	bool success = false;
 	try
 	{
-		result = it->second(command.payload);
+		result = (*handler)(command.payload);
 		++m_totalExecuted;
 		++agentStats.executed;
-		++m_typeStats[command.type].executed;
+		++typeStats.executed;
 		success = true;
 	}
 	catch (std::bad_any_cast const& e)
 	{
 		++m_totalErrors;
 		++agentStats.failed;
-		++m_typeStats[command.type].failed;
+		++typeStats.failed;
 		result = HandlerResult::Error(
-			Stringf("Bad payload cast for '%s': %s", command.type.c_str(), e.what()));
+			Stringf("Bad payload cast for '%s': %s", command.GetTypeName().c_str(), e.what()));
 
 		DAEMON_LOG(LogCore, eLogVerbosity::Error,
 		           Stringf("GenericCommandExecutor: Bad payload cast for '%s' from agent '%s': %s",
-		               command.type.c_str(), command.agentId.c_str(), e.what()));
+		               command.GetTypeName().c_str(), command.GetAgentName().c_str(), e.what()));
 	}
 	catch (std::exception const& e)
 	{
 		++m_totalErrors;
 		++agentStats.failed;
-		++m_typeStats[command.type].failed;
+		++typeStats.failed;
 		result = HandlerResult::Error(
-			Stringf("Handler exception for '%s': %s", command.type.c_str(), e.what()));
+			Stringf("Handler exception for '%s': %s", command.GetTypeName().c_str(), e.what()));
 
 		DAEMON_LOG(LogCore, eLogVerbosity::Error,
 		           Stringf("GenericCommandExecutor: Handler exception for '%s' from agent '%s': %s",
-		               command.type.c_str(), command.agentId.c_str(), e.what()));
+		               command.GetTypeName().c_str(), command.GetAgentName().c_str(), e.what()));
 	}
 	catch (...)
 	{
 		++m_totalErrors;
 		++agentStats.failed;
-		++m_typeStats[command.type].failed;
+		++typeStats.failed;
 		result = HandlerResult::Error(
-			Stringf("Unknown exception in handler for '%s'", command.type.c_str()));
+			Stringf("Unknown exception in handler for '%s'", command.GetTypeName().c_str()));
 
 		DAEMON_LOG(LogCore, eLogVerbosity::Error,
 		           Stringf("GenericCommandExecutor: Unknown exception for '%s' from agent '%s'",
-		               command.type.c_str(), command.agentId.c_str()));
+		               command.GetTypeName().c_str(), command.GetAgentName().c_str()));
 	}
 
 	// Audit logging (when enabled)
@@ -240,8 +261,8 @@ void GenericCommandExecutor::ExecuteCommand(GenericCommand const& command)
 	{
 		DAEMON_LOG(LogCore, eLogVerbosity::Log,
 		           Stringf("AUDIT: agent='%s' type='%s' callbackId=%llu result=%s%s",
-		               command.agentId.c_str(),
-		               command.type.c_str(),
+		               command.GetAgentName().c_str(),
+		               command.GetTypeName().c_str(),
 		               command.callbackId,
 		               success ? "SUCCESS" : "FAILED",
 		               success ? "" : Stringf(" error='%s'", result.error.c_str()).c_str()));
@@ -386,9 +407,9 @@ void GenericCommandExecutor::SetRateLimitPerAgent(uint32_t maxCommandsPerSecond)
 	m_rateLimitPerAgent = maxCommandsPerSecond;
 
 	// Update existing agent states with new limit
-	for (auto& pair : m_agentRateLimits)
+	for (RateLimitState& state : m_agentRateLimits)
 	{
-		pair.second.maxTokens = maxCommandsPerSecond;
+		state.maxTokens = maxCommandsPerSecond;
 	}
 
 	DAEMON_LOG(LogCore, eLogVerbosity::Log,
@@ -400,12 +421,13 @@ void GenericCommandExecutor::SetRateLimitPerAgent(uint32_t maxCommandsPerSecond)
 //----------------------------------------------------------------------------------------------------
 RateLimitState const* GenericCommandExecutor::GetAgentRateLimitState(String const& agentId) const
 {
-	auto it = m_agentRateLimits.find(agentId);
-	if (it == m_agentRateLimits.end())
+	InternedStringID const id         = FindInternedString(agentId);
+	uint32_t const         agentIndex = m_agentRemap.Find(id);
+	if (id == INTERNED_STRING_ID_EMPTY || agentIndex >= m_agentRateLimits.size() || m_agentRateLimits[agentIndex].lastRefillTime == 0.0)
 	{
 		return nullptr;
 	}
-	return &it->second;
+	return &m_agentRateLimits[agentIndex];
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -422,11 +444,24 @@ CommandStatistics GenericCommandExecutor::GetStatistics() const
 	stats.totalUnhandled   = m_totalUnhandled;
 	stats.totalRateLimited = m_totalRateLimited;
 
-	// Per-agent breakdown (copy)
-	stats.agentStats = m_agentStats;
+	// Per-agent breakdown (copy, keyed by agent name)
+	for (uint32_t agentIndex = 0; agentIndex < m_agentStats.size(); ++agentIndex)
+	{
+		if (m_agentStats[agentIndex].submitted != 0)
+		{
+			stats.agentStats[GetInternedString(m_agentRemap.GetId(agentIndex))] = m_agentStats[agentIndex];
+		}
+	}
 
-	// Per-type breakdown (copy)
-	stats.typeStats = m_typeStats;
+	// Per-type breakdown (copy, keyed by command type name)
+	for (uint32_t typeIndex = 0; typeIndex < m_typeStats.size(); ++typeIndex)
+	{
+		CommandStatistics::TypeStats const& typeStats = m_typeStats[typeIndex];
+		if (typeStats.executed != 0 || typeStats.failed != 0)
+		{
+			stats.typeStats[GetInternedString(m_typeRemap.GetId(typeIndex))] = typeStats;
+		}
+	}
 
 	return stats;
 }
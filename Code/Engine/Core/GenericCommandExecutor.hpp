@@ -11,7 +11,15 @@
 //   - RegisterHandler / UnregisterHandler: Called from JS worker thread during initialization.
 //     Protected by std::mutex since registration is infrequent (startup only).
 //   - ExecuteCommand: Called from main render thread during ConsumeAll().
-//     Lock-free read of handler map (safe because registration completes before game loop).
+//     Lock-free read of handler table (safe because registration completes before game loop).
+//
+// Dispatch:
+//   - Command types are interned (InternedString) when a GenericCommand is constructed; the
+//     executor remaps the type IDs it registers to dense indices (InternedIdRemap) and keeps
+//     handlers in a vector by that index: two loads + one indirect call per command instead of
+//     hashing the type string, and tables sized by this executor's types, not the global intern count.
+//   - Per-agent rate limit state and per-agent / per-type statistics are likewise dense vectors
+//     behind an agent / type remap; GetStatistics() converts them back to name-keyed maps for reporting.
 //   - ExecutePendingCallbacks: Called from main render thread.
 //     Enqueues CallbackData to CallbackQueue for JS worker thread consumption.
 //
@@ -30,7 +38,9 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/GenericCommand.hpp"
+#include "Engine/Core/GenericCommandPayload.hpp"
 #include "Engine/Core/HandlerResult.hpp"
+#include "Engine/Core/InternedString.hpp"
 #include "Engine/Core/StringUtils.hpp"
 //----------------------------------------------------------------------------------------------------
 #include <any>
@@ -49,10 +59,11 @@ class CallbackQueue;
 
 //----------------------------------------------------------------------------------------------------
 // Handler function signature:
-//   Receives type-erased payload (std::any), returns structured result.
+//   Receives type-erased payload (GenericCommandPayload), returns structured result.
 //   V8 conversion happens at ScriptInterface boundary, not here.
+//   payload.Get<T>() throws std::bad_any_cast on type mismatch (caught by ExecuteCommand).
 //----------------------------------------------------------------------------------------------------
-using HandlerFunc = std::function<HandlerResult(std::any const&)>;
+using HandlerFunc = std::function<HandlerResult(GenericCommandPayload const&)>;
 
 //----------------------------------------------------------------------------------------------------
 // RateLimitState
@@ -142,8 +153,8 @@ struct CommandStatistics
 //
 // Usage:
 //   // Registration (JS worker thread, during initialization)
-//   executor.RegisterHandler("entity.create", [&entityAPI](std::any const& payload) {
-//       auto params = std::any_cast<EntityCreateParams>(payload);
+//   executor.RegisterHandler("entity.create", [&entityAPI](GenericCommandPayload const& payload) {
+//       auto const& params = payload.Get<EntityCreateParams>();
 //       auto id = entityAPI.CreateEntity(params);
 //       return HandlerResult::Success({{"entityId", std::any(id)}});
 //   });
@@ -182,6 +193,7 @@ public:
 
 	// Check if a handler is registered for the given command type.
 	bool HasHandler(String const& commandType) const;
+	bool HasHandler(InternedStringID commandTypeId) const;
 
 	// Get list of all registered command type strings.
 	std::vector<String> GetRegisteredTypes() const;
@@ -268,9 +280,22 @@ private:
 	// Data Members
 	//------------------------------------------------------------------------------------------------
 
-	// Handler registry: command type → handler function
-	std::unordered_map<String, HandlerFunc> m_handlers;
-	mutable std::mutex                      m_handlerMutex;
+	// Grow a dense table so that `index` is valid, and return that entry
+	template <typename T>
+	static T& GetOrGrow(std::vector<T>& table, uint32_t index)
+	{
+		if (index >= table.size())
+		{
+			table.resize(static_cast<size_t>(index) + 1);
+		}
+		return table[index];
+	}
+
+	// Handler registry: type index (m_typeRemap) → handler function (empty = unregistered)
+	InternedIdRemap          m_typeRemap;   // Written under m_handlerMutex during registration only
+	std::vector<HandlerFunc> m_handlers;
+	size_t                   m_handlerCount = 0;
+	mutable std::mutex       m_handlerMutex;
 
 	// Pending callback storage: callbackId → JS callback (std::any)
 	std::unordered_map<uint64_t, std::any>  m_storedCallbacks;
@@ -284,15 +309,18 @@ private:
 	uint64_t m_totalUnhandled = 0;
 	uint64_t m_totalRateLimited = 0;
 
-	// Rate limiting: agentId → token bucket state
-	std::unordered_map<String, RateLimitState> m_agentRateLimits;
+	// Agent index for the per-agent tables below (main thread only)
+	InternedIdRemap m_agentRemap;
+
+	// Rate limiting: agent index → token bucket state (lastRefillTime == 0 = agent not seen yet)
+	std::vector<RateLimitState> m_agentRateLimits;
 	uint32_t m_rateLimitPerAgent = 100; // Default: 100 commands/sec per agent (0 = disabled)
 
-	// Per-agent statistics: agentId → AgentStatistics
-	std::unordered_map<String, AgentStatistics> m_agentStats;
+	// Per-agent statistics: agent index → AgentStatistics (submitted == 0 = agent not seen yet)
+	std::vector<AgentStatistics> m_agentStats;
 
-	// Per-type statistics: command type → {executed, failed}
-	std::unordered_map<String, CommandStatistics::TypeStats> m_typeStats;
+	// Per-type statistics: type index (m_typeRemap) → {executed, failed}
+	std::vector<CommandStatistics::TypeStats> m_typeStats;
 
 	// Audit logging toggle (disabled by default)
 	bool m_auditLoggingEnabled = false;
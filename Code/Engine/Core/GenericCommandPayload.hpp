@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------------------------------
+// GenericCommandPayload.hpp
+// GenericCommand System - Small-Buffer Type-Erased Payload
+//
+// Purpose:
+//   Type-erased value carried by GenericCommand. Replaces std::any so that common payloads
+//   (JSON strings, small parameter structs) are stored inline in the command slot instead of
+//   on the heap.
+//
+// Design Rationale:
+//   - INLINE_CAPACITY bytes of in-place storage, sized for a std::string plus a few scalars.
+//     std::any's small buffer is implementation-defined (a single pointer on libstdc++), so a
+//     JSON std::string payload costs an extra heap allocation per command there.
+//   - Larger or throwing-move types fall back to one heap allocation, same as std::any
+//   - Type identity is a pointer to a per-type operations table (one compare on the hot path),
+//     with a std::type_info fallback compare
+//   - Get<T>() throws std::bad_any_cast on mismatch, so handlers migrated from
+//     std::any_cast<T>(payload) keep the executor's existing error isolation
+//
+// Usage:
+//   GenericCommandPayload payload(std::string(jsonText));
+//   std::string const& json = payload.Get<std::string>();
+//   if (EntityCreateParams const* params = payload.TryGet<EntityCreateParams>()) { ... }
+//
+// Thread Safety:
+//   - Value type with no shared state; same rules as any other member of GenericCommand
+//
+// Author: GenericCommand System - Typed Payloads
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <any>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+class GenericCommandPayload
+{
+public:
+	static constexpr size_t INLINE_CAPACITY  = 48;
+	static constexpr size_t INLINE_ALIGNMENT = alignof(std::max_align_t);
+
+	// True when T is stored inside the payload without a heap allocation
+	template <typename T>
+	static constexpr bool IS_STORED_INLINE = sizeof(T) <= INLINE_CAPACITY &&
+	                                         alignof(T) <= INLINE_ALIGNMENT &&
+	                                         std::is_nothrow_move_constructible_v<T>;
+
+	//------------------------------------------------------------------------------------------------
+	// Construction / Destruction
+	//------------------------------------------------------------------------------------------------
+	GenericCommandPayload() = default;
+
+	template <typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, GenericCommandPayload>>>
+	GenericCommandPayload(T&& value)
+	{
+		Emplace<std::decay_t<T>>(std::forward<T>(value));
+	}
+
+	GenericCommandPayload(GenericCommandPayload const& copyFrom)
+	{
+		if (copyFrom.m_ops != nullptr)
+		{
+			copyFrom.m_ops->m_copy(m_storage, copyFrom.m_storage);
+			m_ops = copyFrom.m_ops;
+		}
+	}
+
+	GenericCommandPayload(GenericCommandPayload&& moveFrom) noexcept
+	{
+		if (moveFrom.m_ops != nullptr)
+		{
+			moveFrom.m_ops->m_move(m_storage, moveFrom.m_storage);
+			m_ops = moveFrom.m_ops;
+			moveFrom.Reset();
+		}
+	}
+
+	GenericCommandPayload& operator=(GenericCommandPayload const& copyFrom)
+	{
+		if (this != &copyFrom)
+		{
+			GenericCommandPayload copy(copyFrom);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	GenericCommandPayload& operator=(GenericCommandPayload&& moveFrom) noexcept
+	{
+		if (this != &moveFrom)
+		{
+			Reset();
+			if (moveFrom.m_ops != nullptr)
+			{
+				moveFrom.m_ops->m_move(m_storage, moveFrom.m_storage);
+				m_ops = moveFrom.m_ops;
+				moveFrom.Reset();
+			}
+		}
+		return *this;
+	}
+
+	~GenericCommandPayload() { Reset(); }
+
+	//------------------------------------------------------------------------------------------------
+	// Modifiers
+	//------------------------------------------------------------------------------------------------
+	template <typename T, typename... Args>
+	T& Emplace(Args&&... args)
+	{
+		static_assert(std::is_copy_constructible_v<T>, "GenericCommandPayload requires copyable types (commands are copyable)");
+
+		Reset();
+		T* value;
+		if constexpr (IS_STORED_INLINE<T>)
+		{
+			value = ::new (static_cast<void*>(m_storage)) T(std::forward<Args>(args)...);
+		}
+		else
+		{
+			value = new T(std::forward<Args>(args)...);
+			*reinterpret_cast<T**>(m_storage) = value;
+		}
+		m_ops = &sTypedOps<T>::OPS;
+		return *value;
+	}
+
+	void Reset() noexcept
+	{
+		if (m_ops != nullptr)
+		{
+			m_ops->m_destroy(m_storage);
+			m_ops = nullptr;
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	// Queries
+	//------------------------------------------------------------------------------------------------
+	bool HasValue() const { return m_ops != nullptr; }
+
+	std::type_info const& GetType() const { return m_ops != nullptr ? *m_ops->m_type : typeid(void); }
+
+	template <typename T>
+	bool Is() const
+	{
+		return m_ops == &sTypedOps<T>::OPS || (m_ops != nullptr && *m_ops->m_type == typeid(T));
+	}
+
+	// Pointer to the stored value, nullptr if empty or a different type
+	template <typename T>
+	T const* TryGet() const
+	{
+		return Is<T>() ? static_cast<T const*>(m_ops->m_get(m_storage)) : nullptr;
+	}
+
+	template <typename T>
+	T* TryGet()
+	{
+		return Is<T>() ? static_cast<T*>(const_cast<void*>(m_ops->m_get(m_storage))) : nullptr;
+	}
+
+	// Reference to the stored value; throws std::bad_any_cast if empty or a different type
+	template <typename T>
+	T const& Get() const
+	{
+		T const* value = TryGet<T>();
+		if (value == nullptr)
+		{
+			throw std::bad_any_cast();
+		}
+		return *value;
+	}
+
+private:
+	//------------------------------------------------------------------------------------------------
+	// Per-type operations table (one static instance per stored type)
+	//------------------------------------------------------------------------------------------------
+	struct sPayloadOps
+	{
+		std::type_info const* m_type;
+		void (*m_copy)(unsigned char* destination, unsigned char const* source);
+		void (*m_move)(unsigned char* destination, unsigned char* source) noexcept;
+		void (*m_destroy)(unsigned char* storage) noexcept;
+		void const* (*m_get)(unsigned char const* storage) noexcept;
+	};
+
+	template <typename T>
+	struct sTypedOps
+	{
+		static void const* GetValue(unsigned char const* storage) noexcept
+		{
+			if constexpr (IS_STORED_INLINE<T>)
+			{
+				return std::launder(reinterpret_cast<T const*>(storage));
+			}
+			else
+			{
+				return *reinterpret_cast<T* const*>(storage);
+			}
+		}
+
+		static void Copy(unsigned char* destination, unsigned char const* source)
+		{
+			T const& value = *static_cast<T const*>(GetValue(source));
+			if constexpr (IS_STORED_INLINE<T>)
+			{
+				::new (static_cast<void*>(destination)) T(value);
+			}
+			else
+			{
+				*reinterpret_cast<T**>(destination) = new T(value);
+			}
+		}
+
+		// Heap-stored values move by pointer; the caller resets the source afterwards
+		static void Move(unsigned char* destination, unsigned char* source) noexcept
+		{
+			if constexpr (IS_STORED_INLINE<T>)
+			{
+				T* value = std::launder(reinterpret_cast<T*>(source));
+				::new (static_cast<void*>(destination)) T(std::move(*value));
+			}
+			else
+			{
+				*reinterpret_cast<T**>(destination) = *reinterpret_cast<T**>(source);
+				*reinterpret_cast<T**>(source)      = nullptr;
+			}
+		}
+
+		static void Destroy(unsigned char* storage) noexcept
+		{
+			if constexpr (IS_STORED_INLINE<T>)
+			{
+				std::launder(reinterpret_cast<T*>(storage))->~T();
+			}
+			else
+			{
+				delete *reinterpret_cast<T**>(storage);
+			}
+		}
+
+		static constexpr sPayloadOps OPS = { &typeid(T), &Copy, &Move, &Destroy, &GetValue };
+	};
+
+	alignas(INLINE_ALIGNMENT) unsigned char m_storage[INLINE_CAPACITY];
+	sPayloadOps const*                      m_ops                      = nullptr;
+};
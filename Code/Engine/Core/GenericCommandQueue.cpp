@@ -13,11 +13,11 @@
 //----------------------------------------------------------------------------------------------------
 // Constructor
 //
-// Initializes CommandQueueBase with specified capacity.
+// Initializes MPMCCommandQueueBase with specified capacity (rounded up to a power of two).
 // Logs queue initialization for monitoring.
 //----------------------------------------------------------------------------------------------------
 GenericCommandQueue::GenericCommandQueue(size_t const capacity)
-	: CommandQueueBase<GenericCommand>(capacity)
+	: MPMCCommandQueueBase<GenericCommand>(capacity)
 {
 	if (capacity == 0)
 	{
@@ -26,15 +26,15 @@ GenericCommandQueue::GenericCommandQueue(size_t const capacity)
 
 	DAEMON_LOG(LogCore, eLogVerbosity::Log,
 	           Stringf("GenericCommandQueue: Initialized with capacity %llu (%.2f KB)",
-	               static_cast<uint64_t>(capacity),
-	               (capacity * sizeof(GenericCommand)) / 1024.f));
+	               static_cast<uint64_t>(GetCapacity()),
+	               (GetCapacity() * sizeof(GenericCommand)) / 1024.f));
 }
 
 //----------------------------------------------------------------------------------------------------
 // Destructor
 //
 // Logs final statistics for debugging/profiling.
-// Base class (CommandQueueBase) handles buffer deallocation.
+// Base class (MPMCCommandQueueBase) handles buffer deallocation.
 //----------------------------------------------------------------------------------------------------
 GenericCommandQueue::~GenericCommandQueue()
 {
@@ -51,7 +51,7 @@ GenericCommandQueue::~GenericCommandQueue()
 //----------------------------------------------------------------------------------------------------
 // OnQueueFull (Virtual Hook Override)
 //
-// Called by CommandQueueBase::Submit() when queue is full.
+// Called by MPMCCommandQueueBase::Submit() / SubmitBatch() when queue is full.
 // Logs warning for monitoring/debugging.
 //----------------------------------------------------------------------------------------------------
 void GenericCommandQueue::OnQueueFull()
@@ -3,26 +3,27 @@
 // GenericCommand System - Command Queue
 //
 // Purpose:
-//   Thread-safe, lock-free Single-Producer-Single-Consumer (SPSC) ring buffer for
-//   JavaScript worker thread → Main render thread GenericCommand transport.
-//   Inherits from CommandQueueBase<GenericCommand> template.
+//   Thread-safe, lock-free Multi-Producer-Multi-Consumer (MPMC) ring buffer for
+//   JavaScript worker / KADI websocket / resource job → Main render thread GenericCommand transport.
+//   Inherits from MPMCCommandQueueBase<GenericCommand> template.
 //
 // Design Rationale:
-//   - Inherits SPSC implementation from CommandQueueBase (template does heavy lifting)
+//   - Several producer threads feed this queue, so it uses the MPMC base rather than the SPSC
+//     CommandQueueBase that RenderCommandQueue and CallbackQueue use
 //   - Adds OnQueueFull() logging for backpressure monitoring
-//   - Follows exact same pattern as RenderCommandQueue and CallbackQueue
+//   - Submit(GenericCommand&&) / SubmitBatch() move commands in (no std::any / string copies)
 //
 // Thread Safety Model:
-//   - Producer (JS Worker): Calls Submit() to enqueue GenericCommands
+//   - Producers (any thread): Call Submit() / SubmitBatch() to enqueue GenericCommands
 //   - Consumer (Main Thread): Calls ConsumeAll() to process GenericCommands
-//   - Inherited from CommandQueueBase: Cache-line separated atomic indices
+//   - Inherited from MPMCCommandQueueBase: Per-cell sequence numbers, cache-line separated positions
 //
 // Performance Characteristics:
 //   - Submission: O(1), lock-free
 //   - Consumption: O(n) where n = commands per frame
 //   - Memory: Fixed ~44 KB (500 commands × ~88 bytes per GenericCommand)
 //
-// Capacity Choice (500):
+// Capacity Choice (500, rounded up to 512 by the MPMC base):
 //   - Between RenderCommandQueue (1000) and CallbackQueue (100)
 //   - GenericCommand is larger than RenderCommand (std::any overhead)
 //   - 500 commands at 60 FPS = ~30,000 commands/sec throughput ceiling
@@ -35,20 +36,20 @@
 #pragma once
 
 //----------------------------------------------------------------------------------------------------
-#include "Engine/Core/CommandQueueBase.hpp"
+#include "Engine/Core/MPMCCommandQueueBase.hpp"
 #include "Engine/Core/GenericCommand.hpp"
 
 //----------------------------------------------------------------------------------------------------
 // GenericCommandQueue
 //
-// Lock-free SPSC ring buffer for asynchronous GenericCommand delivery.
-// Inherits core SPSC implementation from CommandQueueBase<GenericCommand>.
+// Lock-free MPMC ring buffer for asynchronous GenericCommand delivery.
+// Inherits core MPMC implementation from MPMCCommandQueueBase<GenericCommand>.
 //
 // Usage Pattern:
 //
 // Producer (JavaScript Worker Thread via GenericCommandScriptInterface):
-//   GenericCommand cmd("entity.create", payload, "agent-1", callbackId, callback);
-//   bool submitted = queue->Submit(cmd);
+//   GenericCommand cmd(entityCreateTypeId, payload, agentId, callbackId);
+//   bool submitted = queue->Submit(std::move(cmd));
 //   if (!submitted) {
 //       // Queue full - backpressure triggered
 //       // Return false to JavaScript
@@ -59,13 +60,13 @@
 //       executor.ExecuteCommand(cmd);
 //   });
 //----------------------------------------------------------------------------------------------------
-class GenericCommandQueue : public CommandQueueBase<GenericCommand>
+class GenericCommandQueue : public MPMCCommandQueueBase<GenericCommand>
 {
 public:
 	//------------------------------------------------------------------------------------------------
 	// Constants
 	//------------------------------------------------------------------------------------------------
-	static constexpr size_t DEFAULT_CAPACITY = 500;   // 500 commands ≈ 44 KB
+	static constexpr size_t DEFAULT_CAPACITY = 500;   // Rounded up to 512 commands
 
 	//------------------------------------------------------------------------------------------------
 	// Construction / Destruction
@@ -80,9 +81,12 @@ public:
 	GenericCommandQueue& operator=(GenericCommandQueue&&)      = delete;
 
 	//------------------------------------------------------------------------------------------------
-	// Public API (inherited from CommandQueueBase)
+	// Public API (inherited from MPMCCommandQueueBase)
 	//------------------------------------------------------------------------------------------------
 	// bool Submit(GenericCommand const& command);
+	// bool Submit(GenericCommand&& command);
+	// size_t SubmitBatch(GenericCommand* commands, size_t count);
+	// size_t ConsumeBatch(GenericCommand* out_commands, size_t maxCount);
 	// template <typename ProcessorFunc> void ConsumeAll(ProcessorFunc&& processor);
 	// size_t GetApproximateSize() const;
 	// size_t GetCapacity() const;
@@ -93,7 +97,7 @@ public:
 
 protected:
 	//------------------------------------------------------------------------------------------------
-	// Virtual Hooks (Override from CommandQueueBase)
+	// Virtual Hooks (Override from MPMCCommandQueueBase)
 	//------------------------------------------------------------------------------------------------
 	// Called when queue is full during Submit()
 	void OnQueueFull() override;
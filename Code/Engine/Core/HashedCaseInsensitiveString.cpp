@@ -117,15 +117,14 @@ void HashedCaseInsensitiveString::operator=(std::string const& text)
 }
 
 //----------------------------------------------------------------------------------------------------
-unsigned int HashedCaseInsensitiveString::CalcHashForText(char const* text)
+unsigned int HashedCaseInsensitiveString::CalcHashForText(std::string_view const text)
 {
     unsigned int hash = 0;
 
-    while (*text)
+    for (char const c : text)
     {
         hash *= 31;
-        hash += static_cast<unsigned int>(tolower(*text));
-        ++text;
+        hash += static_cast<unsigned int>(tolower(static_cast<unsigned char>(c)));
     }
 
     return hash;
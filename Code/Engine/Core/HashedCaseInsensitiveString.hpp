@@ -5,6 +5,7 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 #include <string>
+#include <string_view>
 
 //----------------------------------------------------------------------------------------------------
 class HashedCaseInsensitiveString
@@ -34,9 +35,10 @@ public:
     void operator=(char const* text);
     void operator=(std::string const& text);
 
-private:
-    static unsigned int CalcHashForText(char const* text);
+    // Hash of the lower-case text; lets other containers key on it without constructing one of these
+    static unsigned int CalcHashForText(std::string_view text);
 
+private:
     std::string  m_caseIntactText;
     unsigned int m_lowerCaseHash = 0;
 };
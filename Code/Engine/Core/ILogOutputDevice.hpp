@@ -5,11 +5,24 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 
+#include <cstddef>
+#include <span>
+
 //----------------------------------------------------------------------------------------------------
 // Forward declarations
 //----------------------------------------------------------------------------------------------------
 struct LogEntry;
 
+//----------------------------------------------------------------------------------------------------
+// When buffered devices (FileOutputDevice, SmartFileOutputDevice) hand their write buffer to the OS
+//----------------------------------------------------------------------------------------------------
+struct sLogFlushPolicy
+{
+	size_t flushBytes      = 256 * 1024;   // Write out once the buffer holds this much (0 = after every batch)
+	int    flushIntervalMs = 100;          // ...or once the oldest buffered line is this old
+	bool   flushOnError    = true;         // ...or right after a batch containing an Error / Fatal entry
+};
+
 //----------------------------------------------------------------------------------------------------
 // Log output device interface (similar to UE's FOutputDevice)
 //----------------------------------------------------------------------------------------------------
@@ -19,6 +32,16 @@ public:
 	virtual      ~ILogOutputDevice() = default;
 	virtual void WriteLog(const LogEntry& entry) = 0;
 
+	// One drain pass of the log thread, in timestamp order. Devices with per-write cost (locks,
+	// syscalls) override this; the default forwards to WriteLog().
+	virtual void WriteLogBatch(std::span<LogEntry const* const> entries)
+	{
+		for (LogEntry const* entry : entries)
+		{
+			WriteLog(*entry);
+		}
+	}
+
 	virtual void Flush()
 	{
 	}
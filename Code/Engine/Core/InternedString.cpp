@@ -0,0 +1,102 @@
+//----------------------------------------------------------------------------------------------------
+// InternedString.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/InternedString.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Keys are views into m_strings; std::deque never relocates elements on push_back
+    //------------------------------------------------------------------------------------------------
+    struct sInternedStringTable
+    {
+        sInternedStringTable()
+        {
+            m_strings.emplace_back();
+            m_idsByText.emplace(std::string_view(m_strings.back()), INTERNED_STRING_ID_EMPTY);
+        }
+
+        std::shared_mutex                                      m_mutex;
+        std::deque<std::string>                                m_strings;
+        std::unordered_map<std::string_view, InternedStringID> m_idsByText;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Function-local static: safe to use from other static initializers
+    //------------------------------------------------------------------------------------------------
+    sInternedStringTable& GetTable()
+    {
+        static sInternedStringTable s_table;
+        return s_table;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InternedStringID InternString(std::string_view const text)
+{
+    sInternedStringTable& table = GetTable();
+
+    {
+        std::shared_lock lock(table.m_mutex);
+        auto const        found = table.m_idsByText.find(text);
+        if (found != table.m_idsByText.end())
+        {
+            return found->second;
+        }
+    }
+
+    std::unique_lock lock(table.m_mutex);
+
+    // Another thread may have inserted it between the two locks
+    auto const found = table.m_idsByText.find(text);
+    if (found != table.m_idsByText.end())
+    {
+        return found->second;
+    }
+
+    InternedStringID const id = static_cast<InternedStringID>(table.m_strings.size());
+    table.m_strings.emplace_back(text);
+    table.m_idsByText.emplace(std::string_view(table.m_strings.back()), id);
+    return id;
+}
+
+//----------------------------------------------------------------------------------------------------
+InternedStringID FindInternedString(std::string_view const text)
+{
+    sInternedStringTable& table = GetTable();
+    std::shared_lock      lock(table.m_mutex);
+
+    auto const found = table.m_idsByText.find(text);
+    return found != table.m_idsByText.end() ? found->second : INTERNED_STRING_ID_EMPTY;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string const& GetInternedString(InternedStringID const id)
+{
+    sInternedStringTable& table = GetTable();
+    std::shared_lock      lock(table.m_mutex);
+
+    if (id >= table.m_strings.size())
+    {
+        return table.m_strings.front();
+    }
+
+    return table.m_strings[id];
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t GetInternedStringCount()
+{
+    sInternedStringTable& table = GetTable();
+    std::shared_lock      lock(table.m_mutex);
+
+    return static_cast<uint32_t>(table.m_strings.size());
+}
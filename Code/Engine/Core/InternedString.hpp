@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------------------------------
+// InternedString.hpp
+// Engine Core Module - Process-Wide String Interning
+//
+// Purpose:
+//   Map short, frequently repeated strings ("cube", "world", event names, command types) to small
+//   integer IDs so hot paths can store and compare a uint32_t instead of a std::string.
+//
+// Design Rationale:
+//   - IDs are dense and never reused; the table only grows (interned strings live until exit)
+//   - ID 0 is always the empty string, so a zero-initialized ID is valid and cheap to test
+//   - Stored strings never move, so GetInternedString() references stay valid forever
+//   - Interning is case-sensitive (callers wanting case folding should normalize first)
+//
+// Thread Safety Model:
+//   - All functions are safe from any thread (shared lock for lookups, exclusive lock for inserts)
+//   - Intern once at load/creation time; per-frame code should only pass IDs around
+//   - InternedIdRemap has no locking of its own; its owner serializes access
+//
+// Author: Entity State SoA Storage
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+using InternedStringID = uint32_t;
+
+InternedStringID constexpr INTERNED_STRING_ID_EMPTY = 0;    // ID of "" (always present)
+
+//----------------------------------------------------------------------------------------------------
+// Return the ID for text, adding it to the table on first use
+InternedStringID InternString(std::string_view text);
+
+// Return the ID for text if it has been interned, INTERNED_STRING_ID_EMPTY otherwise (never inserts)
+InternedStringID FindInternedString(std::string_view text);
+
+// Return the text for id (empty string for unknown IDs); the reference stays valid until exit
+std::string const& GetInternedString(InternedStringID id);
+
+// Number of distinct strings interned so far, including the empty string
+uint32_t GetInternedStringCount();
+
+//----------------------------------------------------------------------------------------------------
+// Per-owner dense numbering of interned IDs. IDs are process-wide, so a table indexed by ID directly
+// grows with every string anyone interns; an owner instead remaps the IDs it actually uses to
+// 0, 1, 2, ... and sizes its payload tables by that count. The remap itself costs 4 bytes per
+// global ID up to the largest one seen, and Find() stays a bounds check + one load.
+//----------------------------------------------------------------------------------------------------
+class InternedIdRemap
+{
+public:
+    static uint32_t constexpr INVALID_INDEX = UINT32_MAX;
+
+    // Dense index of id, or INVALID_INDEX if this owner has not added it
+    uint32_t Find(InternedStringID const id) const
+    {
+        return id < m_indexPlusOneById.size() ? m_indexPlusOneById[id] - 1 : INVALID_INDEX;
+    }
+
+    // Dense index of id, assigning the next one on first use
+    uint32_t FindOrAdd(InternedStringID const id)
+    {
+        if (id >= m_indexPlusOneById.size())
+        {
+            m_indexPlusOneById.resize(static_cast<size_t>(id) + 1, 0);
+        }
+
+        uint32_t& indexPlusOne = m_indexPlusOneById[id];
+        if (indexPlusOne == 0)
+        {
+            m_idByIndex.push_back(id);
+            indexPlusOne = static_cast<uint32_t>(m_idByIndex.size());
+        }
+        return indexPlusOne - 1;
+    }
+
+    InternedStringID GetId(uint32_t const index) const { return m_idByIndex[index]; }
+    uint32_t         GetCount() const { return static_cast<uint32_t>(m_idByIndex.size()); }
+
+private:
+    std::vector<uint32_t>         m_indexPlusOneById;   // By InternedStringID; 0 = not added
+    std::vector<InternedStringID> m_idByIndex;          // By dense index
+};
@@ -4,6 +4,8 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/Job.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------
 // Job implementation
@@ -16,9 +18,11 @@
 // Note: The virtual destructor is defaulted in the header file,
 // so no implementation is needed here.
 //----------------------------------------------------------------------------------------------------
-Job::Job(JobType const jobType)
+Job::Job(JobType const jobType,
+         int const     priority)
     : m_jobType(jobType)
 {
+    SetPriority(priority);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -26,3 +30,54 @@ JobType Job::GetJobType() const
 {
     return m_jobType;
 }
+
+//----------------------------------------------------------------------------------------------------
+void Job::SetPriority(int const priority)
+{
+    m_priority = std::clamp(priority, JOB_PRIORITY_MIN, JOB_PRIORITY_MAX);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Job::AddDependency(Job* parent)
+{
+    if (parent == nullptr || parent == this)
+    {
+        return;
+    }
+
+    std::scoped_lock lock(parent->m_continuationMutex);
+
+    // Parent already done - nothing to wait for
+    if (parent->m_isFinished)
+    {
+        return;
+    }
+
+    m_unfinishedDependencyCount.fetch_add(1, std::memory_order_relaxed);
+    parent->m_continuations.push_back(this);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Job::IsFinished() const
+{
+    std::scoped_lock lock(m_continuationMutex);
+
+    return m_isFinished;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Job::ReleaseDependency()
+{
+    // acq_rel: the last releaser must observe every parent's writes before the child runs
+    return m_unfinishedDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<Job*> Job::MarkFinishedAndTakeContinuations()
+{
+    std::scoped_lock lock(m_continuationMutex);
+
+    m_isFinished = true;
+
+    return std::move(m_continuations);
+}
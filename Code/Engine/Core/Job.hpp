@@ -5,7 +5,14 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class JobGraph;
+class JobSystem;
 
 //----------------------------------------------------------------------------------------------------
 // Job type bitfield - allows categorizing jobs for worker thread specialization
@@ -19,6 +26,25 @@ JobType constexpr JOB_TYPE_GENERIC = 0x01;  // General computation jobs (terrain
 JobType constexpr JOB_TYPE_IO      = 0x02;  // File I/O jobs (load/save chunks)
 JobType constexpr JOB_TYPE_ALL     = 0xFF;  // Worker accepts any job type
 
+//----------------------------------------------------------------------------------------------------
+// Job priority - same scale as sResourceCommand payloads (higher = earlier)
+// JobSystem groups priorities into JOB_PRIORITY_LANE_COUNT lanes, each FIFO internally
+//----------------------------------------------------------------------------------------------------
+int constexpr JOB_PRIORITY_MIN        = -100;  // Pre-cached / optional content
+int constexpr JOB_PRIORITY_NORMAL     = 0;     // Default
+int constexpr JOB_PRIORITY_MAX        = 100;   // Critical (loading screens, fonts)
+int constexpr JOB_PRIORITY_LANE_COUNT = 5;     // [-100,-61] [-60,-21] [-20,19] [20,59] [60,100]
+
+// 201 priority values spread over the lanes in 40-wide bands; 100 folds into the top lane (0 = lowest)
+constexpr int GetJobPriorityLane(int const priority)
+{
+    int const lane = (priority - JOB_PRIORITY_MIN) / 40;
+
+    return lane < JOB_PRIORITY_LANE_COUNT ? lane : JOB_PRIORITY_LANE_COUNT - 1;
+}
+
+int constexpr JOB_PRIORITY_NORMAL_LANE = GetJobPriorityLane(JOB_PRIORITY_NORMAL);
+
 //----------------------------------------------------------------------------------------------------
 // Job - Abstract base class for all job types in the JobSystem
 //
@@ -32,6 +58,13 @@ JobType constexpr JOB_TYPE_ALL     = 0xFF;  // Worker accepts any job type
 //   3. JobSystem will move job through queued -> executing -> completed states
 //   4. Retrieve completed job from JobSystem and delete it
 //
+// Dependencies:
+//   - AddDependency(parent) makes this job wait until parent has finished executing
+//   - A job submitted with unfinished parents is parked (not queued); the worker that finishes the
+//     last parent queues it directly, with no main-thread round trip
+//   - Dependencies must be added before this job is submitted; the parent may already be running
+//   - Jobs owned by a JobGraph are deleted by the graph and never reach the completed queue
+//
 // Thread Safety:
 //   - Job creation: Main thread only
 //   - Job execution: Worker threads only (via Execute() method)
@@ -40,8 +73,8 @@ JobType constexpr JOB_TYPE_ALL     = 0xFF;  // Worker accepts any job type
 class Job
 {
 public:
-    // Constructor: Allows derived classes to specify job type
-    explicit Job(JobType jobType = JOB_TYPE_GENERIC);
+    // Constructor: Allows derived classes to specify job type and priority
+    explicit Job(JobType jobType = JOB_TYPE_GENERIC, int priority = JOB_PRIORITY_NORMAL);
 
     // Virtual destructor ensures proper cleanup of derived classes
     virtual ~Job() = default;
@@ -54,6 +87,28 @@ public:
     // Get the job type (used by workers to filter claimable jobs)
     JobType GetJobType() const;
 
+    // Priority in [JOB_PRIORITY_MIN, JOB_PRIORITY_MAX]; must be set before submission
+    int  GetPriority() const { return m_priority; }
+    void SetPriority(int priority);
+
+    // Lane index in [0, JOB_PRIORITY_LANE_COUNT), 0 = lowest
+    int GetPriorityLane() const { return GetJobPriorityLane(m_priority); }
+
+    // Make this job wait for parent to finish (call before this job is submitted)
+    // Has no effect if parent has already finished
+    void AddDependency(Job* parent);
+
+    // True once Execute() has returned (or JobSystem::Shutdown() cancelled the job) and continuations have been released
+    bool IsFinished() const;
+
+    // Graph that owns this job (nullptr for standalone jobs)
+    JobGraph* GetJobGraph() const { return m_jobGraph; }
+
+    // Fire-and-forget: JobSystem deletes the job after Execute() instead of queuing it for retrieval
+    // (set before submission; ignored for graph-owned jobs)
+    void SetDeleteOnCompletion(bool deleteOnCompletion) { m_isDeletedOnCompletion = deleteOnCompletion; }
+    bool IsDeletedOnCompletion() const { return m_isDeletedOnCompletion; }
+
     // Prevent copying and assignment (jobs should be unique)
     Job(Job const&)            = delete;
     Job& operator=(Job const&) = delete;
@@ -61,6 +116,32 @@ public:
     Job& operator=(Job&&)      = delete;
 
 private:
+    friend class JobGraph;
+    friend class JobSystem;
+
+    // Consume one dependency (parent finish or the submit token); true when the job became ready
+    bool ReleaseDependency();
+
+    // Mark finished and hand back the jobs waiting on this one (called once by JobSystem)
+    std::vector<Job*> MarkFinishedAndTakeContinuations();
+
     // Job type determines which workers can claim this job
     JobType m_jobType = JOB_TYPE_GENERIC;
+
+    // Higher priority jobs are claimed first (clamped to [JOB_PRIORITY_MIN, JOB_PRIORITY_MAX])
+    int m_priority = JOB_PRIORITY_NORMAL;
+
+    // Unfinished parents + 1 submit token; the job is queued when this reaches zero
+    std::atomic<int> m_unfinishedDependencyCount = 1;
+
+    // Jobs waiting on this one, released when it finishes
+    mutable std::mutex m_continuationMutex;
+    std::vector<Job*>  m_continuations;
+    bool               m_isFinished = false;
+
+    // Owning graph (set by JobGraph::AddJob)
+    JobGraph* m_jobGraph = nullptr;
+
+    // Deleted by JobSystem once finished (never reaches the completed queue)
+    bool m_isDeletedOnCompletion = false;
 };
@@ -0,0 +1,145 @@
+//----------------------------------------------------------------------------------------------------
+// JobGraph.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/JobGraph.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+JobGraph::JobGraph(JobSystem* jobSystem)
+    : m_jobSystem(jobSystem)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+JobGraph::~JobGraph()
+{
+    // Workers may still reference jobs (and this graph) until the last one reports in
+    Wait();
+
+    for (Job const* job : m_jobs)
+    {
+        delete job;
+    }
+
+    m_jobs.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+Job* JobGraph::AddJob(Job* job, std::initializer_list<Job*> parents)
+{
+    if (job == nullptr || m_isSubmitted)
+    {
+        return nullptr;
+    }
+
+    job->m_jobGraph = this;
+    m_jobs.push_back(job);
+
+    for (Job* parent : parents)
+    {
+        AddDependency(job, parent);
+    }
+
+    return job;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobGraph::AddDependency(Job* child, Job* parent)
+{
+    if (m_isSubmitted || child == nullptr || parent == nullptr)
+    {
+        return;
+    }
+
+    // Edges leaving the graph would let a child outlive or precede its owner's bookkeeping
+    if (child->m_jobGraph != this || parent->m_jobGraph != this)
+    {
+        DAEMON_LOG(LogCore, eLogVerbosity::Warning, StringFormat("JobGraph::AddDependency: both jobs must belong to this graph, edge ignored"));
+        return;
+    }
+
+    child->AddDependency(parent);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobGraph::Submit()
+{
+    if (m_isSubmitted)
+    {
+        return false;
+    }
+
+    if (m_jobSystem == nullptr || !m_jobSystem->IsRunning())
+    {
+        DAEMON_LOG(LogCore, eLogVerbosity::Error, StringFormat("JobGraph::Submit: JobSystem is not running, {} jobs not submitted", m_jobs.size()));
+        return false;
+    }
+
+    m_remainingJobCount.store(static_cast<int>(m_jobs.size()), std::memory_order_release);
+    m_isSubmitted = true;
+
+    // Every job consumes its submit token; only jobs without unfinished parents are queued now.
+    // The graph cannot complete before this loop ends because each job still holds its own token.
+    for (Job* job : m_jobs)
+    {
+        m_jobSystem->SubmitJob(job);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobGraph::IsComplete() const
+{
+    return m_isSubmitted && m_remainingJobCount.load(std::memory_order_acquire) == 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobGraph::Wait()
+{
+    if (!m_isSubmitted)
+    {
+        return;
+    }
+
+    std::unique_lock lock(m_completionMutex);
+    m_completionCondition.wait(lock, [this] { return m_remainingJobCount.load(std::memory_order_acquire) == 0; });
+}
+
+//----------------------------------------------------------------------------------------------------
+int JobGraph::GetCompletedJobCount() const
+{
+    if (!m_isSubmitted)
+    {
+        return 0;
+    }
+
+    return GetJobCount() - m_remainingJobCount.load(std::memory_order_acquire);
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobGraph::OnJobFinished()
+{
+    // Decrement and notify under the lock: once the count hits zero the owner may destroy this graph,
+    // and Wait() cannot return before we release m_completionMutex
+    std::scoped_lock lock(m_completionMutex);
+
+    if (m_remainingJobCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        m_completionCondition.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobGraph::OnJobCancelled()
+{
+    // Counted before the job reports in: the owner may read it (or destroy the graph) once Wait() returns
+    m_cancelledJobCount.fetch_add(1, std::memory_order_release);
+    OnJobFinished();
+}
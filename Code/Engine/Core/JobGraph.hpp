@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// JobGraph.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Job;
+class JobSystem;
+
+//----------------------------------------------------------------------------------------------------
+// JobGraph - Owning, waitable group of jobs connected by dependencies
+//
+// A graph collects jobs and their parent -> child edges, then submits them all at once. Jobs with
+// no unfinished parents start immediately; each remaining job is queued by the worker thread that
+// finishes its last parent. Nothing in the graph touches the main thread until the whole graph is
+// done, so a load -> decode -> build pipeline costs no extra frames of latency.
+//
+// Usage:
+//   JobGraph graph(g_jobSystem);
+//   Job* load   = graph.AddJob(new LoadFileJob(path));
+//   Job* decode = graph.AddJob(new DecodeJob(...), { load });
+//   Job* build  = graph.AddJob(new BuildMeshJob(...), { decode });
+//   graph.Submit();
+//   ...
+//   if (graph.IsComplete()) { /* poll */ }   or   graph.Wait();   // block
+//
+// Ownership:
+//   - The graph owns every job added to it and deletes them in its destructor
+//   - Graph jobs never appear in JobSystem::RetrieveCompletedJob()
+//   - The destructor waits for any submitted jobs that are still running
+//   - JobSystem::Shutdown() cancels graph jobs that have not run yet; they count as finished (see
+//     GetCancelledJobCount()), so Wait() and the destructor never block on a stopped JobSystem
+//
+// Thread Safety:
+//   - AddJob / AddDependency / Submit / Wait: Owner thread only
+//   - IsComplete / GetCompletedJobCount: Any thread
+//----------------------------------------------------------------------------------------------------
+class JobGraph
+{
+public:
+    explicit JobGraph(JobSystem* jobSystem);
+    ~JobGraph();
+
+    JobGraph(JobGraph const&)            = delete;
+    JobGraph& operator=(JobGraph const&) = delete;
+    JobGraph(JobGraph&&)                 = delete;
+    JobGraph& operator=(JobGraph&&)      = delete;
+
+    // Take ownership of job and make it depend on every job in parents (parents must be in this graph)
+    // Returns job for chaining; must be called before Submit()
+    Job* AddJob(Job* job, std::initializer_list<Job*> parents = {});
+
+    // Add a parent -> child edge between two jobs already in this graph (before Submit())
+    void AddDependency(Job* child, Job* parent);
+
+    // Hand all jobs to the JobSystem. Returns false if the JobSystem is unavailable or already submitted.
+    bool Submit();
+
+    // Non-blocking: true once every job in a submitted graph has finished or been cancelled
+    bool IsComplete() const;
+
+    // Block the calling thread until every job has finished or been cancelled (returns immediately if never submitted)
+    void Wait();
+
+    int GetJobCount() const { return static_cast<int>(m_jobs.size()); }
+    int GetCompletedJobCount() const;
+    int GetCancelledJobCount() const { return m_cancelledJobCount.load(std::memory_order_acquire); }    // Never ran (JobSystem shut down)
+
+private:
+    friend class JobSystem;
+
+    // Called by JobSystem::FinishJob on the worker thread that finished a graph job
+    void OnJobFinished();
+
+    // Called by JobSystem::Shutdown for a graph job that will never run
+    void OnJobCancelled();
+
+    JobSystem*        m_jobSystem = nullptr;
+    std::vector<Job*> m_jobs;
+    bool              m_isSubmitted = false;
+
+    // Completion tracking (decremented under m_completionMutex so Wait() never races destruction)
+    std::atomic<int>        m_remainingJobCount = 0;
+    std::atomic<int>        m_cancelledJobCount = 0;
+    mutable std::mutex      m_completionMutex;
+    std::condition_variable m_completionCondition;
+};
@@ -6,6 +6,7 @@
 #include "Engine/Core/JobSystem.hpp"
 #include "Engine/Core/JobWorkerThread.hpp"
 #include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobGraph.hpp"
 #include <algorithm>
 #include <thread>
 
@@ -17,6 +18,39 @@
 //----------------------------------------------------------------------------------------------------
 // JobSystem* g_jobSystem = nullptr;  // Created and owned by App
 
+//----------------------------------------------------------------------------------------------------
+// Worker identity of the calling thread (set once per worker in JobWorkerThread::ThreadMain)
+// Lets SubmitJob() route jobs spawned inside Execute() to the spawning worker's own deque
+//----------------------------------------------------------------------------------------------------
+static thread_local JobSystem* s_currentJobSystem = nullptr;
+static thread_local int        s_currentWorkerID  = -1;
+static thread_local uint32_t   s_stealRandomState = 0;
+static thread_local int        s_claimsSinceLaneService = 0;
+
+//----------------------------------------------------------------------------------------------------
+// Jobs owned by a JobGraph are deleted by the graph, never by the JobSystem
+//----------------------------------------------------------------------------------------------------
+static void DeleteUnownedJob(Job const* job)
+{
+    if (job->GetJobGraph() == nullptr)
+    {
+        delete job;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Xorshift32 - cheap per-thread victim selection for work stealing
+//----------------------------------------------------------------------------------------------------
+static uint32_t NextStealRandom()
+{
+    uint32_t x = s_stealRandomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_stealRandomState = x;
+    return x;
+}
+
 //----------------------------------------------------------------------------------------------------
 // JobSystem Implementation
 //----------------------------------------------------------------------------------------------------
@@ -71,6 +105,22 @@ void JobSystem::Startup()
     // Reserve space for all worker threads
     m_workerThreads.reserve(totalThreads);
 
+    // Work-stealing queues must exist before any worker starts (workers steal from each other immediately)
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        size_t const dequeCapacity = static_cast<size_t>(std::max(m_config.m_workerDequeCapacity, 2));
+
+        m_workerQueues.reserve(totalThreads);
+
+        for (int i = 0; i < totalThreads; ++i)
+        {
+            auto workerQueue          = std::make_unique<sWorkerQueue>(dequeCapacity);
+            workerQueue->m_workerType = (i < m_config.m_ioThreadNum) ? JOB_TYPE_IO : JOB_TYPE_GENERIC;
+            m_workerTypeMask |= workerQueue->m_workerType;
+            m_workerQueues.push_back(std::move(workerQueue));
+        }
+    }
+
     // Create I/O worker threads first (dedicated to file operations)
     for (int i = 0; i < m_config.m_ioThreadNum; ++i)
     {
@@ -103,6 +153,7 @@ void JobSystem::Shutdown()
     // 1. Set m_shouldStop flag on ALL workers first (without joining)
     // 2. Wake up all sleeping workers with notify_all()
     // 3. Wait for all workers to exit with join()
+    // 4. Cancel every job that never ran, so JobGraph::Wait() cannot block on them forever
 
     // Step 1: Signal all worker threads to stop (sets m_shouldStop = true)
     for (auto& workerThread : m_workerThreads)
@@ -115,7 +166,7 @@ void JobSystem::Shutdown()
 
     // Step 2: Wake up all sleeping worker threads now that m_shouldStop is set
     // They will check the predicate, see m_shouldStop == true, and exit
-    m_jobAvailableCondition.notify_all();
+    NotifyAllWorkers(JOB_TYPE_ALL);
 
     // Step 3: Wait for all worker threads to finish
     for (auto& workerThread : m_workerThreads)
@@ -129,33 +180,105 @@ void JobSystem::Shutdown()
     // Clear the worker thread vector
     m_workerThreads.clear();
 
-    // Clean up any remaining jobs in the queues
-    {
-        std::lock_guard<std::mutex> lock(m_jobQueuesMutex);
+    // Jobs that will never run now: queued ones are collected here and parked ones are reached through
+    // their parents' continuations in CancelUnfinishedJobs()
+    std::vector<Job*> unfinishedJobs;
 
-        // Delete any jobs still in queues (client should have retrieved completed jobs)
-        for (Job* job : m_queuedJobs)
+    // Collect any jobs left in work-stealing queues (workers are joined, so owner-only pops are safe here)
+    for (auto& workerQueue : m_workerQueues)
+    {
+        Job* job = nullptr;
+        while (workerQueue->m_deque.PopBottom(job))
         {
-            delete job;
+            unfinishedJobs.push_back(job);
         }
-        for (Job* job : m_executingJobs)
+        for (Job* inboxJob : workerQueue->m_inbox)
         {
-            delete job;
+            unfinishedJobs.push_back(inboxJob);
         }
+        workerQueue->m_inbox.clear();
+    }
+    m_workerQueues.clear();
+    m_workerTypeMask = 0;
+    m_queuedJobCount.store(0);
+    m_queuedGenericJobCount.store(0);
+    m_queuedIOJobCount.store(0);
+    m_executingJobCount.store(0);
+    m_unclaimableJobCount.store(0);
+    m_urgentLaneJobCount.store(0);
+    m_deferredLaneJobCount.store(0);
+
+    // Clean up any remaining jobs in the queues
+    {
+        std::scoped_lock lock(m_jobQueuesMutex, m_completedJobsMutex);
+
+        for (auto& lane : m_queuedJobLanes)
+        {
+            for (sQueuedJob const& queuedJob : lane)
+            {
+                unfinishedJobs.push_back(queuedJob.m_job);
+            }
+            lane.clear();
+        }
+        unfinishedJobs.insert(unfinishedJobs.end(), m_unclaimableJobs.begin(), m_unclaimableJobs.end());
+        unfinishedJobs.insert(unfinishedJobs.end(), m_executingJobs.begin(), m_executingJobs.end());
+
+        // Delete completed jobs the client never retrieved (graph-owned jobs never get here)
         for (Job* job : m_completedJobs)
         {
-            delete job;
+            DeleteUnownedJob(job);
         }
 
         // Clear all queues
-        m_queuedJobs.clear();
+        m_unclaimableJobs.clear();
         m_executingJobs.clear();
         m_completedJobs.clear();
     }
 
+    // After the queues are empty: a graph may be destroyed (with its jobs) as soon as its last job reports in
+    CancelUnfinishedJobs(std::move(unfinishedJobs));
+
     m_isRunning = false;
 }
 
+//----------------------------------------------------------------------------------------------------
+// Settle jobs that will never run the way FinishJob() settles finished ones: release continuations
+// (cancelling each child that becomes ready), report graph-owned jobs to their JobGraph so its Wait()
+// returns, and delete the rest. A worklist rather than recursion, since chains can be long.
+//----------------------------------------------------------------------------------------------------
+void JobSystem::CancelUnfinishedJobs(std::vector<Job*> jobs)
+{
+    int cancelledGraphJobCount = 0;
+
+    while (!jobs.empty())
+    {
+        Job* const job = jobs.back();
+        jobs.pop_back();
+
+        for (Job* continuation : job->MarkFinishedAndTakeContinuations())
+        {
+            if (continuation->ReleaseDependency())
+            {
+                jobs.push_back(continuation);
+            }
+        }
+
+        if (JobGraph* jobGraph = job->GetJobGraph())
+        {
+            ++cancelledGraphJobCount;
+            jobGraph->OnJobCancelled();
+            continue;
+        }
+
+        delete job;
+    }
+
+    if (cancelledGraphJobCount > 0)
+    {
+        DAEMON_LOG(LogCore, eLogVerbosity::Warning, StringFormat("JobSystem::Shutdown: {} unfinished JobGraph jobs cancelled", cancelledGraphJobCount));
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void JobSystem::SubmitJob(Job* job)
 {
@@ -164,15 +287,87 @@ void JobSystem::SubmitJob(Job* job)
         return; // Invalid job or system not running
     }
 
-    // Add job to the queued jobs (thread-safe)
+    // Consume the submit token; a job with unfinished parents stays parked until the last parent finishes
+    if (!job->ReleaseDependency())
+    {
+        return;
+    }
+
+    EnqueueJob(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::EnqueueJob(Job* job)
+{
+    // Read before publishing: once queued, the job may run and be deleted (fire-and-forget) at any time
+    JobType const jobType = job->GetJobType();
+
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        NotifyWorkersForJob(SubmitJobWorkStealing(job));
+        return;
+    }
+
+    // Add job to its priority lane (thread-safe)
+    {
+        std::lock_guard<std::mutex> lock(m_jobQueuesMutex);
+        AddQueuedJobTypeCount(jobType, 1);
+        PushToPriorityLanes(job);
+    }
+
+    // Wake a worker that can run it; sleeping workers of other types stay asleep
+    NotifyWorkersForJob(jobType);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::SubmitJobs(std::vector<Job*> const& jobs)
+{
+    if (!m_isRunning)
+    {
+        return false; // System not running
+    }
+
+    int     readyJobCount = 0;
+    JobType readyJobTypes = 0;
+
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        for (Job* job : jobs)
+        {
+            if (job != nullptr && job->ReleaseDependency())
+            {
+                readyJobTypes |= SubmitJobWorkStealing(job);
+                ++readyJobCount;
+            }
+        }
+    }
+    else
     {
+        // One lock for the whole batch instead of one per job
         std::lock_guard<std::mutex> lock(m_jobQueuesMutex);
-        m_queuedJobs.push_back(job);
+
+        for (Job* job : jobs)
+        {
+            if (job != nullptr && job->ReleaseDependency())
+            {
+                readyJobTypes |= job->GetJobType();
+                AddQueuedJobTypeCount(job->GetJobType(), 1);
+                PushToPriorityLanes(job);
+                ++readyJobCount;
+            }
+        }
+    }
+
+    if (readyJobCount == 1)
+    {
+        NotifyWorkersForJob(readyJobTypes);
+    }
+    else if (readyJobCount > 1)
+    {
+        NotifyAllWorkers(readyJobTypes);
     }
 
-    // Notify one waiting worker thread that work is available
-    // This wakes up sleeping workers efficiently instead of spin-waiting
-    m_jobAvailableCondition.notify_one();
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -183,7 +378,7 @@ Job* JobSystem::RetrieveCompletedJob()
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(m_jobQueuesMutex);
+    std::lock_guard<std::mutex> lock(m_completedJobsMutex);
 
     if (m_completedJobs.empty())
     {
@@ -206,7 +401,7 @@ std::vector<Job*> JobSystem::RetrieveAllCompletedJobs()
         return allCompletedJobs; // Return empty vector
     }
 
-    std::lock_guard<std::mutex> lock(m_jobQueuesMutex);
+    std::lock_guard<std::mutex> lock(m_completedJobsMutex);
 
     // Move all completed jobs to the return vector
     allCompletedJobs.reserve(m_completedJobs.size());
@@ -224,14 +419,30 @@ std::vector<Job*> JobSystem::RetrieveAllCompletedJobs()
 //----------------------------------------------------------------------------------------------------
 int JobSystem::GetQueuedJobCount() const
 {
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        return m_queuedJobCount.load(std::memory_order_relaxed) + m_unclaimableJobCount.load(std::memory_order_relaxed);
+    }
+
     std::scoped_lock lock(m_jobQueuesMutex);
 
-    return static_cast<int>(m_queuedJobs.size());
+    size_t queuedJobCount = 0;
+    for (auto const& lane : m_queuedJobLanes)
+    {
+        queuedJobCount += lane.size();
+    }
+
+    return static_cast<int>(queuedJobCount);
 }
 
 //----------------------------------------------------------------------------------------------------
 int JobSystem::GetExecutingJobCount() const
 {
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        return m_executingJobCount.load(std::memory_order_relaxed);
+    }
+
     std::scoped_lock lock(m_jobQueuesMutex);
 
     return static_cast<int>(m_executingJobs.size());
@@ -240,7 +451,7 @@ int JobSystem::GetExecutingJobCount() const
 //----------------------------------------------------------------------------------------------------
 int JobSystem::GetCompletedJobCount() const
 {
-    std::scoped_lock lock(m_jobQueuesMutex);
+    std::scoped_lock lock(m_completedJobsMutex);
 
     return static_cast<int>(m_completedJobs.size());
 }
@@ -249,54 +460,488 @@ int JobSystem::GetCompletedJobCount() const
 // Private methods called by JobWorkerThread (friend class)
 //----------------------------------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------------------------------
+void JobSystem::OnWorkerThreadStarted(int const workerID)
+{
+    s_currentJobSystem = this;
+    s_currentWorkerID  = workerID;
+    s_stealRandomState = 2463534242u ^ (static_cast<uint32_t>(workerID + 1) * 2654435761u);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only jobs this worker type can claim count, so a backlog of I/O jobs does not keep generic workers
+// spinning through wake -> failed claim -> wake (and vice versa). In WORK_STEALING mode jobs in a
+// worker's deque or inbox are counted under that worker's type (see SubmitJobWorkStealing), since
+// only same-type workers can steal them
+bool JobSystem::HasQueuedJobs(WorkerThreadType const workerType) const
+{
+    return ((workerType & JOB_TYPE_GENERIC) != 0 && m_queuedGenericJobCount.load(std::memory_order_acquire) > 0) ||
+           ((workerType & JOB_TYPE_IO) != 0 && m_queuedIOJobCount.load(std::memory_order_acquire) > 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::AddQueuedJobTypeCount(JobType const jobType, int const delta)
+{
+    if ((jobType & JOB_TYPE_GENERIC) != 0)
+    {
+        m_queuedGenericJobCount.fetch_add(delta, std::memory_order_acq_rel);
+    }
+
+    if ((jobType & JOB_TYPE_IO) != 0)
+    {
+        m_queuedIOJobCount.fetch_add(delta, std::memory_order_acq_rel);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Each worker type sleeps on its own condition variable, so a job only wakes a worker that can run
+// it, and a submit with no compatible sleeper costs no wake-up at all (an idle I/O worker used to
+// turn every generic submit into a futex wake)
+//----------------------------------------------------------------------------------------------------
+void JobSystem::NotifyWorkersForJob(JobType const jobType)
+{
+    if ((jobType & JOB_TYPE_GENERIC) != 0)
+    {
+        m_genericJobAvailableCondition.notify_one();
+    }
+
+    if ((jobType & JOB_TYPE_IO) != 0)
+    {
+        m_ioJobAvailableCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::NotifyAllWorkers(JobType const jobType)
+{
+    if ((jobType & JOB_TYPE_GENERIC) != 0)
+    {
+        m_genericJobAvailableCondition.notify_all();
+    }
+
+    if ((jobType & JOB_TYPE_IO) != 0)
+    {
+        m_ioJobAvailableCondition.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+std::condition_variable& JobSystem::GetJobAvailableCondition(WorkerThreadType const workerType)
+{
+    return (workerType & JOB_TYPE_IO) != 0 ? m_ioJobAvailableCondition : m_genericJobAvailableCondition;
+}
+
 //----------------------------------------------------------------------------------------------------
 bool JobSystem::ClaimJobFromQueue(Job*&                  out_job,
-                                  WorkerThreadType const workerType)
+                                  WorkerThreadType const workerType,
+                                  int const              workerID)
 {
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        return ClaimJobWorkStealing(out_job, workerType, workerID);
+    }
+
     std::scoped_lock lock(m_jobQueuesMutex);
 
-    // Find first job that matches worker type (bitfield check)
-    for (auto it = m_queuedJobs.begin(); it != m_queuedJobs.end(); ++it)
+    // Take the highest-priority job that matches worker type (or a starving one)
+    if (!PopFromPriorityLanes(out_job, workerType, 0))
+    {
+        // No matching job found
+        out_job = nullptr;
+        return false;
+    }
+
+    AddQueuedJobTypeCount(out_job->GetJobType(), -1);
+
+    // Add job to executing jobs
+    m_executingJobs.push_back(out_job);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::MoveJobToCompleted(Job* job)
+{
+    if (job == nullptr) return; // Invalid job
+
+    if (m_config.m_schedulerMode == eJobSchedulerMode::WORK_STEALING)
+    {
+        // Executing jobs are only counted in work-stealing mode, no search required
+        m_executingJobCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        std::scoped_lock lock(m_jobQueuesMutex);
+
+        // Find and remove the job from executing jobs
+        auto const it = std::ranges::find(m_executingJobs, job);
+
+        if (it == m_executingJobs.end())
+        {
+            return;
+        }
+
+        m_executingJobs.erase(it);
+    }
+
+    FinishJob(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+// FinishJob
+//
+// 1. Release continuations: any child whose last dependency was this job is queued right here,
+//    on the worker thread, so multi-stage pipelines never wait for the main thread
+// 2. Graph-owned jobs report to their JobGraph (the graph deletes them, so this is the last touch)
+// 3. Fire-and-forget jobs (Job::SetDeleteOnCompletion) are deleted here
+// 4. Other standalone jobs go to the completed queue for RetrieveCompletedJob()
+//----------------------------------------------------------------------------------------------------
+void JobSystem::FinishJob(Job* job)
+{
+    std::vector<Job*> const continuations = job->MarkFinishedAndTakeContinuations();
+
+    for (Job* continuation : continuations)
+    {
+        if (continuation->ReleaseDependency())
+        {
+            EnqueueJob(continuation);
+        }
+    }
+
+    if (JobGraph* jobGraph = job->GetJobGraph())
+    {
+        jobGraph->OnJobFinished();
+        return;
+    }
+
+    if (job->IsDeletedOnCompletion())
+    {
+        delete job;
+        return;
+    }
+
+    std::scoped_lock lock(m_completedJobsMutex);
+    m_completedJobs.push_back(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Priority Lanes
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::PushToPriorityLanes(Job* job)
+{
+    m_queuedJobLanes[job->GetPriorityLane()].push_back({job, m_laneClaimTicket, m_laneEnqueueSequence++});
+}
+
+//----------------------------------------------------------------------------------------------------
+// PopFromPriorityLanes
+//
+// Looks at the first job in each lane (from minLane up) that the worker type can run.
+// Normally the highest lane wins; but if one of those candidates has been passed over by
+// m_starvationClaimLimit or more claims, the earliest-submitted such candidate is served instead.
+// Each lane is FIFO, so its first compatible job is also its oldest.
+// Waiting is counted from the later of the job's enqueue and the lane's last claim: a deep backlog
+// of old low-priority jobs then gets one claim per m_starvationClaimLimit instead of every claim
+// (which would turn the lanes back into one FIFO under saturation).
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::PopFromPriorityLanes(Job*&                  out_job,
+                                     WorkerThreadType const workerType,
+                                     int const              minLane)
+{
+    using LaneIterator = std::deque<sQueuedJob>::iterator;
+
+    uint64_t const starvationLimit = static_cast<uint64_t>(std::max(m_config.m_starvationClaimLimit, 1));
+
+    int          bestLane     = -1;
+    LaneIterator bestIt;
+    int          starvingLane = -1;
+    LaneIterator starvingIt;
+
+    for (int lane = JOB_PRIORITY_LANE_COUNT - 1; lane >= minLane; --lane)
     {
-        Job* job = *it;
+        std::deque<sQueuedJob>& queue = m_queuedJobLanes[lane];
 
         // Check if worker can handle this job type (bitwise AND)
         // Example: If worker is JOB_TYPE_IO (0x02) and job is JOB_TYPE_IO (0x02), then (0x02 & 0x02) = 0x02 != 0
         // Example: If worker is JOB_TYPE_GENERIC (0x01) and job is JOB_TYPE_IO (0x02), then (0x01 & 0x02) = 0x00 == 0
-        if ((job->GetJobType() & workerType) != 0)
+        auto const it = std::ranges::find_if(queue, [workerType](sQueuedJob const& queuedJob)
         {
-            // Remove job from queued jobs
-            m_queuedJobs.erase(it);
+            return (queuedJob.m_job->GetJobType() & workerType) != 0;
+        });
 
-            // Add job to executing jobs
-            m_executingJobs.push_back(job);
+        if (it == queue.end())
+        {
+            continue;
+        }
 
-            // Return the claimed job
-            out_job = job;
-            return true;
+        if (bestLane < 0)
+        {
+            bestLane = lane;
+            bestIt   = it;
+        }
+
+        uint64_t const waitingSince = std::max(it->m_enqueueTicket, m_laneServedTicket[lane]);
+        bool const     isStarving   = m_laneClaimTicket - waitingSince >= starvationLimit;
+
+        if (isStarving && (starvingLane < 0 || it->m_enqueueSequence < starvingIt->m_enqueueSequence))
+        {
+            starvingLane = lane;
+            starvingIt   = it;
         }
     }
 
-    // No matching job found
-    out_job = nullptr;
-    return false;
+    if (bestLane < 0)
+    {
+        return false;
+    }
+
+    if (starvingLane >= 0 && starvingLane != bestLane)
+    {
+        bestLane = starvingLane;
+        bestIt   = starvingIt;
+        m_starvationPromotionCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    out_job = bestIt->m_job;
+    m_queuedJobLanes[bestLane].erase(bestIt);
+    m_laneServedTicket[bestLane] = ++m_laneClaimTicket;
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void JobSystem::MoveJobToCompleted(Job* job)
+// Work-Stealing Scheduler
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+// SubmitJobWorkStealing
+//
+// Routing order:
+// 1. No compatible worker -> unclaimable list (never claimed, same as SHARED_QUEUE mode)
+// 2. Priority lane above or below normal -> shared priority lanes (ordering matters more than locality)
+// 3. Called from a worker whose type accepts the job -> push onto that worker's own deque (lock-free)
+// 4. Otherwise -> round-robin to a compatible worker's inbox (per-worker mutex, rarely contended)
+//
+// Returns the worker types that can now reach the job. A deque or inbox is only reachable by
+// workers of its owner's type, so e.g. a JOB_TYPE_ALL job handed to an I/O worker is counted (and
+// woken) as an I/O job only; generic workers cannot steal it and must not spin waiting for it.
+//----------------------------------------------------------------------------------------------------
+JobType JobSystem::SubmitJobWorkStealing(Job* job)
 {
-    if (job == nullptr) return; // Invalid job
+    JobType const jobType = job->GetJobType();
+
+    if ((jobType & m_workerTypeMask) == 0)
+    {
+        // Unclaimable job: keep it out of the wake-up counter so idle workers still sleep
+        std::scoped_lock lock(m_jobQueuesMutex);
+        m_unclaimableJobs.push_back(job);
+        m_unclaimableJobCount.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    // Count before publishing so a thief can never drive the counters negative
+    m_queuedJobCount.fetch_add(1, std::memory_order_release);
+
+    int const lane = job->GetPriorityLane();
+
+    if (lane != JOB_PRIORITY_NORMAL_LANE)
+    {
+        // The shared lanes are visible to every worker type the job accepts
+        AddQueuedJobTypeCount(jobType, 1);
+        std::scoped_lock lock(m_jobQueuesMutex);
+        PushToPriorityLanes(job);
+        (lane > JOB_PRIORITY_NORMAL_LANE ? m_urgentLaneJobCount : m_deferredLaneJobCount).fetch_add(1, std::memory_order_release);
+        return jobType;
+    }
+
+    if (s_currentJobSystem == this && s_currentWorkerID >= 0)
+    {
+        sWorkerQueue& ownQueue = *m_workerQueues[s_currentWorkerID];
+
+        if ((ownQueue.m_workerType & jobType) != 0)
+        {
+            AddQueuedJobTypeCount(ownQueue.m_workerType, 1);
+
+            if (ownQueue.m_deque.PushBottom(job))
+            {
+                return ownQueue.m_workerType;
+            }
+
+            AddQueuedJobTypeCount(ownQueue.m_workerType, -1);   // Deque full, fall back to an inbox
+        }
+    }
+
+    int const workerCount = static_cast<int>(m_workerQueues.size());
+    uint32_t const start  = m_nextInboxWorker.fetch_add(1, std::memory_order_relaxed);
+
+    // m_workerTypeMask guarantees at least one compatible worker
+    for (int i = 0; ; ++i)
+    {
+        sWorkerQueue& workerQueue = *m_workerQueues[(start + static_cast<uint32_t>(i)) % static_cast<uint32_t>(workerCount)];
+
+        if ((workerQueue.m_workerType & jobType) != 0)
+        {
+            AddQueuedJobTypeCount(workerQueue.m_workerType, 1);
+            std::scoped_lock lock(workerQueue.m_inboxMutex);
+            workerQueue.m_inbox.push_back(job);
+            return workerQueue.m_workerType;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// ClaimJobWorkStealing
+//
+// Claim order: urgent lanes -> own deque (LIFO) -> own inbox -> steal from same-type victims -> deferred lanes
+// Every m_starvationClaimLimit claims a worker also services all lanes first, so deferred jobs
+// get their aging check even while the deques never run dry.
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::ClaimJobWorkStealing(Job*&                  out_job,
+                                     WorkerThreadType const workerType,
+                                     int const              workerID)
+{
+    out_job = nullptr;
+
+    if (workerID < 0 || workerID >= static_cast<int>(m_workerQueues.size()))
+    {
+        return false;
+    }
+
+    bool claimed         = false;
+    bool claimedFromLane = false;   // Lane jobs were counted by job type, deque/inbox jobs by owner type
+
+    bool const isLaneServiceDue = ++s_claimsSinceLaneService >= m_config.m_starvationClaimLimit;
+
+    if (isLaneServiceDue && m_deferredLaneJobCount.load(std::memory_order_acquire) > 0)
+    {
+        s_claimsSinceLaneService = 0;
+        claimed                  = ClaimJobFromPriorityLanes(out_job, workerType, 0);
+        claimedFromLane          = claimed;
+    }
+
+    if (!claimed && m_urgentLaneJobCount.load(std::memory_order_acquire) > 0)
+    {
+        claimed         = ClaimJobFromPriorityLanes(out_job, workerType, JOB_PRIORITY_NORMAL_LANE + 1);
+        claimedFromLane = claimed;
+    }
+
+    sWorkerQueue& ownQueue = *m_workerQueues[workerID];
+
+    if (!claimed)
+    {
+        claimed = ownQueue.m_deque.PopBottom(out_job);
+    }
+
+    if (!claimed)
+    {
+        // Take the oldest inbox job and move the rest into the deque where thieves can reach them
+        std::scoped_lock lock(ownQueue.m_inboxMutex);
+
+        if (!ownQueue.m_inbox.empty())
+        {
+            out_job = ownQueue.m_inbox.front();
+            ownQueue.m_inbox.pop_front();
+            claimed = true;
+
+            while (!ownQueue.m_inbox.empty() && ownQueue.m_deque.PushBottom(ownQueue.m_inbox.back()))
+            {
+                ownQueue.m_inbox.pop_back();
+            }
+        }
+    }
+
+    if (!claimed)
+    {
+        claimed = StealJob(out_job, workerType, workerID);
+    }
+
+    if (!claimed && m_deferredLaneJobCount.load(std::memory_order_acquire) > 0)
+    {
+        claimed         = ClaimJobFromPriorityLanes(out_job, workerType, 0);
+        claimedFromLane = claimed;
+    }
+
+    if (!claimed)
+    {
+        out_job = nullptr;
+        return false;
+    }
 
+    // Steals only come from same-type victims, so workerType is the owner type the job was counted as
+    m_queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+    AddQueuedJobTypeCount(claimedFromLane ? out_job->GetJobType() : workerType, -1);
+    m_executingJobCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::ClaimJobFromPriorityLanes(Job*&                  out_job,
+                                          WorkerThreadType const workerType,
+                                          int const              minLane)
+{
     std::scoped_lock lock(m_jobQueuesMutex);
 
-    // Find and remove the job from executing jobs
-    auto const it = std::ranges::find(m_executingJobs, job);
+    if (!PopFromPriorityLanes(out_job, workerType, minLane))
+    {
+        return false;
+    }
+
+    (out_job->GetPriorityLane() > JOB_PRIORITY_NORMAL_LANE ? m_urgentLaneJobCount : m_deferredLaneJobCount).fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// StealJob
+//
+// Visits every other worker once, starting at a random victim. Only workers with the same
+// WorkerThreadType are eligible: their deques only ever hold jobs compatible with that type.
+// Inboxes are probed with try_lock so a thief never blocks a submitter.
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::StealJob(Job*&                  out_job,
+                         WorkerThreadType const workerType,
+                         int const              thiefID)
+{
+    int const workerCount = static_cast<int>(m_workerQueues.size());
 
-    if (it != m_executingJobs.end())
+    if (workerCount <= 1)
     {
-        m_executingJobs.erase(it);
+        return false;
+    }
+
+    int const start = static_cast<int>(NextStealRandom() % static_cast<uint32_t>(workerCount));
 
-        // Add job to completed jobs
-        m_completedJobs.push_back(job);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        int const victimID = (start + i) % workerCount;
+
+        if (victimID == thiefID)
+        {
+            continue;
+        }
+
+        sWorkerQueue& victimQueue = *m_workerQueues[victimID];
+
+        if (victimQueue.m_workerType != workerType)
+        {
+            continue;
+        }
+
+        if (victimQueue.m_deque.StealTop(out_job))
+        {
+            m_stealCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::unique_lock lock(victimQueue.m_inboxMutex, std::try_to_lock);
+
+        if (lock.owns_lock() && !victimQueue.m_inbox.empty())
+        {
+            out_job = victimQueue.m_inbox.front();
+            victimQueue.m_inbox.pop_front();
+            m_stealCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
     }
+
+    return false;
 }
@@ -6,19 +6,40 @@
 #pragma once
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/Job.hpp"  // Need JobType and WorkerThreadType definitions
+#include "Engine/Core/WorkStealingDeque.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <array>
+#include <atomic>
 #include <condition_variable>  // For efficient worker thread sleeping
+#include <cstdint>
 #include <deque>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Job;
 class JobWorkerThread;
 
+//----------------------------------------------------------------------------------------------------
+// Scheduling strategy used to hand queued jobs to worker threads
+//   SHARED_QUEUE:  One mutex-protected deque scanned by every worker (original behavior)
+//   WORK_STEALING: Per-worker lock-free deques; idle workers steal from random workers of the same type
+//----------------------------------------------------------------------------------------------------
+enum class eJobSchedulerMode : uint8_t
+{
+    SHARED_QUEUE,
+    WORK_STEALING
+};
+
+//----------------------------------------------------------------------------------------------------
 struct sJobSubsystemConfig
 {
-    int m_genericThreadNum = 0;
-    int m_ioThreadNum      = 1;
+    int               m_genericThreadNum     = 0;
+    int               m_ioThreadNum          = 1;
+    eJobSchedulerMode m_schedulerMode        = eJobSchedulerMode::SHARED_QUEUE;
+    int               m_workerDequeCapacity  = 4096;  // Per-worker deque size (WORK_STEALING only, rounded to power of two)
+    int               m_starvationClaimLimit = 256;  // A lane passed over by this many claims is served next
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -38,9 +59,29 @@ struct sJobSubsystemConfig
 // 5. Client code calls RetrieveCompletedJob() to get finished job
 // 6. Client code deletes the job
 //
+// Priority Lanes:
+// - Job::GetPriority() (-100..100, same scale as sResourceCommand) maps to JOB_PRIORITY_LANE_COUNT
+//   FIFO lanes; workers always take the highest non-empty lane they can run
+// - Starvation protection: a lane whose first job has been passed over by m_starvationClaimLimit
+//   claims (since it was queued or the lane was last served) is served next, whatever its lane; a
+//   saturated low lane thus gets one claim in m_starvationClaimLimit and never blocks higher lanes
+// - WORK_STEALING mode keeps normal-lane jobs in the per-worker deques; higher lanes are checked
+//   before the deques, lower lanes only when a worker finds nothing else (and periodically)
+//
+// Dependencies / Graphs:
+// - Jobs may declare parents via Job::AddDependency(); on completion the worker queues every child
+//   whose last parent just finished (see JobGraph for owning, waitable groups of jobs)
+//
+// Work-Stealing Mode (sJobSubsystemConfig::m_schedulerMode == WORK_STEALING):
+// - Each worker owns a lock-free WorkStealingDeque plus a small mutex-protected inbox
+// - Jobs submitted from a worker thread go straight to that worker's deque (if the type matches)
+// - Jobs submitted from other threads are distributed round-robin to compatible workers' inboxes
+// - Idle workers steal only from workers with the same WorkerThreadType, so JOB_TYPE filtering holds
+// - Executing jobs are tracked by an atomic counter instead of a searched deque
+//
 // Thread Safety:
-// - All job queue operations are protected by mutexes
-// - Job submission: Main thread only
+// - All job queue operations are protected by mutexes (SHARED_QUEUE) or lock-free deques (WORK_STEALING)
+// - Job submission: Main thread only (SHARED_QUEUE), any thread (WORK_STEALING)
 // - Job execution: Worker threads only
 // - Job retrieval: Main thread only
 //----------------------------------------------------------------------------------------------------
@@ -69,9 +110,15 @@ public:
 
     // Submit a job to be processed by worker threads
     // The job will be added to the queued jobs and claimed by next available worker
-    // Job ownership transfers to JobSystem until retrieved
+    // A job with unfinished dependencies (Job::AddDependency) is held back and queued by the worker
+    // that finishes its last parent
+    // Job ownership transfers to JobSystem until retrieved (or stays with its JobGraph)
     void SubmitJob(Job* job);
 
+    // Submit several jobs with a single queue lock and one wake-up broadcast
+    // Returns false if the system is not running; the jobs were not taken and still belong to the caller
+    bool SubmitJobs(std::vector<Job*> const& jobs);
+
     // Retrieve one completed job (if available)
     // Returns nullptr if no completed jobs are available
     // Caller takes ownership and is responsible for deleting the job
@@ -87,31 +134,108 @@ public:
     int GetExecutingJobCount() const;
     int GetCompletedJobCount() const;
 
+    // True between Startup() and Shutdown()
+    bool IsRunning() const { return m_isRunning; }
+
     // Get total number of worker threads
     int GetWorkerThreadCount() const { return static_cast<int>(m_workerThreads.size()); }
 
+    // Get number of JOB_TYPE_GENERIC worker threads (valid after Startup())
+    int GetGenericWorkerThreadCount() const { return m_isRunning ? m_config.m_genericThreadNum : 0; }
+
+    // Get number of JOB_TYPE_IO worker threads (valid after Startup())
+    int GetIOWorkerThreadCount() const { return m_isRunning ? m_config.m_ioThreadNum : 0; }
+
+    // Scheduling statistics (for debugging/monitoring)
+    eJobSchedulerMode GetSchedulerMode() const { return m_config.m_schedulerMode; }
+    uint64_t          GetStealCount() const { return m_stealCount.load(std::memory_order_relaxed); }
+    uint64_t          GetStarvationPromotionCount() const { return m_starvationPromotionCount.load(std::memory_order_relaxed); }
+
 private:
     // Friend class allows JobWorkerThread to access private queue methods
     friend class JobWorkerThread;
 
     sJobSubsystemConfig m_config;
 
+    // Per-worker scheduling state (WORK_STEALING only)
+    struct sWorkerQueue
+    {
+        explicit sWorkerQueue(size_t capacity) : m_deque(capacity) {}
+
+        WorkStealingDeque<Job*> m_deque;             // Owner push/pop, thieves steal
+        std::mutex              m_inboxMutex;        // Guards m_inbox
+        std::deque<Job*>        m_inbox;             // Jobs handed in from non-owner threads
+        WorkerThreadType        m_workerType = JOB_TYPE_GENERIC;
+    };
+
     // Thread-safe job queue operations (called by worker threads)
-    bool ClaimJobFromQueue(Job*& out_job, WorkerThreadType workerType);      // Move job: queued -> executing (filtered by type)
+    bool ClaimJobFromQueue(Job*& out_job, WorkerThreadType workerType, int workerID);  // Move job: queued -> executing (filtered by type)
     void MoveJobToCompleted(Job* job);         // Move job: executing -> completed
+    void FinishJob(Job* job);                  // Release continuations, then hand job to its graph or the completed queue
+    void CancelUnfinishedJobs(std::vector<Job*> jobs);  // Shutdown: settle jobs that will never run (and their parked children)
+    void EnqueueJob(Job* job);                 // Put a ready job into the scheduler queues and wake a worker
+    bool HasQueuedJobs(WorkerThreadType workerType) const;  // Cheap wake-up predicate: jobs this worker type can claim or steal
+    void AddQueuedJobTypeCount(JobType jobType, int delta);  // Maintain the per-worker-type wake-up counters
+    void NotifyWorkersForJob(JobType jobType);               // Wake one sleeping worker of each type that can run it
+    void NotifyAllWorkers(JobType jobType);                  // Wake every sleeping worker of these types
+    std::condition_variable& GetJobAvailableCondition(WorkerThreadType workerType);
+    void OnWorkerThreadStarted(int workerID);  // Records worker identity in thread-local storage
+
+    // Priority lane helpers (caller holds m_jobQueuesMutex)
+    void PushToPriorityLanes(Job* job);
+    bool PopFromPriorityLanes(Job*& out_job, WorkerThreadType workerType, int minLane);
+
+    // Work-stealing helpers
+    JobType SubmitJobWorkStealing(Job* job);   // Returns the worker types that can reach the job
+    bool ClaimJobWorkStealing(Job*& out_job, WorkerThreadType workerType, int workerID);
+    bool ClaimJobFromPriorityLanes(Job*& out_job, WorkerThreadType workerType, int minLane);
+    bool StealJob(Job*& out_job, WorkerThreadType workerType, int thiefID);
+
+    // Queued job entry; the ticket is the claim count at enqueue time, used to measure starvation,
+    // and the sequence orders starving jobs by submission
+    struct sQueuedJob
+    {
+        Job*     m_job             = nullptr;
+        uint64_t m_enqueueTicket   = 0;
+        uint64_t m_enqueueSequence = 0;
+    };
 
     // Job queues protected by mutex
-    std::deque<Job*> m_queuedJobs;            // Jobs waiting to be claimed
+    std::array<std::deque<sQueuedJob>, JOB_PRIORITY_LANE_COUNT> m_queuedJobLanes;  // Jobs waiting to be claimed, one FIFO per lane
     std::deque<Job*> m_executingJobs;         // Jobs currently being processed
     std::deque<Job*> m_completedJobs;         // Jobs finished and ready for retrieval
+    std::deque<Job*> m_unclaimableJobs;       // WORK_STEALING: jobs no worker type accepts
+    uint64_t         m_laneClaimTicket     = 0;   // Number of jobs claimed from the lanes so far
+    std::array<uint64_t, JOB_PRIORITY_LANE_COUNT> m_laneServedTicket = {};   // m_laneClaimTicket after each lane's last claim
+    uint64_t         m_laneEnqueueSequence = 0;   // Number of jobs pushed to the lanes so far
 
-    // Mutex for protecting all job queue operations
+    // Mutex for protecting the queued and executing job queues
     mutable std::mutex m_jobQueuesMutex;
 
-    // Condition variable for efficient worker thread waiting
-    // Workers sleep on this and are notified when jobs are submitted
-    std::condition_variable m_jobAvailableCondition;
-    std::mutex              m_conditionMutex;  // Separate mutex for condition variable
+    // Mutex for protecting the completed job queue (kept separate so retrieval never blocks claiming)
+    mutable std::mutex m_completedJobsMutex;
+
+    // Work-stealing state (indexed by worker ID, empty in SHARED_QUEUE mode)
+    std::vector<std::unique_ptr<sWorkerQueue>> m_workerQueues;
+    std::atomic<int>      m_queuedJobCount       = 0;   // Claimable jobs waiting in deques/inboxes/lanes
+    std::atomic<int>      m_queuedGenericJobCount = 0;  // Queued jobs a JOB_TYPE_GENERIC worker can claim (both modes)
+    std::atomic<int>      m_queuedIOJobCount      = 0;  // Queued jobs a JOB_TYPE_IO worker can claim (both modes)
+    std::atomic<int>      m_executingJobCount    = 0;   // Jobs claimed but not yet completed
+    std::atomic<int>      m_unclaimableJobCount  = 0;   // Jobs parked in m_unclaimableJobs
+    std::atomic<int>      m_urgentLaneJobCount   = 0;   // Jobs in lanes above normal (checked before the deques)
+    std::atomic<int>      m_deferredLaneJobCount = 0;   // Jobs in lanes below normal (checked after stealing fails)
+    std::atomic<uint32_t> m_nextInboxWorker      = 0;   // Round-robin cursor for external submissions
+    std::atomic<uint64_t> m_stealCount           = 0;   // Successful steals since startup
+    WorkerThreadType      m_workerTypeMask       = 0;   // OR of every worker's type
+
+    // Scheduling statistics shared by both modes
+    std::atomic<uint64_t> m_starvationPromotionCount = 0;   // Claims that skipped a higher lane to serve a starving job
+
+    // Condition variables for efficient worker thread waiting, one per worker type
+    // Workers sleep on their type's variable and are notified when a job they can run is submitted
+    std::condition_variable m_genericJobAvailableCondition;
+    std::condition_variable m_ioJobAvailableCondition;
+    std::mutex              m_conditionMutex;  // Separate mutex for condition variables
 
     // Worker thread management
     std::vector<std::unique_ptr<JobWorkerThread>> m_workerThreads;
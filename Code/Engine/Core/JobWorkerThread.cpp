@@ -73,6 +73,9 @@ void JobWorkerThread::Join()
 //----------------------------------------------------------------------------------------------------
 void JobWorkerThread::ThreadMain()
 {
+    // Let the JobSystem know which worker this thread is (used for work-stealing routing)
+    m_jobSystem->OnWorkerThreadStarted(m_workerID);
+
     // Continuous job processing loop
     while (!m_shouldStop.load())
     {
@@ -87,13 +90,13 @@ void JobWorkerThread::ThreadMain()
             // No work available - wait on condition variable instead of spinning
             // This is much more efficient than sleeping/yielding in a tight loop
             std::unique_lock<std::mutex> lock(m_jobSystem->m_conditionMutex);
-            m_jobSystem->m_jobAvailableCondition.wait_for(
+            m_jobSystem->GetJobAvailableCondition(m_workerType).wait_for(
                 lock,
                 std::chrono::milliseconds(10),  // Timeout after 10ms to check m_shouldStop
                 [this]
                 {
                     // Predicate: wake up if stopping or if there are jobs available
-                    return m_shouldStop.load() || m_jobSystem->GetQueuedJobCount() > 0;
+                    return m_shouldStop.load() || m_jobSystem->HasQueuedJobs(m_workerType);
                 }
             );
         }
@@ -105,7 +108,8 @@ bool JobWorkerThread::ClaimJob()
 {
     // Attempt to claim a job from the JobSystem's queued jobs
     // Pass our worker type so we only claim jobs matching our type
-    return m_jobSystem->ClaimJobFromQueue(m_currentJob, m_workerType);
+    // Pass our worker ID so work-stealing mode can pop from our own deque first
+    return m_jobSystem->ClaimJobFromQueue(m_currentJob, m_workerType, m_workerID);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -0,0 +1,258 @@
+//----------------------------------------------------------------------------------------------------
+// LZBlockCodec.cpp
+// Engine Core Module - Built-in LZ Block Compression
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LZBlockCodec.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int constexpr    HASH_BITS     = 13;
+    size_t constexpr MIN_MATCH     = 4;
+    size_t constexpr MAX_OFFSET    = 65535;
+    size_t constexpr LAST_LITERALS = 5;     // A block always ends in at least this many literals
+    size_t constexpr MATCH_LIMIT   = 12;    // No match may start in the last MATCH_LIMIT bytes
+
+    //------------------------------------------------------------------------------------------------
+    uint32_t Read32(uint8_t const* p)
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint64_t Read64(uint8_t const* p)
+    {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t HashPrefix(uint32_t const prefix)
+    {
+        return (prefix * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Lengths at or above 15 continue in 255-valued bytes after the token
+    uint8_t* WriteLengthTail(uint8_t* out, size_t length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            *out++ = 255;
+        }
+        *out++ = static_cast<uint8_t>(length);
+        return out;
+    }
+
+    bool ReadLengthTail(uint8_t const*& in, uint8_t const* inEnd, size_t& length)
+    {
+        uint8_t next = 255;
+        while (next == 255)
+        {
+            if (in >= inEnd)
+            {
+                return false;
+            }
+            next = *in++;
+            length += next;
+        }
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Returns nullptr when dst cannot hold the sequence
+    uint8_t* WriteSequence(uint8_t* out, uint8_t const* outEnd,
+                           uint8_t const* literals, size_t literalCount,
+                           size_t offset, size_t matchLength)
+    {
+        // Token + literal tail + literals + offset + match tail, bounded generously
+        size_t const worstCase = 1 + literalCount / 255 + 1 + literalCount + 2 + matchLength / 255 + 1;
+        if (static_cast<size_t>(outEnd - out) < worstCase)
+        {
+            return nullptr;
+        }
+
+        size_t const  matchCode = matchLength != 0 ? matchLength - MIN_MATCH : 0;
+        uint8_t*      token     = out++;
+        *token                  = static_cast<uint8_t>(((literalCount < 15 ? literalCount : 15) << 4) |
+                                                       (matchCode < 15 ? matchCode : 15));
+        if (literalCount >= 15)
+        {
+            out = WriteLengthTail(out, literalCount - 15);
+        }
+        if (literalCount != 0)
+        {
+            std::memcpy(out, literals, literalCount);
+            out += literalCount;
+        }
+
+        if (matchLength != 0)
+        {
+            *out++ = static_cast<uint8_t>(offset);
+            *out++ = static_cast<uint8_t>(offset >> 8);
+            if (matchCode >= 15)
+            {
+                out = WriteLengthTail(out, matchCode - 15);
+            }
+        }
+        return out;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t GetLZCompressBound(size_t const rawSize)
+{
+    return rawSize + rawSize / 255 + 16;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t LZCompressBlock(void const* const src, size_t const srcSize, void* const dst, size_t const dstCapacity)
+{
+    uint8_t const* const input  = static_cast<uint8_t const*>(src);
+    uint8_t* const       output = static_cast<uint8_t*>(dst);
+    uint8_t const* const outEnd = output + dstCapacity;
+    uint8_t*             out    = output;
+
+    size_t anchor = 0;
+
+    if (srcSize > MATCH_LIMIT)
+    {
+        uint32_t table[1 << HASH_BITS] = {};   // Position + 1 of the last occurrence of each hashed prefix
+
+        size_t const matchStartLimit = srcSize - MATCH_LIMIT;
+        size_t const matchEndLimit   = srcSize - LAST_LITERALS;
+        size_t       position        = 0;
+        size_t       missCount       = 0;
+
+        while (position < matchStartLimit)
+        {
+            uint32_t const prefix    = Read32(input + position);
+            uint32_t&      slot      = table[HashPrefix(prefix)];
+            size_t const   candidate = slot;
+            slot                     = static_cast<uint32_t>(position + 1);
+
+            if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET || Read32(input + candidate - 1) != prefix)
+            {
+                // Step further through incompressible stretches
+                position += 1 + (missCount++ >> 6);
+                continue;
+            }
+
+            // Extend 8 bytes at a time; the first differing byte is the lowest set byte of the XOR (little-endian)
+            size_t const reference   = candidate - 1;
+            size_t       matchLength = MIN_MATCH;
+            while (position + matchLength + 8 <= matchEndLimit)
+            {
+                uint64_t const difference = Read64(input + reference + matchLength) ^ Read64(input + position + matchLength);
+                if (difference != 0)
+                {
+                    matchLength += static_cast<size_t>(std::countr_zero(difference)) / 8;
+                    break;
+                }
+                matchLength += 8;
+            }
+            if (position + matchLength + 8 > matchEndLimit)
+            {
+                while (position + matchLength < matchEndLimit && input[reference + matchLength] == input[position + matchLength])
+                {
+                    ++matchLength;
+                }
+            }
+
+            out = WriteSequence(out, outEnd, input + anchor, position - anchor, position - reference, matchLength);
+            if (out == nullptr)
+            {
+                return 0;
+            }
+
+            position += matchLength;
+            anchor    = position;
+            missCount = 0;
+
+            // Seed the table inside the match so the next repeat of this text is found
+            if (position - 2 < matchStartLimit)
+            {
+                table[HashPrefix(Read32(input + position - 2))] = static_cast<uint32_t>(position - 2 + 1);
+            }
+        }
+    }
+
+    out = WriteSequence(out, outEnd, input + anchor, srcSize - anchor, 0, 0);
+    return out != nullptr ? static_cast<size_t>(out - output) : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool LZDecompressBlock(void const* const src, size_t const srcSize, void* const dst, size_t const rawSize)
+{
+    uint8_t const*       in     = static_cast<uint8_t const*>(src);
+    uint8_t const* const inEnd  = in + srcSize;
+    uint8_t* const       output = static_cast<uint8_t*>(dst);
+    uint8_t*             out    = output;
+    uint8_t* const       outEnd = output + rawSize;
+
+    while (in < inEnd)
+    {
+        uint8_t const token = *in++;
+
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !ReadLengthTail(in, inEnd, literalCount))
+        {
+            return false;
+        }
+        if (literalCount > static_cast<size_t>(inEnd - in) || literalCount > static_cast<size_t>(outEnd - out))
+        {
+            return false;
+        }
+        std::memcpy(out, in, literalCount);
+        in  += literalCount;
+        out += literalCount;
+
+        if (in == inEnd)
+        {
+            break;  // Last sequence: literals only
+        }
+
+        if (inEnd - in < 2)
+        {
+            return false;
+        }
+        size_t const offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !ReadLengthTail(in, inEnd, matchLength))
+        {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+
+        if (offset == 0 || offset > static_cast<size_t>(out - output) || matchLength > static_cast<size_t>(outEnd - out))
+        {
+            return false;
+        }
+
+        uint8_t const* match = out - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(out, match, matchLength);
+            out += matchLength;
+        }
+        else
+        {
+            // Overlapping copy repeats the last offset bytes
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                *out++ = *match++;
+            }
+        }
+    }
+
+    return out == outEnd;
+}
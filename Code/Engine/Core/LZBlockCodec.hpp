@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------------------------------
+// LZBlockCodec.hpp
+// Engine Core Module - Built-in LZ Block Compression
+//
+// Purpose:
+//   Dependency-free byte compression for engine-written data (log archives). Whole blocks in,
+//   whole blocks out; no streaming state.
+//
+// Design Rationale:
+//   - LZ77 with LZ4-style sequences: [token][literal length+][literals][offset:2][match length+]
+//     The token's high nibble is the literal count, its low nibble the match length - 4; a nibble
+//     of 15 continues in 255-valued bytes. The last sequence is literals only.
+//   - Greedy single-probe hash table of 4-byte prefixes (8K entries on the stack), 64 KB window.
+//     Fast rather than tight: log text still shrinks 4-8x.
+//   - Decompression is bounds-checked against both buffers, so a corrupt block fails instead of
+//     writing out of range
+//
+// Thread Safety:
+//   - Stateless; safe from any thread
+//
+// Author: Log Archive Compression
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------------------------------------
+// Worst-case compressed size of rawSize bytes (incompressible input)
+size_t GetLZCompressBound(size_t rawSize);
+
+// Compress src into dst. Returns the compressed size, or 0 if dstCapacity is too small
+// (dstCapacity >= GetLZCompressBound(srcSize) always succeeds).
+size_t LZCompressBlock(void const* src, size_t srcSize, void* dst, size_t dstCapacity);
+
+// Decompress a block produced by LZCompressBlock. rawSize is the exact original size.
+// Returns false if the block is corrupt or does not decode to exactly rawSize bytes.
+bool LZDecompressBlock(void const* src, size_t srcSize, void* dst, size_t rawSize);
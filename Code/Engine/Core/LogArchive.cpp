@@ -0,0 +1,778 @@
+//----------------------------------------------------------------------------------------------------
+// LogArchive.cpp
+// Engine Core Module - Compressed, Indexed Log Archives
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LogArchive.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/BufferParser.hpp"
+#include "Engine/Core/BufferWriter.hpp"
+#include "Engine/Core/LZBlockCodec.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint32_t constexpr LOG_ARCHIVE_MAGIC        = 0x474F4C44;   // "DLOG"
+    uint32_t constexpr LOG_ARCHIVE_FOOTER_MAGIC = 0x58494C44;   // "DLIX"
+    uint32_t constexpr LOG_ARCHIVE_VERSION      = 1;
+    size_t constexpr   LOG_ARCHIVE_HEADER_SIZE  = 8;             // magic, version
+    size_t constexpr   LOG_ARCHIVE_FOOTER_SIZE  = 24;            // index offset, index size, block count, magic, version
+    size_t constexpr   LOG_ARCHIVE_BLOCK_SIZE   = 56;            // One serialized sLogArchiveBlock (incl. 4 reserved)
+    uint32_t constexpr MAX_ARCHIVE_CATEGORIES   = 63;
+    int64_t constexpr  MS_PER_DAY               = 24 * 60 * 60 * 1000;
+    int64_t constexpr  BLOCK_TIME_SLACK_MS      = 1000;          // Index times come from clock ticks, line text from the wall clock
+
+    //------------------------------------------------------------------------------------------------
+    bool IsRangeInside(uint64_t const first, uint64_t const count, uint64_t const total)
+    {
+        return first <= total && count <= total - first;
+    }
+
+    uint64_t GetCategoryBit(size_t const categoryIndex)
+    {
+        return categoryIndex < MAX_ARCHIVE_CATEGORIES ? 1ull << categoryIndex : LOG_ARCHIVE_OTHER_CATEGORY_BIT;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Local midnight at or before epochMs
+    int64_t GetLocalMidnightMs(int64_t const epochMs)
+    {
+        time_t const seconds = static_cast<time_t>(epochMs >= 0 ? epochMs / 1000 : (epochMs - 999) / 1000);
+        struct tm    timeinfo;
+#ifdef _WIN32
+        localtime_s(&timeinfo, &seconds);
+#else
+        localtime_r(&seconds, &timeinfo);
+#endif
+        timeinfo.tm_hour  = 0;
+        timeinfo.tm_min   = 0;
+        timeinfo.tm_sec   = 0;
+        timeinfo.tm_isdst = -1;
+        return static_cast<int64_t>(mktime(&timeinfo)) * 1000;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // "[HH:MM:SS.mmm]..." → milliseconds since midnight, -1 if the line has no such prefix
+    int64_t ParseTimeOfDayMs(std::string_view const line)
+    {
+        if (line.size() < 14 || line[0] != '[' || line[3] != ':' || line[6] != ':' || line[9] != '.' || line[13] != ']')
+        {
+            return -1;
+        }
+
+        for (size_t const digitIndex : {1, 2, 4, 5, 7, 8, 10, 11, 12})
+        {
+            char const digit = line[digitIndex];
+            if (digit < '0' || digit > '9')
+            {
+                return -1;
+            }
+        }
+
+        int64_t const hours   = (line[1] - '0') * 10 + (line[2] - '0');
+        int64_t const minutes = (line[4] - '0') * 10 + (line[5] - '0');
+        int64_t const seconds = (line[7] - '0') * 10 + (line[8] - '0');
+        int64_t const millis  = (line[10] - '0') * 100 + (line[11] - '0') * 10 + (line[12] - '0');
+        return ((hours * 60 + minutes) * 60 + seconds) * 1000 + millis;
+    }
+
+    // "[time][Category]..." → "Category", empty if the line has no such prefix
+    std::string_view ParseCategory(std::string_view const line)
+    {
+        size_t const timeEnd = line.find(']');
+        if (timeEnd == std::string_view::npos || timeEnd + 1 >= line.size() || line[timeEnd + 1] != '[')
+        {
+            return {};
+        }
+
+        size_t const categoryEnd = line.find(']', timeEnd + 2);
+        return categoryEnd != std::string_view::npos ? line.substr(timeEnd + 2, categoryEnd - timeEnd - 2) : std::string_view();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Index a text log without a live index: times and categories from the line prefixes. Lines
+    // without a prefix (continuations of multi-line messages) inherit the previous line's.
+    bool BuildRecoveredIndex(std::filesystem::path const& textPath, LogArchiveIndexBuilder& outIndex, String& outError)
+    {
+        std::ifstream textFile(textPath, std::ios::binary);
+        if (!textFile.is_open())
+        {
+            outError = "cannot open " + textPath.string();
+            return false;
+        }
+
+        outIndex.Reset();
+
+        std::vector<char> chunk(1024 * 1024);
+        String            partialLine;
+        String            category;
+        int64_t           dayIndex      = 0;
+        int64_t           lastTimeOfDay = -1;
+
+        auto const addLine = [&](std::string_view const line, size_t const lineBytes)
+        {
+            int64_t const timeOfDay = ParseTimeOfDayMs(line);
+            if (timeOfDay >= 0)
+            {
+                // Lines are in write order: a large step backwards is a midnight crossing
+                if (lastTimeOfDay >= 0 && timeOfDay < lastTimeOfDay - MS_PER_DAY / 2)
+                {
+                    ++dayIndex;
+                }
+                lastTimeOfDay = timeOfDay;
+                category      = String(ParseCategory(line));
+            }
+            outIndex.AddRecoveredLine(lineBytes, dayIndex * MS_PER_DAY + (std::max)(lastTimeOfDay, int64_t(0)), category);
+        };
+
+        while (textFile)
+        {
+            textFile.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            size_t const readCount = static_cast<size_t>(textFile.gcount());
+            if (readCount == 0)
+            {
+                break;
+            }
+
+            std::string_view remaining(chunk.data(), readCount);
+            for (size_t newline = remaining.find('\n'); newline != std::string_view::npos; newline = remaining.find('\n'))
+            {
+                if (partialLine.empty())
+                {
+                    addLine(remaining.substr(0, newline), newline + 1);
+                }
+                else
+                {
+                    partialLine.append(remaining.data(), newline);
+                    addLine(partialLine, partialLine.size() + 1);
+                    partialLine.clear();
+                }
+                remaining.remove_prefix(newline + 1);
+            }
+            partialLine.append(remaining.data(), remaining.size());
+        }
+
+        if (!partialLine.empty())
+        {
+            addLine(partialLine, partialLine.size());   // Unterminated last line
+        }
+
+        // The text only has times of day: anchor the last day on the file's last write
+        std::error_code                         errorCode;
+        std::filesystem::file_time_type const   lastWrite = std::filesystem::last_write_time(textPath, errorCode);
+        std::chrono::system_clock::time_point   wallClock = std::chrono::system_clock::now();
+        if (!errorCode)
+        {
+            wallClock = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+                lastWrite - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
+        }
+        int64_t const lastWriteMs = std::chrono::duration_cast<std::chrono::milliseconds>(wallClock.time_since_epoch()).count();
+        outIndex.ShiftTimes(GetLocalMidnightMs(lastWriteMs) - dayIndex * MS_PER_DAY);
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    enum class eArchiveWriteStatus : uint8_t
+    {
+        OK,
+        INDEX_MISMATCH,     // The index does not describe the text (retry with a recovered index)
+        BLOCK_TOO_LARGE,    // A line would exceed LOG_ARCHIVE_MAX_BLOCK_TEXT_BYTES (keep the text)
+        IO_ERROR
+    };
+
+    eArchiveWriteStatus WriteArchiveWithIndex(std::filesystem::path const& textPath,
+                                              std::filesystem::path const& archivePath,
+                                              LogArchiveIndexBuilder const& index,
+                                              sLogArchiveWriteResult&       outResult,
+                                              String&                       outError)
+    {
+        std::ifstream textFile(textPath, std::ios::binary);
+        std::ofstream archiveFile(archivePath, std::ios::binary | std::ios::trunc);
+        if (!textFile.is_open() || !archiveFile.is_open())
+        {
+            outError = "cannot open " + (textFile.is_open() ? archivePath : textPath).string();
+            return eArchiveWriteStatus::IO_ERROR;
+        }
+
+        std::vector<uint8_t> header;
+        BufferWriter         headerWriter(header);
+        headerWriter.SetEndianMode(eEndianMode::LITTLE);
+        headerWriter.AppendUint32(LOG_ARCHIVE_MAGIC);
+        headerWriter.AppendUint32(LOG_ARCHIVE_VERSION);
+        archiveFile.write(reinterpret_cast<char const*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+        std::vector<sLogArchiveBlock> blocks = index.GetBlocks();
+        std::vector<uint8_t> const&   lineVerbosities = index.GetLineVerbosities();
+        std::vector<char>             raw;
+        std::vector<char>             payload;
+        uint64_t                      fileOffset = LOG_ARCHIVE_HEADER_SIZE;
+        size_t                        lineCursor = 0;
+
+        for (sLogArchiveBlock& block : blocks)
+        {
+            if (lineCursor + block.m_lineCount > lineVerbosities.size())
+            {
+                return eArchiveWriteStatus::INDEX_MISMATCH;
+            }
+            if (block.m_textSize > LOG_ARCHIVE_MAX_BLOCK_TEXT_BYTES)
+            {
+                outError = Stringf("block of %u text bytes exceeds the archive limit: %s", block.m_textSize, textPath.string().c_str());
+                return eArchiveWriteStatus::BLOCK_TOO_LARGE;
+            }
+
+            // Raw block: verbosity byte per line, then the text
+            size_t const rawSize = block.m_lineCount + static_cast<size_t>(block.m_textSize);
+            raw.resize(rawSize);
+            std::memcpy(raw.data(), lineVerbosities.data() + lineCursor, block.m_lineCount);
+            lineCursor += block.m_lineCount;
+
+            textFile.read(raw.data() + block.m_lineCount, static_cast<std::streamsize>(block.m_textSize));
+            if (static_cast<size_t>(textFile.gcount()) != block.m_textSize)
+            {
+                return eArchiveWriteStatus::INDEX_MISMATCH;
+            }
+
+            // Blocks must hold exactly their lines, or the reader would pair lines with the wrong verbosity
+            char const* const blockText = raw.data() + block.m_lineCount;
+            size_t const      lineCount = static_cast<size_t>(std::count(blockText, blockText + block.m_textSize, '\n'))
+                                          + (block.m_textSize != 0 && blockText[block.m_textSize - 1] != '\n' ? 1 : 0);
+            if (lineCount != block.m_lineCount)
+            {
+                return eArchiveWriteStatus::INDEX_MISMATCH;
+            }
+
+            payload.resize(GetLZCompressBound(rawSize));
+            size_t payloadSize = LZCompressBlock(raw.data(), rawSize, payload.data(), payload.size());
+            char const* payloadData = payload.data();
+            if (payloadSize == 0 || payloadSize >= rawSize)
+            {
+                payloadSize   = rawSize;
+                payloadData   = raw.data();
+                block.m_flags |= LOG_ARCHIVE_BLOCK_STORED;
+            }
+
+            block.m_payloadOffset = fileOffset;
+            block.m_payloadSize   = static_cast<uint32_t>(payloadSize);
+            archiveFile.write(payloadData, static_cast<std::streamsize>(payloadSize));
+            fileOffset += payloadSize;
+
+            outResult.m_lineCount += block.m_lineCount;
+        }
+
+        if (textFile.peek() != std::ifstream::traits_type::eof())
+        {
+            return eArchiveWriteStatus::INDEX_MISMATCH;
+        }
+
+        // Index + footer
+        std::vector<uint8_t> indexBytes;
+        BufferWriter         indexWriter(indexBytes);
+        indexWriter.SetEndianMode(eEndianMode::LITTLE);
+        indexWriter.AppendUint32(static_cast<uint32_t>(index.GetCategories().size()));
+        for (String const& category : index.GetCategories())
+        {
+            indexWriter.AppendLengthPrecededString(category);
+        }
+        for (sLogArchiveBlock const& block : blocks)
+        {
+            indexWriter.AppendUint64(block.m_payloadOffset);
+            indexWriter.AppendUint32(block.m_payloadSize);
+            indexWriter.AppendUint32(block.m_textSize);
+            indexWriter.AppendUint32(block.m_lineCount);
+            indexWriter.AppendUint32(block.m_flags);
+            indexWriter.AppendInt64(block.m_firstTimeMs);
+            indexWriter.AppendInt64(block.m_lastTimeMs);
+            indexWriter.AppendUint64(block.m_categoryMask);
+            indexWriter.AppendUint32(block.m_verbosityMask);
+            indexWriter.AppendUint32(0);
+        }
+
+        uint64_t const indexOffset = fileOffset;
+        uint32_t const indexSize   = static_cast<uint32_t>(indexBytes.size());
+        indexWriter.AppendUint64(indexOffset);
+        indexWriter.AppendUint32(indexSize);
+        indexWriter.AppendUint32(static_cast<uint32_t>(blocks.size()));
+        indexWriter.AppendUint32(LOG_ARCHIVE_FOOTER_MAGIC);
+        indexWriter.AppendUint32(LOG_ARCHIVE_VERSION);
+
+        archiveFile.write(reinterpret_cast<char const*>(indexBytes.data()), static_cast<std::streamsize>(indexBytes.size()));
+        archiveFile.flush();
+        if (!archiveFile.good())
+        {
+            outError = "write failed: " + archivePath.string();
+            return eArchiveWriteStatus::IO_ERROR;
+        }
+
+        outResult.m_textBytes    = index.GetTextBytes();
+        outResult.m_archiveBytes = indexOffset + indexBytes.size();
+        outResult.m_blockCount   = blocks.size();
+        return eArchiveWriteStatus::OK;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// LogArchiveIndexBuilder
+//----------------------------------------------------------------------------------------------------
+void LogArchiveIndexBuilder::AddLine(size_t const           lineBytes,
+                                     uint32_t const         physicalLineCount,
+                                     int64_t const          timeMs,
+                                     std::string_view const category,
+                                     eLogVerbosity const    verbosity)
+{
+    AddLineInternal(lineBytes, physicalLineCount, timeMs, category, static_cast<uint8_t>(verbosity));
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogArchiveIndexBuilder::AddRecoveredLine(size_t const lineBytes, int64_t const timeMs, std::string_view const category)
+{
+    AddLineInternal(lineBytes, 1, timeMs, category, LOG_ARCHIVE_UNKNOWN_VERBOSITY);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogArchiveIndexBuilder::AddLineInternal(size_t const           lineBytes,
+                                             uint32_t const         physicalLineCount,
+                                             int64_t const          timeMs,
+                                             std::string_view const category,
+                                             uint8_t const          verbosity)
+{
+    if (m_blocks.empty() || m_blocks.back().m_textSize >= LOG_ARCHIVE_BLOCK_TEXT_BYTES)
+    {
+        m_blocks.emplace_back();
+    }
+
+    // Consecutive lines mostly share a category: check the last one before hashing
+    if (m_lastCategoryIndex < 0 || m_categories[static_cast<size_t>(m_lastCategoryIndex)] != category)
+    {
+        String      name(category);
+        auto const  found = m_categoryIndices.find(name);
+        if (found != m_categoryIndices.end())
+        {
+            m_lastCategoryIndex = found->second;
+        }
+        else
+        {
+            m_lastCategoryIndex = static_cast<int>(m_categories.size());
+            m_categoryIndices.emplace(name, m_lastCategoryIndex);
+            m_categories.push_back(std::move(name));
+        }
+    }
+
+    sLogArchiveBlock& block = m_blocks.back();
+    block.m_textSize       += static_cast<uint32_t>(lineBytes);
+    block.m_lineCount      += physicalLineCount;
+    block.m_firstTimeMs     = (std::min)(block.m_firstTimeMs, timeMs);
+    block.m_lastTimeMs      = (std::max)(block.m_lastTimeMs, timeMs);
+    block.m_categoryMask   |= GetCategoryBit(static_cast<size_t>(m_lastCategoryIndex));
+    block.m_verbosityMask  |= verbosity == LOG_ARCHIVE_UNKNOWN_VERBOSITY ? LOG_ARCHIVE_ALL_VERBOSITIES : 1u << verbosity;
+
+    m_lineVerbosities.insert(m_lineVerbosities.end(), physicalLineCount, verbosity);
+    m_textBytes += lineBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogArchiveIndexBuilder::Reset()
+{
+    m_blocks.clear();
+    m_categories.clear();
+    m_categoryIndices.clear();
+    m_lineVerbosities.clear();
+    m_textBytes         = 0;
+    m_lastCategoryIndex = -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogArchiveIndexBuilder::ShiftTimes(int64_t const deltaMs)
+{
+    for (sLogArchiveBlock& block : m_blocks)
+    {
+        block.m_firstTimeMs += deltaMs;
+        block.m_lastTimeMs  += deltaMs;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// WriteLogArchive
+//----------------------------------------------------------------------------------------------------
+bool WriteLogArchive(std::filesystem::path const& textPath,
+                     std::filesystem::path const& archivePath,
+                     LogArchiveIndexBuilder const* liveIndex,
+                     sLogArchiveWriteResult*       outResult,
+                     String*                       outError)
+{
+    sLogArchiveWriteResult result;
+    String                 error;
+    std::error_code        errorCode;
+    uint64_t const         textBytes = std::filesystem::file_size(textPath, errorCode);
+
+    eArchiveWriteStatus status = eArchiveWriteStatus::INDEX_MISMATCH;
+    if (!errorCode && liveIndex != nullptr && liveIndex->GetTextBytes() == textBytes)
+    {
+        status = WriteArchiveWithIndex(textPath, archivePath, *liveIndex, result, error);
+    }
+
+    // An oversized live block may be a bad index as well: only the recovered index is final
+    if (status == eArchiveWriteStatus::INDEX_MISMATCH || status == eArchiveWriteStatus::BLOCK_TOO_LARGE)
+    {
+        LogArchiveIndexBuilder recoveredIndex;
+        result = sLogArchiveWriteResult{};
+        status = BuildRecoveredIndex(textPath, recoveredIndex, error)
+                     ? WriteArchiveWithIndex(textPath, archivePath, recoveredIndex, result, error)
+                     : eArchiveWriteStatus::IO_ERROR;
+        if (status == eArchiveWriteStatus::INDEX_MISMATCH)
+        {
+            error  = "text changed while archiving: " + textPath.string();
+            status = eArchiveWriteStatus::IO_ERROR;
+        }
+    }
+
+    if (status != eArchiveWriteStatus::OK)
+    {
+        std::filesystem::remove(archivePath, errorCode);
+        if (outError != nullptr)
+        {
+            *outError = error;
+        }
+        return false;
+    }
+
+    if (outResult != nullptr)
+    {
+        *outResult = result;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// LogArchiveReader
+//----------------------------------------------------------------------------------------------------
+bool LogArchiveReader::Open(std::filesystem::path const& archivePath)
+{
+    Close();
+
+    m_file.open(archivePath, std::ios::binary);
+    if (!m_file.is_open())
+    {
+        m_lastError = "cannot open " + archivePath.string();
+        return false;
+    }
+
+    m_file.seekg(0, std::ios::end);
+    uint64_t const fileSize = static_cast<uint64_t>(m_file.tellg());
+    if (fileSize < LOG_ARCHIVE_HEADER_SIZE + LOG_ARCHIVE_FOOTER_SIZE)
+    {
+        m_lastError = "too small for a log archive: " + archivePath.string();
+        Close();
+        return false;
+    }
+
+    uint8_t headerBytes[LOG_ARCHIVE_HEADER_SIZE];
+    uint8_t footerBytes[LOG_ARCHIVE_FOOTER_SIZE];
+    m_file.seekg(0);
+    m_file.read(reinterpret_cast<char*>(headerBytes), sizeof(headerBytes));
+    m_file.seekg(static_cast<std::streamoff>(fileSize - LOG_ARCHIVE_FOOTER_SIZE));
+    m_file.read(reinterpret_cast<char*>(footerBytes), sizeof(footerBytes));
+
+    BufferParser headerParser(headerBytes, sizeof(headerBytes));
+    headerParser.SetEndianMode(eEndianMode::LITTLE);
+    uint32_t const magic   = headerParser.ParseUint32();
+    uint32_t const version = headerParser.ParseUint32();
+
+    BufferParser footerParser(footerBytes, sizeof(footerBytes));
+    footerParser.SetEndianMode(eEndianMode::LITTLE);
+    uint64_t const indexOffset = footerParser.ParseUint64();
+    uint32_t const indexSize   = footerParser.ParseUint32();
+    uint32_t const blockCount  = footerParser.ParseUint32();
+    uint32_t const footerMagic = footerParser.ParseUint32();
+
+    if (!m_file || magic != LOG_ARCHIVE_MAGIC || version != LOG_ARCHIVE_VERSION || footerMagic != LOG_ARCHIVE_FOOTER_MAGIC
+        || indexOffset < LOG_ARCHIVE_HEADER_SIZE || indexOffset + indexSize != fileSize - LOG_ARCHIVE_FOOTER_SIZE
+        || static_cast<uint64_t>(blockCount) * LOG_ARCHIVE_BLOCK_SIZE > indexSize)
+    {
+        m_lastError = "not a log archive, or truncated: " + archivePath.string();
+        Close();
+        return false;
+    }
+
+    std::vector<uint8_t> indexBytes(indexSize);
+    m_file.seekg(static_cast<std::streamoff>(indexOffset));
+    m_file.read(reinterpret_cast<char*>(indexBytes.data()), static_cast<std::streamsize>(indexSize));
+
+    // Sizes are validated before each parse, so a corrupt index fails here rather than in BufferParser
+    BufferParser indexParser(indexBytes);
+    indexParser.SetEndianMode(eEndianMode::LITTLE);
+    uint64_t const categoryBytes = indexSize - static_cast<uint64_t>(blockCount) * LOG_ARCHIVE_BLOCK_SIZE;
+    bool           isValid       = m_file.good() && categoryBytes >= 4;
+
+    uint32_t const categoryCount = isValid ? indexParser.ParseUint32() : 0;
+    for (uint32_t categoryIndex = 0; isValid && categoryIndex < categoryCount; ++categoryIndex)
+    {
+        size_t const position = indexParser.GetCurrentPosition();
+        uint32_t     length   = 0;
+        isValid               = IsRangeInside(position, 4, categoryBytes);
+        if (isValid)
+        {
+            std::memcpy(&length, indexBytes.data() + position, sizeof(length));
+            isValid = IsRangeInside(position + 4, length, categoryBytes);
+        }
+        if (isValid)
+        {
+            indexParser.ParseLengthPrecededString(m_categories.emplace_back());
+        }
+    }
+
+    isValid = isValid && indexParser.GetCurrentPosition() == categoryBytes;
+    m_blocks.resize(isValid ? blockCount : 0);
+    for (sLogArchiveBlock& block : m_blocks)
+    {
+        block.m_payloadOffset = indexParser.ParseUint64();
+        block.m_payloadSize   = indexParser.ParseUint32();
+        block.m_textSize      = indexParser.ParseUint32();
+        block.m_lineCount     = indexParser.ParseUint32();
+        block.m_flags         = indexParser.ParseUint32();
+        block.m_firstTimeMs   = indexParser.ParseInt64();
+        block.m_lastTimeMs    = indexParser.ParseInt64();
+        block.m_categoryMask  = indexParser.ParseUint64();
+        block.m_verbosityMask = indexParser.ParseUint32();
+        indexParser.ParseUint32();
+
+        isValid = isValid && block.m_payloadOffset >= LOG_ARCHIVE_HEADER_SIZE
+                  && IsRangeInside(block.m_payloadOffset, block.m_payloadSize, indexOffset);
+    }
+
+    if (!isValid)
+    {
+        m_lastError = "corrupt log archive index: " + archivePath.string();
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogArchiveReader::Close()
+{
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+    m_file.clear();
+    m_blocks.clear();
+    m_categories.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+int64_t LogArchiveReader::GetFirstTimeMs() const
+{
+    int64_t firstTimeMs = (std::numeric_limits<int64_t>::max)();
+    for (sLogArchiveBlock const& block : m_blocks)
+    {
+        firstTimeMs = (std::min)(firstTimeMs, block.m_firstTimeMs);
+    }
+    return firstTimeMs;
+}
+
+//----------------------------------------------------------------------------------------------------
+int64_t LogArchiveReader::GetLastTimeMs() const
+{
+    int64_t lastTimeMs = (std::numeric_limits<int64_t>::min)();
+    for (sLogArchiveBlock const& block : m_blocks)
+    {
+        lastTimeMs = (std::max)(lastTimeMs, block.m_lastTimeMs);
+    }
+    return lastTimeMs;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool LogArchiveReader::InflateBlock(size_t const blockIndex, uint64_t& inOutBytesRead)
+{
+    if (blockIndex >= m_blocks.size())
+    {
+        m_lastError = Stringf("block %zu out of range", blockIndex);
+        return false;
+    }
+
+    sLogArchiveBlock const& block   = m_blocks[blockIndex];
+    size_t const            rawSize = block.m_lineCount + static_cast<size_t>(block.m_textSize);
+
+    // The index is untrusted: every line holds at least its '\n', and stored or compressed payloads
+    // are never larger than the raw block
+    if (block.m_textSize > LOG_ARCHIVE_MAX_BLOCK_TEXT_BYTES || block.m_lineCount > block.m_textSize || block.m_payloadSize > rawSize)
+    {
+        m_lastError = Stringf("corrupt log archive block %zu (exceeds the block size limit)", blockIndex);
+        return false;
+    }
+
+    m_payload.resize(block.m_payloadSize);
+    m_file.clear();
+    m_file.seekg(static_cast<std::streamoff>(block.m_payloadOffset));
+    m_file.read(m_payload.data(), static_cast<std::streamsize>(block.m_payloadSize));
+    inOutBytesRead += block.m_payloadSize;
+
+    m_inflated.resize(rawSize);
+    bool const isInflated = (block.m_flags & LOG_ARCHIVE_BLOCK_STORED) != 0
+                                ? block.m_payloadSize == rawSize && (std::memcpy(m_inflated.data(), m_payload.data(), rawSize), true)
+                                : LZDecompressBlock(m_payload.data(), m_payload.size(), m_inflated.data(), rawSize);
+
+    if (!m_file.good() || !isInflated)
+    {
+        m_lastError = Stringf("corrupt log archive block %zu", blockIndex);
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool LogArchiveReader::ReadBlock(size_t const blockIndex, String& outText, std::vector<uint8_t>& outVerbosities)
+{
+    uint64_t bytesRead = 0;
+    if (!InflateBlock(blockIndex, bytesRead))
+    {
+        return false;
+    }
+
+    size_t const lineCount = m_blocks[blockIndex].m_lineCount;
+    outVerbosities.assign(m_inflated.begin(), m_inflated.begin() + static_cast<std::ptrdiff_t>(lineCount));
+    outText.assign(m_inflated.data() + lineCount, m_inflated.size() - lineCount);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t LogArchiveReader::Query(sLogArchiveQuery const& query, LogArchiveLineVisitor const& visitor, sLogArchiveQueryStats* outStats)
+{
+    sLogArchiveQueryStats stats;
+    stats.m_blocksTotal = m_blocks.size();
+
+    // Query categories → index bits (names the archive never saw can only be in the overflow bit)
+    uint64_t categoryMask = query.m_categories.empty() ? ~0ull : 0;
+    for (String const& name : query.m_categories)
+    {
+        auto const found = std::find(m_categories.begin(), m_categories.end(), name);
+        categoryMask    |= found != m_categories.end() ? GetCategoryBit(static_cast<size_t>(found - m_categories.begin()))
+                                                        : LOG_ARCHIVE_OTHER_CATEGORY_BIT;
+    }
+
+    for (size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+    {
+        sLogArchiveBlock const& block = m_blocks[blockIndex];
+        if (block.m_lastTimeMs + BLOCK_TIME_SLACK_MS < query.m_beginTimeMs || block.m_firstTimeMs - BLOCK_TIME_SLACK_MS >= query.m_endTimeMs
+            || (block.m_categoryMask & categoryMask) == 0 || (block.m_verbosityMask & query.m_verbosityMask) == 0)
+        {
+            continue;
+        }
+
+        if (!InflateBlock(blockIndex, stats.m_bytesRead))
+        {
+            continue;
+        }
+        ++stats.m_blocksRead;
+
+        // Line times: time of day from the text, date from the block's index time
+        int64_t const midnightMs = GetLocalMidnightMs(block.m_firstTimeMs);
+
+        uint8_t const*   verbosities = reinterpret_cast<uint8_t const*>(m_inflated.data());
+        std::string_view text(m_inflated.data() + block.m_lineCount, block.m_textSize);
+        int64_t          timeMs      = -1;
+        std::string_view category;
+        bool             isCategoryKnown = false;
+
+        for (size_t lineIndex = 0; !text.empty(); ++lineIndex)
+        {
+            size_t const           lineEnd = text.find('\n');
+            std::string_view const line    = text.substr(0, lineEnd);
+            text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+            ++stats.m_linesScanned;
+
+            // Continuation lines of a multi-line message keep the previous line's time and category
+            int64_t const timeOfDay = ParseTimeOfDayMs(line);
+            if (timeOfDay >= 0)
+            {
+                timeMs = midnightMs + timeOfDay;
+                if (timeMs < block.m_firstTimeMs - MS_PER_DAY / 2)
+                {
+                    timeMs += MS_PER_DAY;
+                }
+                category        = ParseCategory(line);
+                isCategoryKnown = true;
+            }
+
+            uint8_t const verbosity = lineIndex < block.m_lineCount ? verbosities[lineIndex] : LOG_ARCHIVE_UNKNOWN_VERBOSITY;
+
+            if (timeMs >= 0 && (timeMs < query.m_beginTimeMs || timeMs >= query.m_endTimeMs))
+            {
+                continue;
+            }
+            if (verbosity != LOG_ARCHIVE_UNKNOWN_VERBOSITY && (verbosity >= 32 || (query.m_verbosityMask & (1u << verbosity)) == 0))
+            {
+                continue;
+            }
+            if (isCategoryKnown && !query.m_categories.empty()
+                && std::find(query.m_categories.begin(), query.m_categories.end(), category) == query.m_categories.end())
+            {
+                continue;
+            }
+
+            ++stats.m_linesMatched;
+            visitor(line, verbosity, timeMs);
+        }
+    }
+
+    if (outStats != nullptr)
+    {
+        *outStats = stats;
+    }
+    return stats.m_linesMatched;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t QueryLogArchiveDirectory(std::filesystem::path const& directory,
+                                sLogArchiveQuery const&      query,
+                                LogArchiveLineVisitor const& visitor,
+                                sLogArchiveQueryStats*       outStats)
+{
+    // Order archives by their first line; only the index is read here
+    std::vector<std::pair<int64_t, std::filesystem::path>> archives;
+    LogArchiveReader                                       reader;
+    std::error_code                                        errorCode;
+
+    for (std::filesystem::recursive_directory_iterator it(directory, errorCode), end; !errorCode && it != end; it.increment(errorCode))
+    {
+        if (it->is_regular_file(errorCode) && it->path().extension() == LOG_ARCHIVE_EXTENSION && reader.Open(it->path()))
+        {
+            if (reader.GetLastTimeMs() + BLOCK_TIME_SLACK_MS >= query.m_beginTimeMs && reader.GetFirstTimeMs() - BLOCK_TIME_SLACK_MS < query.m_endTimeMs)
+            {
+                archives.emplace_back(reader.GetFirstTimeMs(), it->path());
+            }
+        }
+    }
+    std::sort(archives.begin(), archives.end());
+
+    sLogArchiveQueryStats totals;
+    for (auto const& [firstTimeMs, path] : archives)
+    {
+        sLogArchiveQueryStats stats;
+        if (reader.Open(path))
+        {
+            reader.Query(query, visitor, &stats);
+        }
+
+        totals.m_blocksTotal  += stats.m_blocksTotal;
+        totals.m_blocksRead   += stats.m_blocksRead;
+        totals.m_bytesRead    += stats.m_bytesRead;
+        totals.m_linesScanned += stats.m_linesScanned;
+        totals.m_linesMatched += stats.m_linesMatched;
+    }
+
+    if (outStats != nullptr)
+    {
+        *outStats = totals;
+    }
+    return totals.m_linesMatched;
+}
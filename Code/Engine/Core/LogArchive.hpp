@@ -0,0 +1,190 @@
+//----------------------------------------------------------------------------------------------------
+// LogArchive.hpp
+// Engine Core Module - Compressed, Indexed Log Archives
+//
+// Purpose:
+//   Optional archive format for SmartFileOutputDevice rotation (sSmartRotationConfig::compressArchives).
+//   A rotated latest.log becomes a .dlog file: the same lines, block-compressed, plus an index that
+//   lets LogArchiveReader decompress only the blocks a time / category / verbosity query can match.
+//
+// File Layout (.dlog, little-endian):
+//   [header]  magic "DLOG", version
+//   [block payload 0] ... [block payload N-1]   LZCompressBlock() of: one verbosity byte per line,
+//                                               then the line text (stored raw when that is smaller)
+//   [index]   category count, (length, name) per category, then one sLogArchiveBlock per block
+//   [footer]  index offset, index size, block count, magic "DLIX", version; written last
+//
+// Design Rationale:
+//   - Blocks close at the first line boundary past LOG_ARCHIVE_BLOCK_TEXT_BYTES, so every block
+//     decompresses to whole lines and the text stays grep-able once inflated
+//   - Only one very long line can push a block past LOG_ARCHIVE_MAX_BLOCK_TEXT_BYTES; such a file
+//     stays text, so the reader rejects any larger block before allocating for it
+//   - Index per block: time range (Unix epoch ms), category bit mask, verbosity bit mask. Queries
+//     skip blocks on the index, then filter the surviving lines exactly.
+//   - SmartFileOutputDevice builds the index while it writes (LogArchiveIndexBuilder, a few bytes per
+//     block plus one per line), so rotation only compresses. A latest.log without a live index
+//     (previous session, archived at startup) is indexed by parsing its "[HH:MM:SS.mmm][Category]"
+//     prefixes; its verbosity is unknown and matches every verbosity filter.
+//   - Codec is the built-in LZBlockCodec: no third-party dependency
+//
+// Thread Safety:
+//   - WriteLogArchive: no shared state; the rotation thread calls it with latest.log closed
+//   - LogArchiveIndexBuilder / LogArchiveReader: not synchronized; one owner at a time
+//
+// Author: Log Archive Compression
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+enum class eLogVerbosity : int8_t;
+
+//----------------------------------------------------------------------------------------------------
+size_t constexpr   LOG_ARCHIVE_BLOCK_TEXT_BYTES    = 64 * 1024;
+size_t constexpr   LOG_ARCHIVE_MAX_BLOCK_TEXT_BYTES = 16 * 1024 * 1024; // Hard cap per block, written and read
+uint64_t constexpr LOG_ARCHIVE_OTHER_CATEGORY_BIT  = 1ull << 63;    // Category beyond the 63-entry table
+uint32_t constexpr LOG_ARCHIVE_ALL_VERBOSITIES     = 0xFFFFFFFFu;
+uint8_t constexpr  LOG_ARCHIVE_UNKNOWN_VERBOSITY   = 0xFF;          // Per-line byte for recovered text
+uint32_t constexpr LOG_ARCHIVE_BLOCK_STORED        = 1u << 0;       // sLogArchiveBlock::m_flags: payload not compressed
+char constexpr     LOG_ARCHIVE_EXTENSION[]         = ".dlog";
+
+//----------------------------------------------------------------------------------------------------
+// One index entry
+//----------------------------------------------------------------------------------------------------
+struct sLogArchiveBlock
+{
+    uint64_t m_payloadOffset = 0;                                       // From the start of the file
+    uint32_t m_payloadSize   = 0;                                       // Bytes on disk
+    uint32_t m_textSize      = 0;                                       // Line text bytes once inflated
+    uint32_t m_lineCount     = 0;
+    uint32_t m_flags         = 0;
+    int64_t  m_firstTimeMs   = (std::numeric_limits<int64_t>::max)();   // Unix epoch ms
+    int64_t  m_lastTimeMs    = (std::numeric_limits<int64_t>::min)();
+    uint64_t m_categoryMask  = 0;                                       // Bit i = category table entry i
+    uint32_t m_verbosityMask = 0;                                       // Bit v = eLogVerbosity v
+};
+
+//----------------------------------------------------------------------------------------------------
+// Block index of a text log, built one line at a time in write order
+//----------------------------------------------------------------------------------------------------
+class LogArchiveIndexBuilder
+{
+public:
+    // One log entry. lineBytes includes the '\n'; physicalLineCount counts the '\n's (multi-line
+    // messages). timeMs is Unix epoch ms.
+    void AddLine(size_t lineBytes, uint32_t physicalLineCount, int64_t timeMs, std::string_view category, eLogVerbosity verbosity);
+    void AddRecoveredLine(size_t lineBytes, int64_t timeMs, std::string_view category);
+    void Reset();
+
+    // Recovered indexes are built with day-relative times; shift them once the date is known
+    void ShiftTimes(int64_t deltaMs);
+
+    uint64_t                             GetTextBytes() const { return m_textBytes; }
+    std::vector<sLogArchiveBlock> const& GetBlocks() const { return m_blocks; }
+    std::vector<String> const&           GetCategories() const { return m_categories; }
+    std::vector<uint8_t> const&          GetLineVerbosities() const { return m_lineVerbosities; }
+
+private:
+    void AddLineInternal(size_t lineBytes, uint32_t physicalLineCount, int64_t timeMs, std::string_view category, uint8_t verbosity);
+
+    std::vector<sLogArchiveBlock>           m_blocks;            // m_textSize / m_lineCount only; offsets are the writer's
+    std::vector<String>                     m_categories;
+    std::unordered_map<String, int>         m_categoryIndices;
+    std::vector<uint8_t>                    m_lineVerbosities;   // One per physical line
+    uint64_t                                m_textBytes         = 0;
+    int                                     m_lastCategoryIndex = -1;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Compress textPath into archivePath. liveIndex (may be nullptr) must describe textPath exactly;
+// if it is missing or its size disagrees with the file, the text is re-indexed by parsing.
+// On failure archivePath is removed, textPath is untouched and outError says why.
+//----------------------------------------------------------------------------------------------------
+struct sLogArchiveWriteResult
+{
+    uint64_t m_textBytes    = 0;
+    uint64_t m_archiveBytes = 0;
+    size_t   m_blockCount   = 0;
+    size_t   m_lineCount    = 0;
+};
+
+bool WriteLogArchive(std::filesystem::path const& textPath,
+                     std::filesystem::path const& archivePath,
+                     LogArchiveIndexBuilder const* liveIndex,
+                     sLogArchiveWriteResult*       outResult = nullptr,
+                     String*                       outError  = nullptr);
+
+//----------------------------------------------------------------------------------------------------
+// Query
+//----------------------------------------------------------------------------------------------------
+struct sLogArchiveQuery
+{
+    int64_t             m_beginTimeMs   = (std::numeric_limits<int64_t>::min)();    // Inclusive, Unix epoch ms
+    int64_t             m_endTimeMs     = (std::numeric_limits<int64_t>::max)();    // Exclusive
+    std::vector<String> m_categories;                                               // Empty = every category
+    uint32_t            m_verbosityMask = LOG_ARCHIVE_ALL_VERBOSITIES;              // Bit v = include eLogVerbosity v
+};
+
+struct sLogArchiveQueryStats
+{
+    size_t   m_blocksTotal   = 0;
+    size_t   m_blocksRead    = 0;
+    uint64_t m_bytesRead     = 0;   // Compressed payload bytes
+    size_t   m_linesScanned  = 0;
+    size_t   m_linesMatched  = 0;
+};
+
+// line excludes the '\n'. timeMs is -1 when the line has no parseable timestamp.
+// verbosity is LOG_ARCHIVE_UNKNOWN_VERBOSITY for recovered text.
+using LogArchiveLineVisitor = std::function<void(std::string_view line, uint8_t verbosity, int64_t timeMs)>;
+
+//----------------------------------------------------------------------------------------------------
+class LogArchiveReader
+{
+public:
+    bool Open(std::filesystem::path const& archivePath);
+    void Close();
+    bool IsOpen() const { return m_file.is_open(); }
+
+    std::vector<sLogArchiveBlock> const& GetBlocks() const { return m_blocks; }
+    std::vector<String> const&           GetCategories() const { return m_categories; }
+    String const&                        GetLastError() const { return m_lastError; }
+    int64_t                              GetFirstTimeMs() const;
+    int64_t                              GetLastTimeMs() const;
+
+    // Visit matching lines in file order; returns the number visited
+    size_t Query(sLogArchiveQuery const& query, LogArchiveLineVisitor const& visitor, sLogArchiveQueryStats* outStats = nullptr);
+
+    // Inflate one block: line text, and one verbosity byte per line
+    bool ReadBlock(size_t blockIndex, String& outText, std::vector<uint8_t>& outVerbosities);
+
+private:
+    bool InflateBlock(size_t blockIndex, uint64_t& inOutBytesRead);   // Into m_inflated
+
+    std::ifstream                 m_file;
+    std::vector<sLogArchiveBlock> m_blocks;
+    std::vector<String>           m_categories;
+    String                        m_lastError;
+    std::vector<char>             m_payload;      // Scratch
+    std::vector<char>             m_inflated;     // Scratch
+};
+
+// Query every .dlog under directory (recursively, so date folders are included), oldest file first.
+// Archives whose index does not overlap the time range are skipped after reading only their index.
+size_t QueryLogArchiveDirectory(std::filesystem::path const& directory,
+                                sLogArchiveQuery const&      query,
+                                LogArchiveLineVisitor const& visitor,
+                                sLogArchiveQueryStats*       outStats = nullptr);
@@ -0,0 +1,571 @@
+//----------------------------------------------------------------------------------------------------
+// LogFastPath.cpp
+// Engine Core Module - Lock-Free Binary Logging Fast Path Implementation
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LogFastPath.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+std::atomic<int8_t> g_logCategoryEnabledBelow[MAX_LOG_CATEGORY_HANDLES];
+
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    size_t constexpr LOG_RING_CAPACITY    = 64 * 1024;                // Bytes per producer thread
+    size_t constexpr MAX_LOG_RECORD_SIZE  = LOG_RING_CAPACITY / 4;
+    size_t constexpr LOG_RING_WAKE_THRESHOLD = LOG_RING_CAPACITY / 2;
+
+    //------------------------------------------------------------------------------------------------
+    // Category name table (handle -> name)
+    //------------------------------------------------------------------------------------------------
+    struct sLogCategoryNameTable
+    {
+        std::mutex                                  m_mutex;
+        std::array<String, MAX_LOG_CATEGORY_HANDLES> m_names;
+        size_t                                      m_count = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // One single-producer / single-consumer byte ring per logging thread
+    //------------------------------------------------------------------------------------------------
+    struct sLogThreadRing
+    {
+        alignas(64) std::atomic<uint64_t> m_writePosition{0};    // Published by the owning thread
+        uint64_t                          m_pendingStart = 0;    // Owner-only: write position before Begin
+        uint64_t                          m_pendingEnd   = 0;    // Owner-only: write position after Begin
+
+        alignas(64) std::atomic<uint64_t> m_readPosition{0};     // Published by the drain thread
+
+        alignas(64) std::atomic<bool> m_isOwned{true};
+        String                        m_threadId;                // Guarded by the registry mutex
+
+        alignas(LOG_RECORD_ALIGNMENT) unsigned char m_bytes[LOG_RING_CAPACITY];
+    };
+
+    struct sLogRingRegistry
+    {
+        std::mutex                                   m_mutex;
+        std::vector<std::unique_ptr<sLogThreadRing>> m_rings;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Both tables are intentionally never destroyed: worker threads may still log (and thread_local
+    // ring owners may still release their rings) during static destruction.
+    //------------------------------------------------------------------------------------------------
+    sLogCategoryNameTable& GetCategoryNameTable()
+    {
+        static sLogCategoryNameTable* s_table = new sLogCategoryNameTable();
+        return *s_table;
+    }
+
+    sLogRingRegistry& GetRingRegistry()
+    {
+        static sLogRingRegistry* s_registry = new sLogRingRegistry();
+        return *s_registry;
+    }
+
+    std::atomic<bool>     s_isFastPathEnabled{false};
+    std::atomic<uint64_t> s_ringFullCount{0};
+
+    //------------------------------------------------------------------------------------------------
+    // Releases the thread's ring for reuse when the thread exits
+    //------------------------------------------------------------------------------------------------
+    struct sLogThreadRingOwner
+    {
+        sLogThreadRing* m_ring = nullptr;
+
+        ~sLogThreadRingOwner()
+        {
+            if (m_ring != nullptr)
+            {
+                m_ring->m_isOwned.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local sLogThreadRingOwner t_ringOwner;
+
+    //------------------------------------------------------------------------------------------------
+    String GetThisThreadIdText()
+    {
+        std::ostringstream stream;
+        stream << std::this_thread::get_id();
+        return stream.str();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sLogThreadRing* AcquireRingForThisThread()
+    {
+        sLogRingRegistry&           registry = GetRingRegistry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+        // Recycle a ring whose thread has exited and whose records have all been drained
+        for (std::unique_ptr<sLogThreadRing>& ring : registry.m_rings)
+        {
+            if (!ring->m_isOwned.load(std::memory_order_acquire) &&
+                ring->m_readPosition.load(std::memory_order_acquire) == ring->m_writePosition.load(std::memory_order_relaxed))
+            {
+                ring->m_isOwned.store(true, std::memory_order_relaxed);
+                ring->m_threadId = GetThisThreadIdText();
+                return ring.get();
+            }
+        }
+
+        registry.m_rings.push_back(std::make_unique<sLogThreadRing>());
+        registry.m_rings.back()->m_threadId = GetThisThreadIdText();
+        return registry.m_rings.back().get();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Deferred argument decoding
+    //------------------------------------------------------------------------------------------------
+    struct sDecodedLogArg
+    {
+        eLogArgType      m_type = eLogArgType::INT32;
+        uint64_t         m_bits = 0;
+        std::string_view m_text;
+    };
+
+    bool DecodeNextArg(unsigned char const*& cursor, unsigned char const* end, sDecodedLogArg& outArg)
+    {
+        if (cursor >= end)
+        {
+            return false;
+        }
+
+        outArg.m_type = static_cast<eLogArgType>(*cursor++);
+        if (outArg.m_type == eLogArgType::STRING)
+        {
+            uint32_t length;
+            std::memcpy(&length, cursor, sizeof(length));
+            outArg.m_text = std::string_view(reinterpret_cast<char const*>(cursor + sizeof(length)), length);
+            cursor += sizeof(length) + length;
+        }
+        else
+        {
+            std::memcpy(&outArg.m_bits, cursor, sizeof(outArg.m_bits));
+            cursor += sizeof(outArg.m_bits);
+        }
+        return true;
+    }
+
+    double AsDouble(sDecodedLogArg const& arg)
+    {
+        switch (arg.m_type)
+        {
+        case eLogArgType::DOUBLE:
+            {
+                double value;
+                std::memcpy(&value, &arg.m_bits, sizeof(value));
+                return value;
+            }
+        case eLogArgType::INT32:  return static_cast<double>(static_cast<int32_t>(arg.m_bits));
+        case eLogArgType::UINT32: return static_cast<double>(static_cast<uint32_t>(arg.m_bits));
+        case eLogArgType::INT64:  return static_cast<double>(static_cast<int64_t>(arg.m_bits));
+        case eLogArgType::UINT64: return static_cast<double>(arg.m_bits);
+        default:                  return 0.0;
+        }
+    }
+
+    long long AsSigned(sDecodedLogArg const& arg)
+    {
+        switch (arg.m_type)
+        {
+        case eLogArgType::INT32:  return static_cast<int32_t>(arg.m_bits);
+        case eLogArgType::UINT32: return static_cast<uint32_t>(arg.m_bits);
+        case eLogArgType::DOUBLE: return static_cast<long long>(AsDouble(arg));
+        case eLogArgType::STRING: return 0;
+        default:                  return static_cast<long long>(arg.m_bits);
+        }
+    }
+
+    unsigned long long AsUnsigned(sDecodedLogArg const& arg)
+    {
+        switch (arg.m_type)
+        {
+        case eLogArgType::INT32:  return static_cast<uint32_t>(arg.m_bits);    // printf("%u", -1) semantics
+        case eLogArgType::DOUBLE: return static_cast<unsigned long long>(AsDouble(arg));
+        case eLogArgType::STRING: return 0;
+        default:                  return arg.m_bits;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <typename T>
+    void AppendFormatted(String& output, char const* spec, T const value)
+    {
+        char      buffer[256];
+        int const length = std::snprintf(buffer, sizeof(buffer), spec, value);
+        if (length < 0)
+        {
+            return;
+        }
+        if (static_cast<size_t>(length) < sizeof(buffer))
+        {
+            output.append(buffer, static_cast<size_t>(length));
+            return;
+        }
+
+        size_t const start = output.size();
+        output.resize(start + static_cast<size_t>(length) + 1);
+        std::snprintf(output.data() + start, static_cast<size_t>(length) + 1, spec, value);
+        output.resize(start + static_cast<size_t>(length));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Category Handles
+//----------------------------------------------------------------------------------------------------
+LogCategoryHandle FindOrAddLogCategoryHandle(std::string_view const categoryName)
+{
+    sLogCategoryNameTable&      table = GetCategoryNameTable();
+    std::lock_guard<std::mutex> lock(table.m_mutex);
+
+    for (size_t index = 0; index < table.m_count; ++index)
+    {
+        if (table.m_names[index] == categoryName)
+        {
+            return static_cast<LogCategoryHandle>(index);
+        }
+    }
+
+    if (table.m_count == MAX_LOG_CATEGORY_HANDLES)
+    {
+        return INVALID_LOG_CATEGORY_HANDLE;
+    }
+
+    table.m_names[table.m_count] = String(categoryName);
+    return static_cast<LogCategoryHandle>(table.m_count++);
+}
+
+//----------------------------------------------------------------------------------------------------
+String GetLogCategoryHandleName(LogCategoryHandle const handle)
+{
+    sLogCategoryNameTable&      table = GetCategoryNameTable();
+    std::lock_guard<std::mutex> lock(table.m_mutex);
+
+    return handle < table.m_count ? table.m_names[handle] : String();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SetLogCategoryHandleMaxVerbosity(LogCategoryHandle const handle, eLogVerbosity const maxVerbosity)
+{
+    if (handle < MAX_LOG_CATEGORY_HANDLES)
+    {
+        g_logCategoryEnabledBelow[handle].store(static_cast<int8_t>(static_cast<int8_t>(maxVerbosity) + 1), std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void DisableLogCategoryHandle(LogCategoryHandle const handle)
+{
+    if (handle < MAX_LOG_CATEGORY_HANDLES)
+    {
+        g_logCategoryEnabledBelow[handle].store(0, std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void DisableAllLogCategoryHandles()
+{
+    for (std::atomic<int8_t>& enabledBelow : g_logCategoryEnabledBelow)
+    {
+        enabledBelow.store(0, std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Deferred Formatting
+//----------------------------------------------------------------------------------------------------
+String FormatDeferredLogMessage(char const* format, unsigned char const* payload, size_t const payloadSize)
+{
+    String output;
+    if (format == nullptr)
+    {
+        return output;
+    }
+    output.reserve(std::strlen(format) + payloadSize);
+
+    unsigned char const* cursor = payload;
+    unsigned char const* end    = payload + payloadSize;
+    char const*          read   = format;
+
+    while (*read != '\0')
+    {
+        char const* percent = std::strchr(read, '%');
+        if (percent == nullptr)
+        {
+            output.append(read);
+            break;
+        }
+        output.append(read, static_cast<size_t>(percent - read));
+
+        if (percent[1] == '%')
+        {
+            output.push_back('%');
+            read = percent + 2;
+            continue;
+        }
+
+        // Rebuild the conversion spec with '*' resolved and the length modifier normalized
+        String      spec = "%";
+        char const* p    = percent + 1;
+        while (*p != '\0' && std::strchr("-+ #0", *p) != nullptr)
+        {
+            spec.push_back(*p++);
+        }
+        for (int part = 0; part < 2; ++part)
+        {
+            if (part == 1)
+            {
+                if (*p != '.')
+                {
+                    break;
+                }
+                spec.push_back(*p++);
+            }
+            if (*p == '*')
+            {
+                sDecodedLogArg starArg;
+                spec += std::to_string(DecodeNextArg(cursor, end, starArg) ? AsSigned(starArg) : 0);
+                ++p;
+            }
+            while (*p >= '0' && *p <= '9')
+            {
+                spec.push_back(*p++);
+            }
+        }
+        while (*p != '\0' && std::strchr("hljztLIq", *p) != nullptr)
+        {
+            ++p;
+            if (p[-1] == 'I' && ((p[0] == '6' && p[1] == '4') || (p[0] == '3' && p[1] == '2')))
+            {
+                p += 2;    // MSVC I64 / I32
+            }
+        }
+
+        char const conversion = *p;
+        if (conversion == '\0')
+        {
+            output.append(percent);
+            break;
+        }
+        read = p + 1;
+
+        sDecodedLogArg arg;
+        if (conversion == 'n' || !DecodeNextArg(cursor, end, arg))
+        {
+            output.append(percent, static_cast<size_t>(read - percent));
+            continue;
+        }
+
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+            spec += "ll";
+            spec.push_back(conversion);
+            AppendFormatted(output, spec.c_str(), AsSigned(arg));
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            spec += "ll";
+            spec.push_back(conversion);
+            AppendFormatted(output, spec.c_str(), AsUnsigned(arg));
+            break;
+        case 'c':
+            spec.push_back('c');
+            AppendFormatted(output, spec.c_str(), static_cast<int>(AsSigned(arg)));
+            break;
+        case 'p':
+            spec.push_back('p');
+            AppendFormatted(output, spec.c_str(), reinterpret_cast<void const*>(static_cast<uintptr_t>(arg.m_bits)));
+            break;
+        case 's':
+            if (arg.m_type == eLogArgType::STRING)
+            {
+                String const text(arg.m_text);
+                spec.push_back('s');
+                AppendFormatted(output, spec.c_str(), text.c_str());
+            }
+            else
+            {
+                output += std::to_string(AsSigned(arg));
+            }
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            spec.push_back(conversion);
+            AppendFormatted(output, spec.c_str(), AsDouble(arg));
+            break;
+        default:
+            output.append(percent, static_cast<size_t>(read - percent));
+            break;
+        }
+    }
+
+    return output;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Per-Thread Rings
+//----------------------------------------------------------------------------------------------------
+void SetLogFastPathEnabled(bool const isEnabled)
+{
+    s_isFastPathEnabled.store(isEnabled, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool IsLogFastPathEnabled()
+{
+    return s_isFastPathEnabled.load(std::memory_order_acquire);
+}
+
+//----------------------------------------------------------------------------------------------------
+unsigned char* BeginLogRecord(size_t const payloadSize, sLogRecordHeader*& outHeader)
+{
+    if (!s_isFastPathEnabled.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    size_t const recordSize = (sizeof(sLogRecordHeader) + payloadSize + LOG_RECORD_ALIGNMENT - 1) & ~(LOG_RECORD_ALIGNMENT - 1);
+    if (recordSize > MAX_LOG_RECORD_SIZE)
+    {
+        return nullptr;
+    }
+
+    sLogThreadRing* ring = t_ringOwner.m_ring;
+    if (ring == nullptr)
+    {
+        ring               = AcquireRingForThisThread();
+        t_ringOwner.m_ring = ring;
+    }
+
+    uint64_t const start   = ring->m_writePosition.load(std::memory_order_relaxed);
+    uint64_t const read    = ring->m_readPosition.load(std::memory_order_acquire);
+    size_t         offset  = static_cast<size_t>(start % LOG_RING_CAPACITY);
+    size_t const   tail    = LOG_RING_CAPACITY - offset;
+    size_t const   padding = tail < recordSize ? tail : 0;
+
+    if (start + padding + recordSize - read > LOG_RING_CAPACITY)
+    {
+        s_ringFullCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    // Records never straddle the wrap point: pad out the tail and start again at offset 0
+    if (padding != 0)
+    {
+        sLogRecordHeader* paddingHeader = reinterpret_cast<sLogRecordHeader*>(ring->m_bytes + offset);
+        paddingHeader->m_kind           = eLogRecordKind::PADDING;
+        paddingHeader->m_recordSize     = static_cast<uint32_t>(padding);
+        offset                          = 0;
+    }
+
+    sLogRecordHeader* header = reinterpret_cast<sLogRecordHeader*>(ring->m_bytes + offset);
+    header->m_recordSize     = static_cast<uint32_t>(recordSize);
+    header->m_payloadSize    = static_cast<uint32_t>(payloadSize);
+
+    ring->m_pendingStart = start;
+    ring->m_pendingEnd   = start + padding + recordSize;
+
+    outHeader = header;
+    return ring->m_bytes + offset + sizeof(sLogRecordHeader);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool CommitLogRecord()
+{
+    sLogThreadRing* ring = t_ringOwner.m_ring;
+    ring->m_writePosition.store(ring->m_pendingEnd, std::memory_order_release);
+
+    // Pairs with the fence in HasUnreadLogRecords(): either this thread sees the drain that emptied
+    // the ring (and asks for a wake-up), or the log thread sees this record before it goes idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Wake on the first record after a drain, and on the commit that crosses the threshold
+    uint64_t const read = ring->m_readPosition.load(std::memory_order_relaxed);
+    return ring->m_pendingStart == read ||
+           (ring->m_pendingStart - read <= LOG_RING_WAKE_THRESHOLD && ring->m_pendingEnd - read > LOG_RING_WAKE_THRESHOLD);
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t DrainLogThreadRings(LogRecordVisitor const& visitor)
+{
+    sLogRingRegistry&           registry = GetRingRegistry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    size_t drainedCount = 0;
+    for (std::unique_ptr<sLogThreadRing>& ring : registry.m_rings)
+    {
+        uint64_t       read  = ring->m_readPosition.load(std::memory_order_relaxed);
+        uint64_t const write = ring->m_writePosition.load(std::memory_order_acquire);
+
+        while (read < write)
+        {
+            sLogRecordHeader const* header = reinterpret_cast<sLogRecordHeader const*>(ring->m_bytes + read % LOG_RING_CAPACITY);
+            if (header->m_kind != eLogRecordKind::PADDING)
+            {
+                visitor(*header, reinterpret_cast<unsigned char const*>(header) + sizeof(sLogRecordHeader), ring->m_threadId);
+                ++drainedCount;
+            }
+            read += header->m_recordSize;
+        }
+
+        ring->m_readPosition.store(read, std::memory_order_release);
+    }
+
+    return drainedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool HasUnreadLogRecords()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    sLogRingRegistry&           registry = GetRingRegistry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    for (std::unique_ptr<sLogThreadRing> const& ring : registry.m_rings)
+    {
+        if (ring->m_writePosition.load(std::memory_order_acquire) != ring->m_readPosition.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t GetLogFastPathRingFullCount()
+{
+    return s_ringFullCount.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t GetLogThreadRingCount()
+{
+    sLogRingRegistry&           registry = GetRingRegistry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    return static_cast<uint32_t>(registry.m_rings.size());
+}
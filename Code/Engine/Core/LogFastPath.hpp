@@ -0,0 +1,241 @@
+//----------------------------------------------------------------------------------------------------
+// LogFastPath.hpp
+// Engine Core Module - Lock-Free Binary Logging Fast Path
+//
+// Purpose:
+//   Backing store for the DAEMON_LOG fast path. Producers write compact binary records into a
+//   per-thread lock-free ring; the LogSubsystem log thread drains every ring, formats the records
+//   and hands LogEntry objects to the output devices.
+//
+// Design Rationale:
+//   - Category handles: each DAEMON_LOG call site resolves its category name to a small integer
+//     once (function-local static). The per-call enable check is one relaxed atomic load instead
+//     of hashing the category name.
+//   - Deferred formatting: DAEMON_LOG(Cat, Verbosity, "literal %d", args...) stores the format
+//     pointer and the raw argument bytes; printf-style formatting happens on the log thread.
+//     Pre-formatted messages (the Stringf(...) form) are copied into the record as-is.
+//   - Raw ticks: records carry steady_clock ticks; wall-clock "HH:MM:SS.mmm" text is built on drain
+//   - Per-thread SPSC byte rings: no shared cache line between producer threads, no mutex, no
+//     allocation after a thread's first log call. Rings of exited threads are recycled once empty.
+//
+// Record Layout (ring bytes, RECORD_ALIGNMENT aligned):
+//   [sLogRecordHeader][payload: message text, or encoded arguments]
+//   Encoded argument: [eLogArgType:1][value:8] or [STRING:1][length:4][bytes]
+//
+// Thread Safety:
+//   - BeginLogRecord / CommitLogRecord: calling thread only (its own ring)
+//   - DrainLogThreadRings: single consumer (the LogSubsystem log thread, or Shutdown after join)
+//   - Category handle registration: mutex, once per call site; enable checks are lock-free
+//
+// Author: Logging Fast Path
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+//----------------------------------------------------------------------------------------------------
+enum class eLogVerbosity : int8_t;
+
+//----------------------------------------------------------------------------------------------------
+// Category Handles
+//----------------------------------------------------------------------------------------------------
+using LogCategoryHandle = uint16_t;
+
+size_t constexpr            MAX_LOG_CATEGORY_HANDLES    = 256;
+LogCategoryHandle constexpr INVALID_LOG_CATEGORY_HANDLE = 0xFFFF;
+
+// Per-handle (max enabled verbosity + 1); 0 = category not registered with LogSubsystem
+extern std::atomic<int8_t> g_logCategoryEnabledBelow[MAX_LOG_CATEGORY_HANDLES];
+
+// Resolve a category name to its handle, adding it if new. Returns INVALID_LOG_CATEGORY_HANDLE when
+// the table is full (such categories never pass IsLogCategoryEnabled).
+LogCategoryHandle FindOrAddLogCategoryHandle(std::string_view categoryName);
+String            GetLogCategoryHandleName(LogCategoryHandle handle);
+
+// Called by LogSubsystem when categories are registered, re-configured or cleared
+void SetLogCategoryHandleMaxVerbosity(LogCategoryHandle handle, eLogVerbosity maxVerbosity);
+void DisableLogCategoryHandle(LogCategoryHandle handle);
+void DisableAllLogCategoryHandles();
+
+inline bool IsLogCategoryEnabled(LogCategoryHandle const handle, eLogVerbosity const verbosity)
+{
+    return handle < MAX_LOG_CATEGORY_HANDLES &&
+           static_cast<int8_t>(verbosity) < g_logCategoryEnabledBelow[handle].load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Records
+//----------------------------------------------------------------------------------------------------
+enum class eLogRecordKind : uint8_t
+{
+    PADDING,     // Skips the unused tail of the ring before a wrap
+    TEXT,        // Payload is the finished message text
+    DEFERRED     // Payload is encoded arguments for m_format
+};
+
+struct sLogRecordHeader
+{
+    int64_t           m_ticks;         // steady_clock ticks at the call site
+    char const*       m_format;        // DEFERRED only; must have static storage duration
+    uint32_t          m_recordSize;    // Header + payload, rounded up to RECORD_ALIGNMENT
+    uint32_t          m_payloadSize;
+    LogCategoryHandle m_category;
+    eLogVerbosity     m_verbosity;
+    eLogRecordKind    m_kind;
+    uint8_t           m_argCount;
+};
+
+size_t constexpr LOG_RECORD_ALIGNMENT = 32;
+static_assert(sizeof(sLogRecordHeader) <= LOG_RECORD_ALIGNMENT, "Padding records must fit in any ring remainder");
+
+inline int64_t ReadLogTicks()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Deferred Argument Encoding
+//   Arithmetic, enum, pointer and string arguments. Strings (char const*, String, string_view) are
+//   copied into the record, so they may be temporaries.
+//----------------------------------------------------------------------------------------------------
+enum class eLogArgType : uint8_t
+{
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    DOUBLE,
+    POINTER,
+    STRING
+};
+
+namespace LogArgEncoding
+{
+    template <typename T>
+    constexpr bool IS_STRING_ARG = std::is_same_v<T, char const*> || std::is_same_v<T, char*> ||
+                                   std::is_same_v<T, String> || std::is_same_v<T, std::string_view>;
+
+    template <typename T>
+    std::string_view AsStringView(T const& value)
+    {
+        if constexpr (std::is_same_v<T, char const*> || std::is_same_v<T, char*>)
+        {
+            return value != nullptr ? std::string_view(value) : std::string_view("(null)");
+        }
+        else
+        {
+            return std::string_view(value);
+        }
+    }
+
+    template <typename T>
+    size_t GetEncodedSize(T const& value)
+    {
+        using Arg = std::decay_t<T>;
+        if constexpr (IS_STRING_ARG<Arg>)
+        {
+            return 1 + sizeof(uint32_t) + AsStringView<Arg>(value).size();
+        }
+        else
+        {
+            static_assert(std::is_arithmetic_v<Arg> || std::is_enum_v<Arg> || std::is_pointer_v<Arg>,
+                          "DAEMON_LOG deferred arguments must be arithmetic, enum, pointer or string");
+            return 1 + sizeof(uint64_t);
+        }
+    }
+
+    inline unsigned char* WriteTagged(unsigned char* cursor, eLogArgType const type, uint64_t const bits)
+    {
+        *cursor = static_cast<unsigned char>(type);
+        std::memcpy(cursor + 1, &bits, sizeof(bits));
+        return cursor + 1 + sizeof(bits);
+    }
+
+    template <typename T>
+    unsigned char* Encode(unsigned char* cursor, T const& value)
+    {
+        using Arg = std::decay_t<T>;
+        if constexpr (IS_STRING_ARG<Arg>)
+        {
+            std::string_view const text   = AsStringView<Arg>(value);
+            uint32_t const         length = static_cast<uint32_t>(text.size());
+            *cursor                       = static_cast<unsigned char>(eLogArgType::STRING);
+            std::memcpy(cursor + 1, &length, sizeof(length));
+            std::memcpy(cursor + 1 + sizeof(length), text.data(), length);
+            return cursor + 1 + sizeof(length) + length;
+        }
+        else if constexpr (std::is_enum_v<Arg>)
+        {
+            return Encode(cursor, static_cast<std::underlying_type_t<Arg>>(value));
+        }
+        else if constexpr (std::is_pointer_v<Arg>)
+        {
+            return WriteTagged(cursor, eLogArgType::POINTER, reinterpret_cast<uintptr_t>(value));
+        }
+        else if constexpr (std::is_floating_point_v<Arg>)
+        {
+            double   promoted = static_cast<double>(value);
+            uint64_t bits;
+            std::memcpy(&bits, &promoted, sizeof(bits));
+            return WriteTagged(cursor, eLogArgType::DOUBLE, bits);
+        }
+        else if constexpr (sizeof(Arg) <= sizeof(int32_t))
+        {
+            // Default argument promotion: everything narrower than int becomes int
+            bool constexpr IS_UNSIGNED_INT = std::is_unsigned_v<Arg> && sizeof(Arg) == sizeof(int32_t);
+            return IS_UNSIGNED_INT ? WriteTagged(cursor, eLogArgType::UINT32, static_cast<uint32_t>(value))
+                                   : WriteTagged(cursor, eLogArgType::INT32, static_cast<uint64_t>(static_cast<int64_t>(value)));
+        }
+        else
+        {
+            return std::is_unsigned_v<Arg> ? WriteTagged(cursor, eLogArgType::UINT64, static_cast<uint64_t>(value))
+                                           : WriteTagged(cursor, eLogArgType::INT64, static_cast<uint64_t>(static_cast<int64_t>(value)));
+        }
+    }
+}
+
+// printf-style formatting of a DEFERRED payload (log thread, or the ring-full fallback)
+String FormatDeferredLogMessage(char const* format, unsigned char const* payload, size_t payloadSize);
+
+//----------------------------------------------------------------------------------------------------
+// Per-Thread Rings
+//----------------------------------------------------------------------------------------------------
+
+// Master switch, set by LogSubsystem while its log thread is running. When off, BeginLogRecord()
+// returns nullptr and callers take the synchronous LogMessage() path.
+void SetLogFastPathEnabled(bool isEnabled);
+bool IsLogFastPathEnabled();
+
+// Reserve space for one record in the calling thread's ring. Returns a pointer to the payload area
+// (header is filled by the caller through outHeader), or nullptr if the fast path is disabled, the
+// ring is full, or the record is too large for a ring.
+unsigned char* BeginLogRecord(size_t payloadSize, sLogRecordHeader*& outHeader);
+
+// Publish the record reserved by the last BeginLogRecord() on this thread.
+// Returns true (the caller should wake the log thread) for the first record since the ring was last
+// drained, and when the ring is now more than half full.
+bool CommitLogRecord();
+
+// Consume every committed record from every ring, oldest first per ring. threadId is the
+// std::this_thread::get_id() text of the producing thread. Single consumer only.
+using LogRecordVisitor = std::function<void(sLogRecordHeader const& header, unsigned char const* payload, String const& threadId)>;
+size_t DrainLogThreadRings(LogRecordVisitor const& visitor);
+
+// True if any ring holds records not yet drained. The log thread calls this before an untimed wait
+// (ordered against CommitLogRecord(), so a record committed concurrently is either seen here or wakes it).
+bool HasUnreadLogRecords();
+
+// Monitoring
+uint64_t GetLogFastPathRingFullCount();     // Records diverted to the locked path because a ring was full
+uint32_t GetLogThreadRingCount();
@@ -0,0 +1,462 @@
+//----------------------------------------------------------------------------------------------------
+// LogHistory.cpp
+// Engine Core Module - In-Memory Log History Ring
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LogHistory.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LogSubsystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+static_assert(static_cast<size_t>(eLogVerbosity::All) == LOG_HISTORY_VERBOSITY_COUNT - 1);
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t constexpr MAX_TIMESTAMP_BYTES = 255;
+
+    size_t GetVerbosityIndex(eLogVerbosity const verbosity)
+    {
+        return static_cast<size_t>(std::clamp(static_cast<int>(verbosity), 0, static_cast<int>(LOG_HISTORY_VERBOSITY_COUNT) - 1));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// sLogHistoryEntryView
+//----------------------------------------------------------------------------------------------------
+LogEntry sLogHistoryEntryView::ToLogEntry() const
+{
+    LogEntry entry;
+    entry.m_category     = String(m_category);
+    entry.m_verbosity    = m_verbosity;
+    entry.m_message      = String(m_message);
+    entry.m_timestamp    = String(m_timestamp);
+    entry.m_threadId     = String(m_threadId);
+    entry.m_functionName = String(m_functionName);
+    entry.m_fileName     = String(m_fileName);
+    entry.m_lineNum      = m_lineNum;
+    entry.m_ticks        = m_ticks;
+    return entry;
+}
+
+//----------------------------------------------------------------------------------------------------
+// LogSequenceRing
+//----------------------------------------------------------------------------------------------------
+void LogSequenceRing::PushBack(uint64_t const sequence)
+{
+    if (m_size == m_slots.size())
+    {
+        std::vector<uint64_t> grown((std::max)(m_slots.size() * 2, size_t(16)));
+        for (size_t index = 0; index < m_size; ++index)
+        {
+            grown[index] = (*this)[index];
+        }
+        m_slots.swap(grown);
+        m_head = 0;
+    }
+
+    m_slots[(m_head + m_size) & (m_slots.size() - 1)] = sequence;
+    ++m_size;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t LogSequenceRing::LowerBound(uint64_t const sequence) const
+{
+    size_t first = 0;
+    size_t count = m_size;
+    while (count > 0)
+    {
+        size_t const half = count / 2;
+        if ((*this)[first + half] < sequence)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    return first;
+}
+
+//----------------------------------------------------------------------------------------------------
+// LogHistoryView
+//----------------------------------------------------------------------------------------------------
+LogHistoryView::LogHistoryView(LogHistory const& history, sLogHistoryFilter const& filter)
+    : m_history(&history),
+      m_lock(history.m_mutex),
+      m_maxVerbosity((std::min)(static_cast<int>(filter.m_maxVerbosity), static_cast<int>(LOG_HISTORY_VERBOSITY_COUNT) - 1)),
+      m_firstSequence((std::max)(filter.m_firstSequence, history.m_firstSequence))
+{
+    if (m_maxVerbosity < 0)
+    {
+        m_source = eSource::EMPTY;
+    }
+    else if (!filter.m_category.empty())
+    {
+        // A name that was never interned was never logged
+        InternedStringID const categoryId   = FindInternedString(filter.m_category);
+        uint32_t const         categoryName = categoryId != INTERNED_STRING_ID_EMPTY ? history.m_nameRemap.Find(categoryId) : InternedIdRemap::INVALID_INDEX;
+        uint16_t const         categorySlot = categoryName < history.m_categorySlots.size() ? history.m_categorySlots[categoryName] : LogHistory::CATEGORY_SLOT_NONE;
+        if (categorySlot != LogHistory::CATEGORY_SLOT_NONE)
+        {
+            m_source       = eSource::CATEGORY;
+            m_categoryRing = &history.m_categoryRings[categorySlot];
+        }
+    }
+    else
+    {
+        m_source = m_maxVerbosity == static_cast<int>(LOG_HISTORY_VERBOSITY_COUNT) - 1 ? eSource::SEQUENCE : eSource::VERBOSITY;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+LogHistoryView::Iterator LogHistoryView::begin() const
+{
+    Iterator it;
+    it.m_view = this;
+
+    switch (m_source)
+    {
+    case eSource::EMPTY:
+        return it;
+    case eSource::SEQUENCE:
+        it.m_cursors[0] = static_cast<size_t>(m_firstSequence);
+        break;
+    case eSource::CATEGORY:
+        it.m_cursors[0] = m_categoryRing->LowerBound(m_firstSequence);
+        break;
+    case eSource::VERBOSITY:
+        for (int verbosity = 0; verbosity <= m_maxVerbosity; ++verbosity)
+        {
+            it.m_cursors[verbosity] = m_history->m_verbosityRings[verbosity].LowerBound(m_firstSequence);
+        }
+        break;
+    }
+
+    it.FindMatch();
+    return it;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t LogHistoryView::GetCount() const
+{
+    switch (m_source)
+    {
+    case eSource::SEQUENCE:
+        return static_cast<size_t>(m_history->m_nextSequence - m_firstSequence);
+    case eSource::VERBOSITY:
+        {
+            size_t count = 0;
+            for (int verbosity = 0; verbosity <= m_maxVerbosity; ++verbosity)
+            {
+                LogSequenceRing const& ring = m_history->m_verbosityRings[verbosity];
+                count += ring.GetSize() - ring.LowerBound(m_firstSequence);
+            }
+            return count;
+        }
+    case eSource::CATEGORY:
+        if (m_maxVerbosity == static_cast<int>(LOG_HISTORY_VERBOSITY_COUNT) - 1)
+        {
+            return m_categoryRing->GetSize() - m_categoryRing->LowerBound(m_firstSequence);
+        }
+        break;
+    case eSource::EMPTY:
+        return 0;
+    }
+
+    size_t count = 0;
+    for (Iterator it = begin(); it != end(); ++it)
+    {
+        ++count;
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+sLogHistoryEntryView LogHistoryView::Iterator::operator*() const
+{
+    return m_view->m_history->MakeEntryView(m_sequence);
+}
+
+//----------------------------------------------------------------------------------------------------
+LogHistoryView::Iterator& LogHistoryView::Iterator::operator++()
+{
+    if (m_view->m_source == eSource::VERBOSITY)
+    {
+        // Advance the ring the current entry came from
+        LogHistory const& history   = *m_view->m_history;
+        size_t const      verbosity = GetVerbosityIndex(history.GetRecord(m_sequence).m_verbosity);
+        ++m_cursors[verbosity];
+    }
+    else
+    {
+        ++m_cursors[0];
+    }
+
+    FindMatch();
+    return *this;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistoryView::Iterator::FindMatch()
+{
+    LogHistory const& history = *m_view->m_history;
+    m_sequence                = END_SEQUENCE;
+
+    switch (m_view->m_source)
+    {
+    case eSource::EMPTY:
+        break;
+
+    case eSource::SEQUENCE:
+        if (m_cursors[0] < history.m_nextSequence)
+        {
+            m_sequence = m_cursors[0];
+        }
+        break;
+
+    case eSource::CATEGORY:
+        for (LogSequenceRing const& ring = *m_view->m_categoryRing; m_cursors[0] < ring.GetSize(); ++m_cursors[0])
+        {
+            uint64_t const sequence = ring[m_cursors[0]];
+            if (static_cast<int>(history.GetRecord(sequence).m_verbosity) <= m_view->m_maxVerbosity)
+            {
+                m_sequence = sequence;
+                break;
+            }
+        }
+        break;
+
+    case eSource::VERBOSITY:
+        // Oldest head among the selected verbosity rings
+        for (int verbosity = 0; verbosity <= m_view->m_maxVerbosity; ++verbosity)
+        {
+            LogSequenceRing const& ring = history.m_verbosityRings[verbosity];
+            if (m_cursors[verbosity] < ring.GetSize())
+            {
+                m_sequence = (std::min)(m_sequence, ring[m_cursors[verbosity]]);
+            }
+        }
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// LogHistory
+//----------------------------------------------------------------------------------------------------
+LogHistory::LogHistory(size_t const entryCapacity, size_t const textCapacity)
+    : m_records(entryCapacity),
+      m_text((std::min)(textCapacity != 0 ? textCapacity : entryCapacity * LOG_HISTORY_TEXT_BYTES_PER_ENTRY, size_t(UINT32_MAX)))
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistory::Append(LogEntry const& entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    AppendLocked(entry);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistory::Append(std::span<LogEntry const> const entries)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (LogEntry const& entry : entries)
+    {
+        AppendLocked(entry);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistory::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Sequences keep counting so a viewer's remembered position stays meaningful
+    m_firstSequence = m_nextSequence;
+    m_textHead      = 0;
+    for (LogSequenceRing& ring : m_verbosityRings)
+    {
+        ring.Clear();
+    }
+    for (LogSequenceRing& ring : m_categoryRings)
+    {
+        ring.Clear();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+LogHistoryView LogHistory::Query(sLogHistoryFilter const& filter) const
+{
+    return LogHistoryView(*this, filter);
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t LogHistory::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<size_t>(m_nextSequence - m_firstSequence);
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t LogHistory::GetNextSequence() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nextSequence;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistory::AppendLocked(LogEntry const& entry)
+{
+    if (m_records.empty() || m_text.size() < 2)
+    {
+        return;
+    }
+
+    // Text: timestamp '\0' message '\0' (the terminators keep every record at least two bytes, and
+    // let callers hand the message to C APIs). Over-long text is cut to fit the arena.
+    size_t const timestampSize = (std::min)(entry.m_timestamp.size(), (std::min)(MAX_TIMESTAMP_BYTES, m_text.size() - 2));
+    size_t const messageSize   = (std::min)(entry.m_message.size(), m_text.size() - 2 - timestampSize);
+    size_t const textSize      = timestampSize + messageSize + 2;
+
+    if (m_nextSequence - m_firstSequence == m_records.size())
+    {
+        EvictOldestLocked();
+    }
+
+    uint32_t textOffset = 0;
+    while (!TryReserveTextLocked(textSize, textOffset))
+    {
+        EvictOldestLocked();
+    }
+
+    char* const text = m_text.data() + textOffset;
+    std::memcpy(text, entry.m_timestamp.data(), timestampSize);
+    text[timestampSize] = '\0';
+    std::memcpy(text + timestampSize + 1, entry.m_message.data(), messageSize);
+    text[textSize - 1] = '\0';
+    m_textHead         = static_cast<uint32_t>(textOffset + textSize);
+
+    uint32_t const category = InternNameLocked(entry.m_category);
+
+    sLogHistoryRecord& record = m_records[m_nextSequence % m_records.size()];
+    record.m_ticks            = entry.m_ticks;
+    record.m_textOffset       = textOffset;
+    record.m_textSize         = static_cast<uint32_t>(textSize);
+    record.m_category         = category;
+    record.m_threadId         = InternNameLocked(entry.m_threadId);
+    record.m_functionName     = InternNameLocked(entry.m_functionName);
+    record.m_fileName         = InternNameLocked(entry.m_fileName);
+    record.m_lineNum          = entry.m_lineNum;
+    record.m_categorySlot     = GetCategorySlotLocked(category);
+    record.m_timestampSize    = static_cast<uint8_t>(timestampSize);
+    record.m_verbosity        = entry.m_verbosity;
+
+    m_verbosityRings[GetVerbosityIndex(entry.m_verbosity)].PushBack(m_nextSequence);
+    m_categoryRings[record.m_categorySlot].PushBack(m_nextSequence);
+    ++m_nextSequence;
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogHistory::EvictOldestLocked()
+{
+    // The oldest entry is at the front of its index rings, since every ring is in sequence order
+    sLogHistoryRecord const& record = GetRecord(m_firstSequence);
+    m_verbosityRings[GetVerbosityIndex(record.m_verbosity)].PopFront();
+    m_categoryRings[record.m_categorySlot].PopFront();
+    ++m_firstSequence;
+
+    if (m_firstSequence == m_nextSequence)
+    {
+        m_textHead = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool LogHistory::TryReserveTextLocked(size_t const size, uint32_t& outOffset) const
+{
+    if (m_firstSequence == m_nextSequence)
+    {
+        outOffset = 0;
+        return true;
+    }
+
+    // Live text runs from the oldest record to m_textHead, wrapping at most once
+    size_t const tail = GetRecord(m_firstSequence).m_textOffset;
+    if (m_textHead > tail)
+    {
+        if (m_text.size() - m_textHead >= size)
+        {
+            outOffset = m_textHead;
+            return true;
+        }
+        if (tail >= size)
+        {
+            outOffset = 0;      // Wrap; the unused end of the arena is skipped
+            return true;
+        }
+        return false;
+    }
+
+    if (tail - m_textHead >= size)
+    {
+        outOffset = m_textHead;
+        return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t LogHistory::InternNameLocked(std::string_view const name)
+{
+    InternedStringID const id        = InternString(name);
+    uint32_t const         nameIndex = m_nameRemap.FindOrAdd(id);
+    if (nameIndex == m_names.size())
+    {
+        m_names.push_back(GetInternedString(id));
+    }
+    return nameIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint16_t LogHistory::GetCategorySlotLocked(uint32_t const categoryName)
+{
+    if (categoryName >= m_categorySlots.size())
+    {
+        m_categorySlots.resize(static_cast<size_t>(categoryName) + 1, CATEGORY_SLOT_NONE);
+    }
+
+    uint16_t& slot = m_categorySlots[categoryName];
+    if (slot == CATEGORY_SLOT_NONE)
+    {
+        slot = static_cast<uint16_t>(m_categoryRings.size());
+        m_categoryRings.emplace_back();
+    }
+    return slot;
+}
+
+//----------------------------------------------------------------------------------------------------
+sLogHistoryEntryView LogHistory::MakeEntryView(uint64_t const sequence) const
+{
+    sLogHistoryRecord const& record = GetRecord(sequence);
+    char const* const        text   = m_text.data() + record.m_textOffset;
+
+    sLogHistoryEntryView view;
+    view.m_sequence     = sequence;
+    view.m_ticks        = record.m_ticks;
+    view.m_verbosity    = record.m_verbosity;
+    view.m_category     = m_names[record.m_category];
+    view.m_message      = std::string_view(text + record.m_timestampSize + 1, record.m_textSize - record.m_timestampSize - 2);
+    view.m_timestamp    = std::string_view(text, record.m_timestampSize);
+    view.m_threadId     = m_names[record.m_threadId];
+    view.m_functionName = m_names[record.m_functionName];
+    view.m_fileName     = m_names[record.m_fileName];
+    view.m_lineNum      = record.m_lineNum;
+    return view;
+}
@@ -0,0 +1,213 @@
+//----------------------------------------------------------------------------------------------------
+// LogHistory.hpp
+// Engine Core Module - In-Memory Log History Ring
+//
+// Purpose:
+//   The last N log entries kept by LogSubsystem for in-game viewers (DevConsole, ImGui log window).
+//   Viewers poll it every frame, so reads are views over the stored entries, never copies.
+//
+// Design Rationale:
+//   - Fixed-capacity ring of compact records (sLogHistoryRecord, 40 bytes): category, thread,
+//     function and file names are dense per-history name indices; timestamp + message text live
+//     in one circular text arena. Appending never allocates once the indices have grown to size.
+//     Names resolve through a local index → string_view table, so reading an entry takes no other lock.
+//   - Every entry gets a sequence number (monotonic, never reused). Slot = sequence % capacity;
+//     a viewer that remembers the last sequence it saw can ask for only the newer entries.
+//   - Secondary indices: one sorted sequence ring per category and per verbosity. A category
+//     query walks only that category's entries; a verbosity query merges at most 8 rings.
+//   - The text arena is sized for LOG_HISTORY_TEXT_BYTES_PER_ENTRY on average; when messages run
+//     longer, the oldest entries are evicted before the entry count reaches capacity
+//
+// Thread Safety:
+//   - Append / Clear / Query lock one mutex. A LogHistoryView holds that lock until it is
+//     destroyed: read it and drop it within the frame (the log thread waits to append meanwhile).
+//   - String views from a LogHistoryView are valid while the view lives (interned names forever)
+//
+// Author: Log History Ring
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/InternedString.hpp"
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+enum class eLogVerbosity : int8_t;
+struct LogEntry;
+class LogHistory;
+
+//----------------------------------------------------------------------------------------------------
+size_t constexpr LOG_HISTORY_TEXT_BYTES_PER_ENTRY = 256;
+size_t constexpr LOG_HISTORY_VERBOSITY_COUNT      = 8;      // eLogVerbosity::NoLogging .. VeryVerbose
+
+//----------------------------------------------------------------------------------------------------
+// One entry as seen through a LogHistoryView
+//----------------------------------------------------------------------------------------------------
+struct sLogHistoryEntryView
+{
+    uint64_t         m_sequence  = 0;
+    int64_t          m_ticks     = 0;
+    eLogVerbosity    m_verbosity = {};
+    std::string_view m_category;
+    std::string_view m_message;
+    std::string_view m_timestamp;
+    std::string_view m_threadId;
+    std::string_view m_functionName;
+    std::string_view m_fileName;
+    int              m_lineNum = 0;
+
+    LogEntry ToLogEntry() const;    // Owning copy
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sLogHistoryFilter
+{
+    std::string_view m_category;                                        // Empty = every category
+    eLogVerbosity    m_maxVerbosity  = static_cast<eLogVerbosity>(7);    // Entries with m_verbosity <= this (default eLogVerbosity::All)
+    uint64_t         m_firstSequence = 0;                                // Only entries at or after this sequence
+};
+
+//----------------------------------------------------------------------------------------------------
+// Sorted sequence numbers, FIFO; grows by doubling and never shrinks
+//----------------------------------------------------------------------------------------------------
+class LogSequenceRing
+{
+public:
+    void PushBack(uint64_t sequence);
+    void PopFront() { m_head = (m_head + 1) & (m_slots.size() - 1); --m_size; }
+    void Clear() { m_head = 0; m_size = 0; }
+
+    size_t   GetSize() const { return m_size; }
+    uint64_t operator[](size_t const index) const { return m_slots[(m_head + index) & (m_slots.size() - 1)]; }
+    size_t   LowerBound(uint64_t sequence) const;     // First index whose sequence >= sequence
+
+private:
+    std::vector<uint64_t> m_slots;                    // Power-of-two size
+    size_t                m_head = 0;
+    size_t                m_size = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Filtered, locked range over a LogHistory (oldest first). Movable, not copyable.
+//----------------------------------------------------------------------------------------------------
+class LogHistoryView
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = sLogHistoryEntryView;
+        using difference_type   = std::ptrdiff_t;
+
+        sLogHistoryEntryView operator*() const;
+        Iterator&            operator++();
+        void                 operator++(int) { ++*this; }
+        bool                 operator==(std::default_sentinel_t) const { return m_sequence == END_SEQUENCE; }
+
+    private:
+        friend class LogHistoryView;
+        static uint64_t constexpr END_SEQUENCE = ~0ull;
+
+        void FindMatch();   // From the cursors to the next matching sequence
+
+        LogHistoryView const*                            m_view     = nullptr;
+        uint64_t                                         m_sequence = END_SEQUENCE;
+        std::array<size_t, LOG_HISTORY_VERBOSITY_COUNT> m_cursors  = {};   // Per index ring (one used unless merging verbosities)
+    };
+
+    Iterator                begin() const;
+    std::default_sentinel_t end() const { return {}; }
+
+    size_t GetCount() const;   // Walks the view
+
+private:
+    friend class LogHistory;
+
+    enum class eSource : uint8_t
+    {
+        EMPTY,          // Unknown category
+        SEQUENCE,       // Every entry from m_firstSequence on
+        CATEGORY,       // One category ring, verbosity checked per record
+        VERBOSITY       // Merge of the rings for verbosities 0..m_maxVerbosity
+    };
+
+    LogHistoryView(LogHistory const& history, sLogHistoryFilter const& filter);
+
+    LogHistory const*            m_history = nullptr;
+    std::unique_lock<std::mutex> m_lock;
+    eSource                      m_source        = eSource::EMPTY;
+    LogSequenceRing const*       m_categoryRing  = nullptr;
+    int                          m_maxVerbosity  = 0;
+    uint64_t                     m_firstSequence = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+class LogHistory
+{
+public:
+    explicit LogHistory(size_t entryCapacity, size_t textCapacity = 0);   // textCapacity 0: capacity * LOG_HISTORY_TEXT_BYTES_PER_ENTRY
+
+    void Append(LogEntry const& entry);
+    void Append(std::span<LogEntry const> entries);    // One lock for the batch
+    void Clear();
+
+    LogHistoryView Query(sLogHistoryFilter const& filter = {}) const;
+
+    size_t   GetCapacity() const { return m_records.size(); }
+    size_t   GetSize() const;
+    uint64_t GetNextSequence() const;   // Sequence the next appended entry will get
+
+private:
+    friend class LogHistoryView;
+
+    static uint16_t constexpr CATEGORY_SLOT_NONE = UINT16_MAX;
+
+    struct sLogHistoryRecord
+    {
+        int64_t          m_ticks         = 0;
+        uint32_t         m_textOffset    = 0;      // Arena: [timestamp]['\0'][message]['\0']
+        uint32_t         m_textSize      = 0;
+        uint32_t         m_category      = 0;      // Into m_names
+        uint32_t         m_threadId      = 0;
+        uint32_t         m_functionName  = 0;
+        uint32_t         m_fileName      = 0;
+        int32_t          m_lineNum       = 0;
+        uint16_t         m_categorySlot  = 0;      // Into m_categoryRings
+        uint8_t          m_timestampSize = 0;
+        eLogVerbosity    m_verbosity     = {};
+    };
+
+    // Callers hold m_mutex
+    void             AppendLocked(LogEntry const& entry);
+    void             EvictOldestLocked();
+    bool             TryReserveTextLocked(size_t size, uint32_t& outOffset) const;
+    uint32_t         InternNameLocked(std::string_view name);
+    uint16_t         GetCategorySlotLocked(uint32_t categoryName);
+
+    sLogHistoryRecord const& GetRecord(uint64_t const sequence) const { return m_records[sequence % m_records.size()]; }
+    sLogHistoryEntryView     MakeEntryView(uint64_t sequence) const;
+
+    mutable std::mutex              m_mutex;
+    std::vector<sLogHistoryRecord>  m_records;
+    std::vector<char>               m_text;
+    uint32_t                        m_textHead      = 0;     // Next free arena byte
+    uint64_t                        m_firstSequence = 0;     // Oldest stored entry
+    uint64_t                        m_nextSequence  = 0;
+
+    std::array<LogSequenceRing, LOG_HISTORY_VERBOSITY_COUNT> m_verbosityRings;
+    std::vector<LogSequenceRing>                             m_categoryRings;
+    std::vector<uint16_t>                                    m_categorySlots;   // By name index; CATEGORY_SLOT_NONE = not a category yet
+    InternedIdRemap                                          m_nameRemap;       // InternedStringID → name index, only for names this history stored
+    std::vector<std::string_view>                            m_names;           // By name index; reads skip the intern table's lock
+};
@@ -12,6 +12,12 @@
 #include "Engine/Core/FileOutputDevice.hpp"
 #include "Engine/Core/OnScreenOutputDevice.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 
@@ -22,6 +28,27 @@ extern HANDLE g_consoleHandle;
 
 LogSubsystem* g_logSubsystem = nullptr;
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // Device type → output target flag (once per device, in AddOutputDevice)
+    eLogOutput GetOutputTargetForDevice(ILogOutputDevice const* device)
+    {
+        if (dynamic_cast<ConsoleOutputDevice const*>(device)) return eLogOutput::Console;
+        if (dynamic_cast<SmartFileOutputDevice const*>(device)) return eLogOutput::File;
+        if (dynamic_cast<FileOutputDevice const*>(device)) return eLogOutput::File;
+        if (dynamic_cast<DebugOutputDevice const*>(device)) return eLogOutput::DebugOutput;
+        if (dynamic_cast<OnScreenOutputDevice const*>(device)) return eLogOutput::OnScreen;
+        if (dynamic_cast<DevConsoleOutputDevice const*>(device)) return eLogOutput::DevConsole;
+        return eLogOutput::None;
+    }
+
+    bool IsEarlierEntry(LogEntry const& a, LogEntry const& b)
+    {
+        return a.m_ticks < b.m_ticks;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 // LogEntry 實作
 //----------------------------------------------------------------------------------------------------
@@ -36,7 +63,8 @@ LogEntry::LogEntry(String const&       category,
       m_message(message),
       m_functionName(functionName),
       m_fileName(fileName),
-      m_lineNum(lineNum)
+      m_lineNum(lineNum),
+      m_ticks(ReadLogTicks())
 {
     if (g_logSubsystem)
     {
@@ -48,6 +76,9 @@ LogEntry::LogEntry(String const&       category,
 //----------------------------------------------------------------------------------------------------
 LogSubsystem::LogSubsystem(sLogSubsystemConfig config)
     : m_config(std::move(config)),
+      m_logHistory(static_cast<size_t>((std::max)(m_config.maxLogEntries, 0))),
+      m_tickBase(ReadLogTicks()),
+      m_wallClockBase(std::chrono::system_clock::now()),
       m_smartFileDevice(nullptr),
       m_isSmartRotationInitialized(false)
 {
@@ -95,7 +126,8 @@ void LogSubsystem::Startup()
             // Create SmartFileOutputDevice with Minecraft-style rotation
             std::unique_ptr<SmartFileOutputDevice> smartDevice = std::make_unique<SmartFileOutputDevice>(
                 m_config.smartRotationConfig.logDirectory,
-                m_config.smartRotationConfig
+                m_config.smartRotationConfig,
+                m_config.flushPolicy
             );
 
             // Keep a pointer for direct access
@@ -111,7 +143,7 @@ void LogSubsystem::Startup()
             // Fallback to regular file output
             if (m_config.enableFile)
             {
-                AddOutputDevice(std::make_unique<FileOutputDevice>(m_config.logFilePath));
+                AddOutputDevice(std::make_unique<FileOutputDevice>(m_config.logFilePath, m_config.flushPolicy));
             }
             m_smartFileDevice            = nullptr;
             m_isSmartRotationInitialized = false;
@@ -120,7 +152,7 @@ void LogSubsystem::Startup()
     else if (m_config.enableFile)
     {
         // Use regular file output device
-        AddOutputDevice(std::make_unique<FileOutputDevice>(m_config.logFilePath));
+        AddOutputDevice(std::make_unique<FileOutputDevice>(m_config.logFilePath, m_config.flushPolicy));
     }
 
     if (m_config.enableDebugOut)
@@ -143,6 +175,9 @@ void LogSubsystem::Startup()
     {
         m_shouldExit = false;
         m_logThread  = std::thread(&LogSubsystem::ProcessLogQueue, this);
+
+        // DAEMON_LOG records go to per-thread rings only while a thread exists to drain them
+        SetLogFastPathEnabled(true);
     }
 
     // 記錄啟動訊息
@@ -172,12 +207,17 @@ void LogSubsystem::Shutdown()
     // This prevents new logs from being queued during shutdown
     bool wasAsyncLogging = m_config.asyncLogging;
     m_config.asyncLogging = false;
+    SetLogFastPathEnabled(false);
 
     // 停止非同步日誌執行緒
     if (m_logThread.joinable())
     {
-        // Set stop flag first, then notify to wake the thread
-        m_shouldExit.store(true, std::memory_order_release);  // Use explicit memory ordering
+        // Set the stop flag under m_queueMutex: the log thread's untimed idle wait checks it under
+        // that lock, so the notify cannot fall between its predicate check and the wait
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_shouldExit.store(true, std::memory_order_release);
+        }
 
         m_logCondition.notify_all();  // Wake up the worker thread immediately
 
@@ -187,10 +227,12 @@ void LogSubsystem::Shutdown()
     // 清理輸出裝置
     FlushAllOutputs();
     m_outputDevices.clear();
+    m_outputDeviceTargets.clear();
 
     // 清理日誌歷史
     ClearLogHistory();
     m_categories.clear();
+    DisableAllLogCategoryHandles();
 
     // This log will be written synchronously since async logging is disabled
     LogMessage("LogCore", eLogVerbosity::Display, "LogSubsystem::Shutdown() finish");
@@ -232,6 +274,8 @@ void LogSubsystem::RegisterCategory(String const& categoryName,
 {
     LogCategory category(categoryName, defaultVerbosity, compileTimeVerbosity, outputTargets);
     m_categories[categoryName] = category;
+
+    SetLogCategoryHandleMaxVerbosity(FindOrAddLogCategoryHandle(categoryName), (std::min)(defaultVerbosity, compileTimeVerbosity));
 }
 
 void LogSubsystem::SetCategoryVerbosity(const String& categoryName, eLogVerbosity verbosity)
@@ -240,6 +284,7 @@ void LogSubsystem::SetCategoryVerbosity(const String& categoryName, eLogVerbosit
     if (it != m_categories.end())
     {
         it->second.defaultVerbosity = verbosity;
+        SetLogCategoryHandleMaxVerbosity(FindOrAddLogCategoryHandle(categoryName), (std::min)(verbosity, it->second.compileTimeVerbosity));
     }
 }
 
@@ -271,32 +316,150 @@ void LogSubsystem::LogMessage(String const&       categoryName,
     if (m_config.asyncLogging)
     {
         // 非同步日誌：加入佇列
+        bool wasQueueEmpty = false;
         {
             std::lock_guard<std::mutex> lock(m_queueMutex);
-            m_logQueue.push(entry);
+            wasQueueEmpty = m_logQueue.empty();
+            m_logQueue.push_back(std::move(entry));
         }
 
-        // Notify the worker thread that a log entry is available
-        m_logCondition.notify_one();
+        // Only the first entry after the log thread's last swap needs to wake it; later ones ride along
+        // (the log thread also appends it to the history, in timestamp order with fast-path records)
+        if (wasQueueEmpty || verbosity <= eLogVerbosity::Error)
+        {
+            WakeLogThread();
+        }
     }
     else
     {
         // 同步日誌：直接輸出
         WriteToOutputDevices(entry);
+
+        // 加入日誌歷史 (限制數量)
+        AppendToLogHistory(entry);
     }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::LogFormatted(LogCategoryHandle const categoryHandle,
+                                eLogVerbosity const     verbosity,
+                                std::string_view const  message)
+{
+    if (!IsLogCategoryEnabled(categoryHandle, verbosity))
+    {
+        return;
+    }
+
+    sLogRecordHeader* header  = nullptr;
+    unsigned char*    payload = BeginLogRecord(message.size(), header);
 
-    // 加入日誌歷史 (限制數量)
+    if (payload == nullptr)
     {
-        std::lock_guard<std::mutex> lock(m_historyMutex);
-        m_logHistory.push_back(entry);
+        // Fast path disabled (sync logging, before Startup / after Shutdown), ring full, or oversized message
+        LogMessage(GetLogCategoryHandleName(categoryHandle), verbosity, String(message));
+        return;
+    }
 
-        if (m_logHistory.size() > static_cast<size_t>(m_config.maxLogEntries))
+    header->m_ticks     = ReadLogTicks();
+    header->m_format    = nullptr;
+    header->m_category  = categoryHandle;
+    header->m_verbosity = verbosity;
+    header->m_kind      = eLogRecordKind::TEXT;
+    header->m_argCount  = 0;
+    std::memcpy(payload, message.data(), message.size());
+    CommitRecordAndWake(verbosity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::CommitRecordAndWake(eLogVerbosity const verbosity)
+{
+    if (CommitLogRecord() || verbosity <= eLogVerbosity::Error)
+    {
+        WakeLogThread();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::WakeLogThread()
+{
+    if (!m_isWakeRequested.exchange(true, std::memory_order_acq_rel))
+    {
+        // Empty critical section: orders the flag against the log thread's predicate check, so the
+        // notify cannot fall between that check and the wait
         {
-            m_logHistory.erase(m_logHistory.begin());
+            std::lock_guard<std::mutex> lock(m_queueMutex);
         }
+        m_logCondition.notify_one();
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::AppendToLogHistory(LogEntry const& entry)
+{
+    m_logHistory.Append(entry);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::AppendToLogHistory(std::span<LogEntry const> const entries)
+{
+    m_logHistory.Append(entries);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::DrainFastPathRecords(std::vector<LogEntry>& outEntries)
+{
+    // Category names are resolved once per handle per drain, not per record
+    std::array<String const*, MAX_LOG_CATEGORY_HANDLES> categoryNames = {};
+    std::vector<String>                                 resolvedNames;
+    resolvedNames.reserve(MAX_LOG_CATEGORY_HANDLES);
+
+    DrainLogThreadRings([&](sLogRecordHeader const& header, unsigned char const* payload, String const& threadId)
+    {
+        if (header.m_category < MAX_LOG_CATEGORY_HANDLES && categoryNames[header.m_category] == nullptr)
+        {
+            resolvedNames.push_back(GetLogCategoryHandleName(header.m_category));
+            categoryNames[header.m_category] = &resolvedNames.back();
+        }
+
+        LogEntry& entry      = outEntries.emplace_back();
+        entry.m_category     = header.m_category < MAX_LOG_CATEGORY_HANDLES ? *categoryNames[header.m_category] : String();
+        entry.m_verbosity    = header.m_verbosity;
+        entry.m_message      = header.m_kind == eLogRecordKind::TEXT
+                                   ? String(reinterpret_cast<char const*>(payload), header.m_payloadSize)
+                                   : FormatDeferredLogMessage(header.m_format, payload, header.m_payloadSize);
+        entry.m_timestamp    = FormatTicksAsTimestamp(header.m_ticks);
+        entry.m_threadId     = m_config.threadIdEnabled ? threadId : String();
+        entry.m_lineNum      = 0;
+        entry.m_ticks        = header.m_ticks;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+String LogSubsystem::FormatTicksAsTimestamp(int64_t const ticks) const
+{
+    if (!m_config.timestampEnabled)
+    {
+        return "";
+    }
+
+    auto const sinceBase = std::chrono::steady_clock::duration(ticks - m_tickBase);
+    auto const wallClock = m_wallClockBase + std::chrono::duration_cast<std::chrono::system_clock::duration>(sinceBase);
+    auto const time_t    = std::chrono::system_clock::to_time_t(wallClock);
+    auto const ms        = std::chrono::duration_cast<std::chrono::milliseconds>(wallClock.time_since_epoch()) % 1000;
+
+    struct tm timeinfo;
+#ifdef _WIN32
+    localtime_s(&timeinfo, &time_t);
+#else
+    localtime_r(&time_t, &timeinfo);
+#endif
+
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d.%03d",
+                  timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec, static_cast<int>(ms.count()));
+    return buffer;
+}
+
 void LogSubsystem::LogMessageIf(bool          condition, const String& categoryName, eLogVerbosity verbosity,
                                 const String& message, const String&   functionName,
                                 const String& fileName, int            lineNumber)
@@ -320,27 +483,26 @@ void LogSubsystem::AddOnScreenMessage(const String& message, float displayTime,
     }
 }
 
+LogHistoryView LogSubsystem::QueryLogHistory(sLogHistoryFilter const& filter) const
+{
+    return m_logHistory.Query(filter);
+}
+
 std::vector<LogEntry> LogSubsystem::GetLogHistory(const String& categoryFilter,
                                                   eLogVerbosity minVerbosity) const
 {
-    std::lock_guard<std::mutex> lock(m_historyMutex);
-    std::vector<LogEntry>       filteredHistory;
-
-    for (const auto& entry : m_logHistory)
-    {
-        // 分類篩選
-        if (!categoryFilter.empty() && entry.m_category != categoryFilter)
-        {
-            continue;
-        }
+    // Category and verbosity filtering walk the history's indices instead of every entry
+    sLogHistoryFilter filter;
+    filter.m_category     = categoryFilter;
+    filter.m_maxVerbosity = minVerbosity;
 
-        // 詳細程度篩選
-        if (entry.m_verbosity > minVerbosity)
-        {
-            continue;
-        }
+    LogHistoryView const  view = m_logHistory.Query(filter);
+    std::vector<LogEntry> filteredHistory;
+    filteredHistory.reserve(view.GetCount());
 
-        filteredHistory.push_back(entry);
+    for (sLogHistoryEntryView const& entry : view)
+    {
+        filteredHistory.push_back(entry.ToLogEntry());
     }
 
     return filteredHistory;
@@ -348,14 +510,14 @@ std::vector<LogEntry> LogSubsystem::GetLogHistory(const String& categoryFilter,
 
 void LogSubsystem::ClearLogHistory()
 {
-    std::lock_guard<std::mutex> lock(m_historyMutex);
-    m_logHistory.clear();
+    m_logHistory.Clear();
 }
 
 void LogSubsystem::AddOutputDevice(std::unique_ptr<ILogOutputDevice> device)
 {
     if (device && device->IsAvailable())
     {
+        m_outputDeviceTargets.push_back(GetOutputTargetForDevice(device.get()));
         m_outputDevices.push_back(std::move(device));
     }
 }
@@ -407,53 +569,105 @@ String LogSubsystem::GetCurrentThreadId() const
 
 void LogSubsystem::ProcessLogQueue()
 {
+    std::vector<LogEntry>     batch;
+    bool                      hasUnflushedWrites = false;
+    std::chrono::milliseconds flushInterval((std::max)(m_config.flushPolicy.flushIntervalMs, 1));
+
     while (!m_shouldExit.load(std::memory_order_acquire))  // Use explicit memory ordering
     {
-        // CRITICAL: Use the SAME mutex for condition variable and queue access
-        // This prevents data race when predicate checks m_logQueue.empty()
-        std::unique_lock<std::mutex> lock(m_queueMutex);
+        int64_t cutoffTicks = 0;
 
-        // Wait for logs to be available or shutdown signal
-        m_logCondition.wait_for(
-            lock,
-            std::chrono::milliseconds(10),  // Timeout after 10ms to check m_shouldExit
-            [this]
+        {
+            // CRITICAL: Use the SAME mutex for condition variable and queue access
+            // This prevents data race when predicate checks m_logQueue.empty()
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+
+            auto const isWorkAvailable = [this]
             {
-                // Predicate: wake up if stopping or if there are logs available
                 // Safe to access m_logQueue here because we hold m_queueMutex
-                return m_shouldExit.load(std::memory_order_acquire) || !m_logQueue.empty();
+                return m_shouldExit.load(std::memory_order_acquire) ||
+                       m_isWakeRequested.load(std::memory_order_acquire) ||
+                       !m_logQueue.empty();
+            };
+
+            if (!batch.empty())
+            {
+                // Entries held back by the last pass: go straight round
+            }
+            else if (hasUnflushedWrites)
+            {
+                // Devices hold buffered lines: come back after one flush interval even if nothing arrives
+                m_logCondition.wait_for(lock, flushInterval, isWorkAvailable);
             }
-        );
+            else if (!HasUnreadLogRecords())
+            {
+                // Idle: no polling. Producers wake us on their first entry / ring record since the last pass.
+                m_logCondition.wait(lock, isWorkAvailable);
+            }
+
+            // Check m_shouldExit again after waking up
+            if (m_shouldExit.load(std::memory_order_acquire))
+            {
+                break;
+            }
+
+            // Entries stamped after this point may still be racing into the queue or a ring; they are
+            // held back to the next pass so both paths come out in timestamp order
+            cutoffTicks = ReadLogTicks();
+            m_isWakeRequested.store(false, std::memory_order_relaxed);
+
+            // Take the whole queue in one swap (the vectors trade capacity, so neither reallocates)
+            if (batch.empty())
+            {
+                batch.swap(m_logQueue);
+            }
+            else
+            {
+                std::move(m_logQueue.begin(), m_logQueue.end(), std::back_inserter(batch));
+                m_logQueue.clear();
+            }
+        }   // Unlock before expensive WriteBatchToOutputDevices
+
+        DrainFastPathRecords(batch);
 
-        // Check m_shouldExit again after waking up
-        if (m_shouldExit.load(std::memory_order_acquire))
+        if (batch.empty())
         {
-            break;
+            // Quiet pass: write out whatever the devices still buffer, then sleep until woken
+            if (hasUnflushedWrites)
+            {
+                FlushAllOutputs();
+                hasUnflushedWrites = false;
+            }
+            continue;
         }
 
-        // Process one log entry if available
-        if (!m_logQueue.empty())
-        {
-            LogEntry entry = m_logQueue.front();
-            m_logQueue.pop();
-            lock.unlock();  // Unlock before expensive WriteToOutputDevices
+        // Interleave both paths in call order
+        std::stable_sort(batch.begin(), batch.end(), IsEarlierEntry);
 
-            WriteToOutputDevices(entry);
-        }
-        else
+        auto const heldBack = std::partition_point(batch.begin(), batch.end(),
+                                                   [cutoffTicks](LogEntry const& entry) { return entry.m_ticks < cutoffTicks; });
+        if (heldBack != batch.begin())
         {
-            lock.unlock();
+            std::span<LogEntry> const ready(batch.data(), static_cast<size_t>(heldBack - batch.begin()));
+            WriteBatchToOutputDevices(ready);
+            AppendToLogHistory(ready);
+            hasUnflushedWrites = true;
         }
+        batch.erase(batch.begin(), heldBack);
     }
 
     // Process remaining log entries after shutdown signal
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    while (!m_logQueue.empty())
     {
-        LogEntry entry = m_logQueue.front();
-        m_logQueue.pop();
-        WriteToOutputDevices(entry);
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        std::move(m_logQueue.begin(), m_logQueue.end(), std::back_inserter(batch));
+        m_logQueue.clear();
     }
+
+    DrainFastPathRecords(batch);
+    std::stable_sort(batch.begin(), batch.end(), IsEarlierEntry);
+
+    WriteBatchToOutputDevices(batch);
+    AppendToLogHistory(batch);
 }
 
 void LogSubsystem::WriteToOutputDevices(const LogEntry& entry)
@@ -465,40 +679,50 @@ void LogSubsystem::WriteToOutputDevices(const LogEntry& entry)
     }
 
     // 檢查輸出目標
-    for (auto& device : m_outputDevices)
+    for (size_t deviceIndex = 0; deviceIndex < m_outputDevices.size(); ++deviceIndex)
     {
-        bool shouldOutput = false;
+        ILogOutputDevice* device = m_outputDevices[deviceIndex].get();
 
-        // 判斷裝置類型並檢查是否應該輸出
-        if (dynamic_cast<ConsoleOutputDevice*>(device.get()))
+        if ((category->outputTargets & m_outputDeviceTargets[deviceIndex]) != eLogOutput::None && device->IsAvailable())
         {
-            shouldOutput = (category->outputTargets & eLogOutput::Console) != eLogOutput::None;
-        }
-        else if (dynamic_cast<SmartFileOutputDevice*>(device.get()))
-        {
-            // SmartFileOutputDevice should receive file output
-            shouldOutput = (category->outputTargets & eLogOutput::File) != eLogOutput::None;
-        }
-        else if (dynamic_cast<FileOutputDevice*>(device.get()))
-        {
-            shouldOutput = (category->outputTargets & eLogOutput::File) != eLogOutput::None;
-        }
-        else if (dynamic_cast<DebugOutputDevice*>(device.get()))
-        {
-            shouldOutput = (category->outputTargets & eLogOutput::DebugOutput) != eLogOutput::None;
-        }
-        else if (dynamic_cast<OnScreenOutputDevice*>(device.get()))
-        {
-            shouldOutput = (category->outputTargets & eLogOutput::OnScreen) != eLogOutput::None;
+            device->WriteLog(entry);
         }
-        else if (dynamic_cast<DevConsoleOutputDevice*>(device.get()))
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LogSubsystem::WriteBatchToOutputDevices(std::span<LogEntry const> const entries)
+{
+    if (entries.empty())
+    {
+        return;
+    }
+
+    // Category lookup once per entry, not once per entry per device
+    m_batchEntryTargets.resize(entries.size());
+    for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+    {
+        LogCategory const* category      = GetCategory(entries[entryIndex].m_category);
+        m_batchEntryTargets[entryIndex] = category ? category->outputTargets : eLogOutput::None;
+    }
+
+    for (size_t deviceIndex = 0; deviceIndex < m_outputDevices.size(); ++deviceIndex)
+    {
+        ILogOutputDevice* device       = m_outputDevices[deviceIndex].get();
+        eLogOutput const  deviceTarget = m_outputDeviceTargets[deviceIndex];
+
+        m_deviceBatch.clear();
+        for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
         {
-            shouldOutput = (category->outputTargets & eLogOutput::DevConsole) != eLogOutput::None;
+            if ((m_batchEntryTargets[entryIndex] & deviceTarget) != eLogOutput::None)
+            {
+                m_deviceBatch.push_back(&entries[entryIndex]);
+            }
         }
 
-        if (shouldOutput && device->IsAvailable())
+        if (!m_deviceBatch.empty() && device->IsAvailable())
         {
-            device->WriteLog(entry);
+            device->WriteLogBatch(m_deviceBatch);
         }
     }
 }
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <span>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -19,6 +20,8 @@
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/ILogOutputDevice.hpp"
+#include "Engine/Core/LogFastPath.hpp"
+#include "Engine/Core/LogHistory.hpp"
 #include "Engine/Core/SmartFileOutputDevice.hpp"
 #include "ThirdParty/json/json.hpp"
 
@@ -102,6 +105,7 @@ struct LogEntry
     String        m_functionName;  // 函數名稱
     String        m_fileName;      // 檔案名稱
     int           m_lineNum;    // 行號
+    int64_t       m_ticks = 0;     // steady_clock ticks at creation (orders fast-path and locked-path entries)
 
     LogEntry() = default;
     LogEntry(String const& category, eLogVerbosity          verbosity, String const& message,
@@ -120,11 +124,14 @@ struct sLogSubsystemConfig
     bool   enableOnScreen   = true;                     // 啟用螢幕輸出
     bool   enableDevConsole = true;                     // 啟用開發者控制台輸出
     bool   asyncLogging     = true;                     // 啟用非同步日誌
-    int    maxLogEntries    = 10000;                    // 記憶體中最大日誌條目數
+    int    maxLogEntries    = 10000;                    // 記憶體中最大日誌條目數 (LogHistory capacity, fixed at construction)
     bool   timestampEnabled = true;                     // 啟用時間戳記
     bool   threadIdEnabled  = true;                     // 啟用執行緒 ID
     bool   autoFlush        = false;                    // 自動重新整理輸出
 
+    // File device write buffering (FileOutputDevice / SmartFileOutputDevice)
+    sLogFlushPolicy flushPolicy;
+
     // Enhanced rotation settings
     bool                 enableSmartRotation = true;                  // 啟用智能日誌輪轉
     String               rotationConfigPath  = "Data/Config/LogRotation.json"; // 輪轉配置檔案路徑
@@ -148,6 +155,11 @@ struct sLogSubsystemConfig
         if (j.contains("threadIdEnabled")) config.threadIdEnabled = j["threadIdEnabled"].get<bool>();
         if (j.contains("autoFlush")) config.autoFlush = j["autoFlush"].get<bool>();
 
+        // Flush policy
+        if (j.contains("flushBytes")) config.flushPolicy.flushBytes = j["flushBytes"].get<size_t>();
+        if (j.contains("flushIntervalMs")) config.flushPolicy.flushIntervalMs = j["flushIntervalMs"].get<int>();
+        if (j.contains("flushOnError")) config.flushPolicy.flushOnError = j["flushOnError"].get<bool>();
+
         // Rotation settings (path only - SmartFileOutputDevice will load the actual config)
         if (j.contains("enableSmartRotation")) config.enableSmartRotation = j["enableSmartRotation"].get<bool>();
         if (j.contains("rotationConfigPath")) config.rotationConfigPath = j["rotationConfigPath"].get<std::string>();
@@ -208,11 +220,69 @@ public:
         LogMessage(categoryName, verbosity, formattedMessage);
     }
 
+    // Fast path (DAEMON_LOG): pre-formatted message text, copied into the calling thread's log ring
+    void LogFormatted(LogCategoryHandle categoryHandle, eLogVerbosity verbosity, std::string_view message);
+
+    // Fast path (DAEMON_LOG): deferred formatting. format must be a string literal (the pointer is
+    // stored and dereferenced later on the log thread); arguments are copied into the record.
+    template <typename... Args>
+        requires (sizeof...(Args) > 0)
+    void LogFormatted(LogCategoryHandle const categoryHandle,
+                      eLogVerbosity const     verbosity,
+                      char const*             format,
+                      Args const&...          args)
+    {
+        if (!IsLogCategoryEnabled(categoryHandle, verbosity))
+        {
+            return;
+        }
+
+        size_t const      payloadSize = (LogArgEncoding::GetEncodedSize(args) + ...);
+        sLogRecordHeader* header      = nullptr;
+        unsigned char*    payload     = BeginLogRecord(payloadSize, header);
+
+        if (payload != nullptr)
+        {
+            header->m_ticks     = ReadLogTicks();
+            header->m_format    = format;
+            header->m_category  = categoryHandle;
+            header->m_verbosity = verbosity;
+            header->m_kind      = eLogRecordKind::DEFERRED;
+            header->m_argCount  = static_cast<uint8_t>(sizeof...(Args));
+            ((payload = LogArgEncoding::Encode(payload, args)), ...);
+            CommitRecordAndWake(verbosity);
+            return;
+        }
+
+        // Fast path disabled or ring full: format now and take the locked path
+        std::vector<unsigned char> encoded(payloadSize);
+        unsigned char*             cursor = encoded.data();
+        ((cursor = LogArgEncoding::Encode(cursor, args)), ...);
+        LogMessage(GetLogCategoryHandleName(categoryHandle), verbosity, FormatDeferredLogMessage(format, encoded.data(), payloadSize));
+    }
+
+    // Pre-formatted String used as a format with arguments (cannot be deferred: the String is a temporary)
+    template <typename... Args>
+        requires (sizeof...(Args) > 0)
+    void LogFormatted(LogCategoryHandle const categoryHandle,
+                      eLogVerbosity const     verbosity,
+                      String const&           format,
+                      Args...                 args)
+    {
+        if (IsLogCategoryEnabled(categoryHandle, verbosity))
+        {
+            LogFormatted(categoryHandle, verbosity, std::string_view(Stringf(format.c_str(), args...)));
+        }
+    }
+
     // 螢幕訊息 (類似 UE 的 AddOnScreenDebugMessage)
     void AddOnScreenMessage(const String& message, float displayTime = 5.0f,
                             const Rgba8&  color                      = Rgba8::WHITE, int uniqueId = -1);
 
     // 日誌歷史存取
+    //   QueryLogHistory: locked view over the stored entries, no copies (per-frame viewers; see LogHistory.hpp)
+    //   GetLogHistory:   owning copies of the same entries (entries with m_verbosity <= minVerbosity)
+    LogHistoryView        QueryLogHistory(sLogHistoryFilter const& filter = {}) const;
     std::vector<LogEntry> GetLogHistory(const String& categoryFilter = "",
                                         eLogVerbosity minVerbosity   = eLogVerbosity::NoLogging) const;
     void ClearLogHistory();
@@ -239,23 +309,46 @@ public:
 private:
     void ProcessLogQueue();
     void WriteToOutputDevices(const LogEntry& entry);
+    void AppendToLogHistory(const LogEntry& entry);
+
+    // Log thread: one call per drain pass; each device gets its filtered entries in one WriteLogBatch()
+    void WriteBatchToOutputDevices(std::span<LogEntry const> entries);
+    void AppendToLogHistory(std::span<LogEntry const> entries);
+
+    // Fast path: wake the log thread on the first record since its last drain, when the calling
+    // thread's ring passes half full, or for Error / Fatal
+    void CommitRecordAndWake(eLogVerbosity verbosity);
+    void WakeLogThread();
+
+    // Convert every record in the per-thread rings to LogEntry objects (log thread)
+    void DrainFastPathRecords(std::vector<LogEntry>& outEntries);
+    String FormatTicksAsTimestamp(int64_t ticks) const;
 
     bool ShouldLog(const String& categoryName, eLogVerbosity verbosity) const;
 
     sLogSubsystemConfig                            m_config;
     std::unordered_map<String, LogCategory>        m_categories;
     std::vector<std::unique_ptr<ILogOutputDevice>> m_outputDevices;
+    std::vector<eLogOutput>                        m_outputDeviceTargets;   // Parallel to m_outputDevices, resolved in AddOutputDevice
 
     // 非同步日誌相關
-    std::queue<LogEntry>      m_logQueue;
+    std::vector<LogEntry>     m_logQueue;         // Swapped out whole by the log thread, once per pass
     mutable std::mutex        m_queueMutex;       // Protects both m_logQueue AND m_logCondition
     std::thread               m_logThread;
     std::atomic<bool>         m_shouldExit{false};
+    std::atomic<bool>         m_isWakeRequested{false};
     std::condition_variable   m_logCondition;    // Condition variable for efficient waiting (uses m_queueMutex)
 
-    // 記憶體中的日誌歷史
-    std::vector<LogEntry> m_logHistory;
-    mutable std::mutex    m_historyMutex;
+    // Log thread scratch for WriteBatchToOutputDevices
+    std::vector<eLogOutput>      m_batchEntryTargets;
+    std::vector<LogEntry const*> m_deviceBatch;
+
+    // 記憶體中的日誌歷史 (internally locked)
+    LogHistory m_logHistory;
+
+    // Fast path raw-tick → wall-clock conversion reference (captured at construction)
+    int64_t                               m_tickBase = 0;
+    std::chrono::system_clock::time_point m_wallClockBase;
 
     // Smart rotation support
     SmartFileOutputDevice* m_smartFileDevice;                      // Pointer to smart file device (if enabled)
@@ -272,18 +365,23 @@ private:
     LogCategory LogCategory##CategoryName(#CategoryName, DefaultVerbosity, CompileTimeVerbosity);
 
 // 基本日誌巨集
+//   The category name resolves to a LogCategoryHandle once per call site; the enable check (category
+//   registered, verbosity allowed) is a relaxed atomic load and happens before Format is evaluated.
+//   With arguments, Format must be a string literal: formatting is deferred to the log thread.
 #define DAEMON_LOG(CategoryName, Verbosity, Format, ...) \
     do { \
-        if (g_logSubsystem && g_logSubsystem->IsCategoryRegistered(#CategoryName)) { \
-            g_logSubsystem->LogFormatted(#CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+        static LogCategoryHandle const s_daemonLogCategoryHandle = FindOrAddLogCategoryHandle(#CategoryName); \
+        if (g_logSubsystem && IsLogCategoryEnabled(s_daemonLogCategoryHandle, Verbosity)) { \
+            g_logSubsystem->LogFormatted(s_daemonLogCategoryHandle, Verbosity, Format, ##__VA_ARGS__); \
         } \
     } while(0)
 
 // 條件日誌巨集
 #define DAEMON_LOG_IF(Condition, CategoryName, Verbosity, Format, ...) \
     do { \
-        if (Condition && g_logSubsystem && g_logSubsystem->IsCategoryRegistered(#CategoryName)) { \
-            g_logSubsystem->LogFormatted(#CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+        static LogCategoryHandle const s_daemonLogCategoryHandle = FindOrAddLogCategoryHandle(#CategoryName); \
+        if ((Condition) && g_logSubsystem && IsLogCategoryEnabled(s_daemonLogCategoryHandle, Verbosity)) { \
+            g_logSubsystem->LogFormatted(s_daemonLogCategoryHandle, Verbosity, Format, ##__VA_ARGS__); \
         } \
     } while(0)
 
@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------------------------------------
+// MPMCCommandQueueBase.hpp
+// Command Queue - Lock-Free Bounded MPMC Template Base
+//
+// Purpose:
+//   Multi-Producer-Multi-Consumer counterpart of CommandQueueBase<T>. Use it when several threads
+//   (KADI websocket, JavaScript worker, resource jobs) feed the same queue.
+//
+// Design Rationale:
+//   - Dmitry Vyukov's bounded MPMC queue: every cell carries a sequence number that tells producers
+//     and consumers whether the cell is free for this lap, full, or still being written
+//   - One CAS per Submit/Consume on the shared position; no locks, no per-command allocation
+//   - Capacity is rounded up to a power of two so wrapping is a mask, not a modulo
+//   - Move-in (Submit(T&&), SubmitBatch) and move-out (ConsumeBatch) avoid deep copies of commands
+//     that own strings or std::any payloads
+//   - SubmitBatch/ConsumeBatch claim a contiguous run of cells with a single CAS and update the
+//     statistics counters once per batch instead of once per command
+//   - Same virtual hooks and monitoring API as CommandQueueBase, so derived queues port unchanged
+//
+// Thread Safety Model:
+//   - Any number of producer threads and consumer threads
+//   - Hooks run on the calling producer/consumer thread and may run concurrently
+//   - A slow producer only delays consumers of its own cell; other cells keep flowing
+//
+// Usage Example:
+//   class MyQueue : public MPMCCommandQueueBase<MyCommand> {
+//   protected:
+//       void OnQueueFull() override { /* optional backpressure handling */ }
+//   };
+//
+//   queue.Submit(std::move(command));                       // Any producer thread
+//   queue.ConsumeAll([](MyCommand& cmd) { Process(cmd); }); // Any consumer thread
+//
+// Author: Command Queue MPMC Variant
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+// Suppress C4324: Structure padding warning for cache-line alignment
+#pragma warning(push)
+#pragma warning(disable: 4324)
+
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+// MPMCCommandQueueBase<CommandType>
+//
+// Template Parameters:
+//   CommandType - Default-constructible, move-assignable command type
+//
+// Memory Ordering:
+//   - Cell sequence load (acquire) / store (release) hands the command payload between threads
+//   - Position CAS is relaxed: the sequence numbers carry all synchronization
+//   - Counters use relaxed: statistics only
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+class MPMCCommandQueueBase
+{
+public:
+	//------------------------------------------------------------------------------------------------
+	// Constants
+	//------------------------------------------------------------------------------------------------
+	static constexpr size_t DEFAULT_CAPACITY = 1024;  // Power of two
+	static constexpr size_t CACHE_LINE_SIZE  = 64;
+
+	//------------------------------------------------------------------------------------------------
+	// Construction / Destruction
+	//------------------------------------------------------------------------------------------------
+
+	// Capacity is rounded up to the next power of two (minimum 2)
+	explicit MPMCCommandQueueBase(size_t capacity = DEFAULT_CAPACITY);
+	virtual ~MPMCCommandQueueBase() = default;
+
+	// Non-copyable, non-movable (contains atomic members)
+	MPMCCommandQueueBase(MPMCCommandQueueBase const&)            = delete;
+	MPMCCommandQueueBase& operator=(MPMCCommandQueueBase const&) = delete;
+	MPMCCommandQueueBase(MPMCCommandQueueBase&&)                 = delete;
+	MPMCCommandQueueBase& operator=(MPMCCommandQueueBase&&)      = delete;
+
+	//------------------------------------------------------------------------------------------------
+	// Producer API (any thread)
+	//------------------------------------------------------------------------------------------------
+
+	// Enqueue one command. Returns false (and calls OnQueueFull) when the queue is full.
+	bool Submit(CommandType const& command);
+	bool Submit(CommandType&& command);
+
+	// Move up to count commands out of commands[] into the queue with one position claim.
+	// Returns the number enqueued (a prefix of commands[]); fewer than count means the queue filled up.
+	size_t SubmitBatch(CommandType* commands, size_t count);
+
+	//------------------------------------------------------------------------------------------------
+	// Consumer API (any thread)
+	//------------------------------------------------------------------------------------------------
+
+	// Move up to maxCount commands out of the queue into out_commands[] (FIFO per claim).
+	// Returns the number of commands written.
+	size_t ConsumeBatch(CommandType* out_commands, size_t maxCount);
+
+	// Process every command that was in the queue when the call started, in place.
+	//
+	// Template Processor Signature:
+	//   void Processor(CommandType& cmd)   (CommandType const& also works; move out if desired)
+	template <typename ProcessorFunc>
+	void ConsumeAll(ProcessorFunc&& processor);
+
+	//------------------------------------------------------------------------------------------------
+	// Monitoring / Debugging (approximate under concurrency)
+	//------------------------------------------------------------------------------------------------
+	size_t   GetCapacity() const { return m_mask + 1; }
+	size_t   GetApproximateSize() const;
+	bool     IsEmpty() const { return GetApproximateSize() == 0; }
+	bool     IsFull() const { return GetApproximateSize() >= GetCapacity(); }
+	uint64_t GetTotalSubmitted() const { return m_totalSubmitted.load(std::memory_order_relaxed); }
+	uint64_t GetTotalConsumed() const { return m_totalConsumed.load(std::memory_order_relaxed); }
+
+protected:
+	//------------------------------------------------------------------------------------------------
+	// Virtual Hooks (same contract as CommandQueueBase)
+	//------------------------------------------------------------------------------------------------
+	virtual void OnSubmit(CommandType const& command) { (void)command; /* Default: no-op */ }
+	virtual void OnConsume(CommandType const& command) { (void)command; /* Default: no-op */ }
+	virtual void OnQueueFull() { /* Default: no-op */ }
+
+private:
+	//------------------------------------------------------------------------------------------------
+	// Cell: sequence == position        -> free for the producer that claims position
+	//       sequence == position + 1    -> full, ready for the consumer that claims position
+	//       sequence == position + size -> freed by the consumer, free for the next lap
+	//------------------------------------------------------------------------------------------------
+	struct sCell
+	{
+		std::atomic<size_t> m_sequence = 0;
+		CommandType         m_command{};
+	};
+
+	// Claim up to maxCount contiguous cells whose sequence equals position + sequenceOffset.
+	// Returns the claimed count and the first claimed position in out_position.
+	size_t ClaimRun(std::atomic<size_t>& position, size_t sequenceOffset, size_t maxCount, size_t& out_position);
+
+	static size_t RoundUpToPowerOfTwo(size_t value);
+
+	std::unique_ptr<sCell[]> m_cells;
+	size_t                   m_mask = 0;
+
+	// Producers CAS m_enqueuePosition, consumers CAS m_dequeuePosition; keep them on separate cache lines
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_enqueuePosition = 0;
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_dequeuePosition = 0;
+
+	alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_totalSubmitted = 0;
+	std::atomic<uint64_t>                          m_totalConsumed  = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Template Implementation
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+MPMCCommandQueueBase<CommandType>::MPMCCommandQueueBase(size_t const capacity)
+{
+	size_t const roundedCapacity = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+	m_cells = std::make_unique<sCell[]>(roundedCapacity);
+	m_mask  = roundedCapacity - 1;
+
+	for (size_t index = 0; index < roundedCapacity; ++index)
+	{
+		m_cells[index].m_sequence.store(index, std::memory_order_relaxed);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// ClaimRun
+//
+// A cell observed in the wanted state for position p cannot change state until some thread claims p,
+// and claiming p requires moving `position` past it - which makes our CAS fail. So checking cells
+// first and claiming the whole run with one CAS is safe.
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+size_t MPMCCommandQueueBase<CommandType>::ClaimRun(std::atomic<size_t>& position, size_t const sequenceOffset, size_t const maxCount, size_t& out_position)
+{
+	size_t currentPosition = position.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		size_t readyCount = 0;
+		bool   isBehind   = false;
+
+		while (readyCount < maxCount)
+		{
+			size_t const   cellPosition = currentPosition + readyCount;
+			size_t const   sequence     = m_cells[cellPosition & m_mask].m_sequence.load(std::memory_order_acquire);
+			intptr_t const difference   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(cellPosition + sequenceOffset);
+
+			if (difference != 0)
+			{
+				// difference > 0 on the first cell: another thread already claimed it, reload position
+				isBehind = (difference > 0 && readyCount == 0);
+				break;
+			}
+			++readyCount;
+		}
+
+		if (readyCount == 0)
+		{
+			if (!isBehind)
+			{
+				return 0;  // Full (producers) or empty (consumers)
+			}
+			currentPosition = position.load(std::memory_order_relaxed);
+			continue;
+		}
+
+		if (position.compare_exchange_weak(currentPosition, currentPosition + readyCount, std::memory_order_relaxed))
+		{
+			out_position = currentPosition;
+			return readyCount;
+		}
+		// CAS failure reloaded currentPosition; rescan
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+bool MPMCCommandQueueBase<CommandType>::Submit(CommandType const& command)
+{
+	CommandType copy = command;
+	return SubmitBatch(&copy, 1) == 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+bool MPMCCommandQueueBase<CommandType>::Submit(CommandType&& command)
+{
+	return SubmitBatch(&command, 1) == 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+size_t MPMCCommandQueueBase<CommandType>::SubmitBatch(CommandType* commands, size_t const count)
+{
+	if (commands == nullptr || count == 0)
+	{
+		return 0;
+	}
+
+	size_t       firstPosition = 0;
+	size_t const claimedCount  = ClaimRun(m_enqueuePosition, 0, count, firstPosition);
+
+	if (claimedCount == 0)
+	{
+		OnQueueFull();
+		return 0;
+	}
+
+	for (size_t index = 0; index < claimedCount; ++index)
+	{
+		size_t const position = firstPosition + index;
+		sCell&       cell     = m_cells[position & m_mask];
+
+		OnSubmit(commands[index]);
+		cell.m_command = std::move(commands[index]);
+		cell.m_sequence.store(position + 1, std::memory_order_release);
+	}
+
+	m_totalSubmitted.fetch_add(claimedCount, std::memory_order_relaxed);
+
+	if (claimedCount < count)
+	{
+		OnQueueFull();
+	}
+
+	return claimedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+size_t MPMCCommandQueueBase<CommandType>::ConsumeBatch(CommandType* out_commands, size_t const maxCount)
+{
+	if (out_commands == nullptr || maxCount == 0)
+	{
+		return 0;
+	}
+
+	size_t       firstPosition = 0;
+	size_t const claimedCount  = ClaimRun(m_dequeuePosition, 1, maxCount, firstPosition);
+
+	for (size_t index = 0; index < claimedCount; ++index)
+	{
+		size_t const position = firstPosition + index;
+		sCell&       cell     = m_cells[position & m_mask];
+
+		OnConsume(cell.m_command);
+		out_commands[index] = std::move(cell.m_command);
+		cell.m_command      = CommandType{};  // Drop moved-from resources before the cell is reused
+		cell.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+	}
+
+	if (claimedCount > 0)
+	{
+		m_totalConsumed.fetch_add(claimedCount, std::memory_order_relaxed);
+	}
+
+	return claimedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// ConsumeAll
+//
+// Bounded by the enqueue position at entry so fast producers cannot keep a consumer here forever.
+// Commands are processed in place and each cell is released as soon as its processor returns.
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+template <typename ProcessorFunc>
+void MPMCCommandQueueBase<CommandType>::ConsumeAll(ProcessorFunc&& processor)
+{
+	static constexpr size_t CONSUME_RUN_LENGTH = 64;
+
+	size_t const stopPosition = m_enqueuePosition.load(std::memory_order_acquire);
+
+	for (;;)
+	{
+		size_t const dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+		if (static_cast<intptr_t>(stopPosition - dequeuePosition) <= 0)
+		{
+			return;
+		}
+
+		size_t const wantedCount   = stopPosition - dequeuePosition < CONSUME_RUN_LENGTH ? stopPosition - dequeuePosition : CONSUME_RUN_LENGTH;
+		size_t       firstPosition = 0;
+		size_t const claimedCount  = ClaimRun(m_dequeuePosition, 1, wantedCount, firstPosition);
+
+		if (claimedCount == 0)
+		{
+			return;  // Remaining commands are still being written (or were taken by other consumers)
+		}
+
+		for (size_t index = 0; index < claimedCount; ++index)
+		{
+			size_t const position = firstPosition + index;
+			sCell&       cell     = m_cells[position & m_mask];
+
+			OnConsume(cell.m_command);
+			processor(cell.m_command);
+			cell.m_command = CommandType{};
+			cell.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+		}
+
+		m_totalConsumed.fetch_add(claimedCount, std::memory_order_relaxed);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+size_t MPMCCommandQueueBase<CommandType>::GetApproximateSize() const
+{
+	size_t const enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+	size_t const dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+
+	return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandType>
+size_t MPMCCommandQueueBase<CommandType>::RoundUpToPowerOfTwo(size_t value)
+{
+	size_t result = 1;
+	while (result < value)
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Design Notes
+//
+// SPSC vs MPMC:
+//   - CommandQueueBase (SPSC) stays the cheapest option for true one-producer/one-consumer queues
+//     (RenderCommandQueue, CallbackQueue, FrameEventQueue)
+//   - MPMCCommandQueueBase costs one CAS per claim instead of a plain store, in exchange for any
+//     number of producers and consumers
+//
+// Batch Claims:
+//   - SubmitBatch/ConsumeBatch/ConsumeAll scan ahead for a run of ready cells and claim the run with
+//     one CAS, so contention on the shared positions drops by the batch length
+//   - Producers in a batch still publish cell-by-cell, so consumers can start on the first commands
+//     while the rest are being written
+//
+// Blocking Behavior:
+//   - Never blocks; a producer preempted between claim and publish stalls only consumers that reach
+//     its cell (ConsumeAll/ConsumeBatch return early rather than spin)
+//----------------------------------------------------------------------------------------------------
+
+// Restore warning settings
+#pragma warning(pop)
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------
+// MemoryMappedFile.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/MemoryMappedFile.hpp"
+//----------------------------------------------------------------------------------------------------
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+//----------------------------------------------------------------------------------------------------
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+//----------------------------------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    : m_fileHandle(std::exchange(other.m_fileHandle, nullptr))
+    , m_mappingHandle(std::exchange(other.m_mappingHandle, nullptr))
+    , m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_fileHandle    = std::exchange(other.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+        m_data          = std::exchange(other.m_data, nullptr);
+        m_size          = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool MemoryMappedFile::Open(String const& fileName)
+{
+    Close();
+
+    HANDLE const fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        Close();
+        return false;
+    }
+
+    HANDLE const mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr)
+    {
+        Close();
+        return false;
+    }
+    m_mappingHandle = mappingHandle;
+
+    void const* const view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    m_data = static_cast<uint8_t const*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MemoryMappedFile::Close()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+    }
+    if (m_mappingHandle != nullptr)
+    {
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+    }
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(m_fileHandle);
+        m_fileHandle = nullptr;
+    }
+    m_size = 0;
+}
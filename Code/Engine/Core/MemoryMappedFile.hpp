@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------
+// MemoryMappedFile.hpp
+//
+// Purpose:
+//   Read-only view of a whole file mapped into the address space. Callers read the bytes in place
+//   (no copy into a heap buffer); pages are faulted in by the OS on first touch and shared with
+//   the file cache.
+//
+// Design Rationale:
+//   - Move-only RAII wrapper around CreateFileMapping / MapViewOfFile; the view stays valid until
+//     Close() or destruction, so anything pointing into GetData() must not outlive the object
+//   - The view base is allocation-granularity aligned (64 KB), so offsets aligned in the file are
+//     aligned in memory
+//   - While mapped, Windows refuses to overwrite or delete the file
+//
+// Thread Safety:
+//   - Open() / Close(): one thread. Reads of GetData() from any thread.
+//
+// Author: Cooked Mesh Format
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+class MemoryMappedFile
+{
+public:
+    MemoryMappedFile() = default;
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile(MemoryMappedFile const&)            = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+    // Map fileName read-only. Fails for missing or empty files. Closes any previous mapping first.
+    bool Open(String const& fileName);
+    void Close();
+
+    bool           IsOpen() const { return m_data != nullptr; }
+    uint8_t const* GetData() const { return m_data; }
+    size_t         GetSize() const { return m_size; }
+
+private:
+    void*          m_fileHandle    = nullptr;
+    void*          m_mappingHandle = nullptr;
+    uint8_t const* m_data          = nullptr;
+    size_t         m_size          = 0;
+};
@@ -6,38 +6,13 @@
 #include "Engine/Core/NamedProperties.hpp"
 
 //----------------------------------------------------------------------------------------------------
-NamedProperties::NamedProperties(NamedProperties const& copyFrom)
-{
-    for (auto const& pair : copyFrom.m_properties)
-    {
-        m_properties[pair.first] = pair.second->Clone();
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-NamedProperties& NamedProperties::operator=(NamedProperties const& assignFrom)
-{
-    if (this != &assignFrom)
-    {
-        m_properties.clear();
-
-        for (auto const& pair : assignFrom.m_properties)
-        {
-            m_properties[pair.first] = pair.second->Clone();
-        }
-    }
-
-    return *this;
-}
-
-//----------------------------------------------------------------------------------------------------
-void NamedProperties::SetValue(std::string const& keyName, char const* value)
+void NamedProperties::SetValue(std::string_view const keyName, char const* value)
 {
     SetValue<std::string>(keyName, std::string(value));
 }
 
 //----------------------------------------------------------------------------------------------------
-std::string NamedProperties::GetValue(std::string const& keyName, char const* defaultValue) const
+std::string NamedProperties::GetValue(std::string_view const keyName, char const* defaultValue) const
 {
     return GetValue<std::string>(keyName, std::string(defaultValue));
 }
@@ -45,6 +20,18 @@ std::string NamedProperties::GetValue(std::string const& keyName, char const* de
 //----------------------------------------------------------------------------------------------------
 void NamedProperties::PopulateFromXmlElementAttributes(XmlElement const& element)
 {
+    // Size the table once instead of growing it while inserting
+    size_t entryCount = 0;
+    for (XmlAttribute const* attribute = element.FirstAttribute(); attribute; attribute = attribute->Next())
+    {
+        ++entryCount;
+    }
+    for (XmlElement const* childElement = element.FirstChildElement(); childElement; childElement = childElement->NextSiblingElement())
+    {
+        ++entryCount;
+    }
+    m_properties.Reserve(m_properties.GetSize() + entryCount);
+
     XmlAttribute const* attribute = element.FirstAttribute();
 
     while (attribute)
@@ -5,69 +5,46 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
-#include "Engine/Core/HashedCaseInsensitiveString.hpp"
+#include "Engine/Core/NamedPropertyTable.hpp"
 #include "Engine/Core/StringUtils.hpp"
 //----------------------------------------------------------------------------------------------------
 #include <map>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/XmlUtils.hpp"
 
+//----------------------------------------------------------------------------------------------------
+// Case-insensitive keys → values of any type, stored type-tagged in a flat NamedPropertyTable.
+// Values read as a different type than they were stored as are parsed when stored as a String
+// (the parsed value is cached, see PropertyParseCache); any other mismatch returns the default.
 //----------------------------------------------------------------------------------------------------
 class NamedProperties
 {
 public:
     NamedProperties() = default;
-    NamedProperties(NamedProperties const& copyFrom);
-    NamedProperties& operator=(NamedProperties const& assignFrom);
+    NamedProperties(NamedProperties const& copyFrom)            = default;
+    NamedProperties& operator=(NamedProperties const& assignFrom) = default;
     ~NamedProperties() = default;
 
     // Template SetValue / GetValue
     template <typename T>
-    void SetValue(std::string const& keyName, T const& value);
+    void SetValue(std::string_view keyName, T const& value);
 
     template <typename T>
-    T GetValue(std::string const& keyName, T const& defaultValue) const;
+    T GetValue(std::string_view keyName, T const& defaultValue) const;
 
     // Explicit char const* overloads (stores as std::string)
-    void        SetValue(std::string const& keyName, char const* value);
-    std::string GetValue(std::string const& keyName, char const* defaultValue) const;
+    void        SetValue(std::string_view keyName, char const* value);
+    std::string GetValue(std::string_view keyName, char const* defaultValue) const;
 
     // Backward compatibility with NamedStrings
     void PopulateFromXmlElementAttributes(XmlElement const& element);
 
 private:
-    //----------------------------------------------------------------------------------------------------
-    // Type-erased property base
-    //----------------------------------------------------------------------------------------------------
-    struct PropertyBase
-    {
-        virtual ~PropertyBase() = default;
-        virtual std::unique_ptr<PropertyBase> Clone() const = 0;
-    };
-
-    //----------------------------------------------------------------------------------------------------
-    // Typed property storage
-    //----------------------------------------------------------------------------------------------------
-    template <typename T>
-    struct TypedProperty : public PropertyBase
-    {
-        T m_value;
-
-        explicit TypedProperty(T const& value)
-            : m_value(value)
-        {
-        }
-
-        std::unique_ptr<PropertyBase> Clone() const override
-        {
-            return std::make_unique<TypedProperty<T>>(m_value);
-        }
-    };
-
-    std::map<HashedCaseInsensitiveString, std::unique_ptr<PropertyBase>> m_properties;
+    NamedPropertyTable m_properties{NamedPropertyTable::eKeyMatch::CASE_INSENSITIVE};
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -108,47 +85,77 @@ template <> inline bool          ParseFromString<bool>(std::string const& str, b
 template <> inline unsigned short ParseFromString<unsigned short>(std::string const& str, unsigned short const& defaultValue) { if (str.empty()) return defaultValue; return static_cast<unsigned short>(std::stoul(str)); }
 template <> inline std::string   ParseFromString<std::string>(std::string const& str, std::string const& /*defaultValue*/)   { return str; }
 
+//----------------------------------------------------------------------------------------------------
+// ParseFromString results that do not depend on the default value (for non-empty text), so they can be cached
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool constexpr IS_PARSE_FROM_STRING_CACHEABLE = IS_PROPERTY_PARSE_CACHEABLE<T> &&
+                                                (HasSetFromText<T>::value ||
+                                                 std::is_same_v<T, float> || std::is_same_v<T, int> ||
+                                                 std::is_same_v<T, bool> || std::is_same_v<T, unsigned short>);
+
 //----------------------------------------------------------------------------------------------------
 // Template implementations
 //----------------------------------------------------------------------------------------------------
 template <typename T>
-void NamedProperties::SetValue(std::string const& keyName, T const& value)
+void NamedProperties::SetValue(std::string_view const keyName, T const& value)
 {
-    HashedCaseInsensitiveString hcisKey(keyName);
-    m_properties[hcisKey] = std::make_unique<TypedProperty<T>>(value);
+    NamedPropertyTable::sEntry& entry = m_properties.FindOrAdd(keyName);
+    entry.m_value.Set(value);
+    entry.m_parseCache.Reset();
 }
 
 //----------------------------------------------------------------------------------------------------
 template <typename T>
-T NamedProperties::GetValue(std::string const& keyName, T const& defaultValue) const
+T NamedProperties::GetValue(std::string_view const keyName, T const& defaultValue) const
 {
     static_assert(!std::is_pointer_v<T>,
         "NamedProperties::GetValue does not support pointer types. "
         "Use std::string instead of char const* for string retrieval.");
 
-    HashedCaseInsensitiveString hcisKey(keyName);
-    auto it = m_properties.find(hcisKey);
+    NamedPropertyTable::sEntry const* const entry = m_properties.Find(keyName);
 
-    if (it == m_properties.end())
+    if (entry == nullptr)
     {
         return defaultValue;
     }
 
     // Try exact type match
-    TypedProperty<T> const* typedProp = dynamic_cast<TypedProperty<T> const*>(it->second.get());
-
-    if (typedProp)
+    if (T const* const typedValue = entry->m_value.TryGet<T>())
     {
-        return typedProp->m_value;
+        return *typedValue;
     }
 
     // Backward compat: if stored as string, try parsing via SetFromText / atof / atoi
-    TypedProperty<std::string> const* stringProp =
-        dynamic_cast<TypedProperty<std::string> const*>(it->second.get());
-
-    if (stringProp)
+    if constexpr (!std::is_same_v<T, std::string>)
     {
-        return ParseFromString<T>(stringProp->m_value, defaultValue);
+        std::string const* const stringValue = entry->m_value.TryGet<std::string>();
+
+        if (stringValue != nullptr)
+        {
+            if constexpr (IS_PARSE_FROM_STRING_CACHEABLE<T>)
+            {
+                T result = defaultValue;
+
+                if (entry->m_parseCache.TryGet(result))
+                {
+                    return result;
+                }
+
+                result = ParseFromString<T>(*stringValue, defaultValue);
+
+                // Primitives parse "" as the default value, which must not be cached
+                if (!stringValue->empty() || HasSetFromText<T>::value)
+                {
+                    entry->m_parseCache.Store(result);
+                }
+                return result;
+            }
+            else
+            {
+                return ParseFromString<T>(*stringValue, defaultValue);
+            }
+        }
     }
 
     // Type mismatch — return default
@@ -0,0 +1,272 @@
+//----------------------------------------------------------------------------------------------------
+// NamedPropertyTable.cpp
+// Engine Core Module - Flat Hashed Key/Value Storage
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/NamedPropertyTable.hpp"
+
+#include "Engine/Core/HashedCaseInsensitiveString.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t constexpr MIN_SLOT_COUNT = 8;
+
+    //------------------------------------------------------------------------------------------------
+    char ToLowerAscii(char const c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    bool EqualsCaseInsensitive(std::string_view const a, std::string_view const b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (ToLowerAscii(a[i]) != ToLowerAscii(b[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// PropertyValue
+//----------------------------------------------------------------------------------------------------
+PropertyValue::PropertyValue(PropertyValue const& copyFrom)
+{
+    if (copyFrom.m_type != nullptr)
+    {
+        copyFrom.m_type->m_copy(m_storage, copyFrom.m_storage);
+        m_type = copyFrom.m_type;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+PropertyValue::PropertyValue(PropertyValue&& moveFrom) noexcept
+{
+    if (moveFrom.m_type != nullptr)
+    {
+        moveFrom.m_type->m_relocate(m_storage, moveFrom.m_storage);
+        m_type          = moveFrom.m_type;
+        moveFrom.m_type = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+PropertyValue& PropertyValue::operator=(PropertyValue const& assignFrom)
+{
+    if (this != &assignFrom)
+    {
+        Clear();
+        if (assignFrom.m_type != nullptr)
+        {
+            assignFrom.m_type->m_copy(m_storage, assignFrom.m_storage);
+            m_type = assignFrom.m_type;
+        }
+    }
+    return *this;
+}
+
+//----------------------------------------------------------------------------------------------------
+PropertyValue& PropertyValue::operator=(PropertyValue&& assignFrom) noexcept
+{
+    if (this != &assignFrom)
+    {
+        Clear();
+        if (assignFrom.m_type != nullptr)
+        {
+            assignFrom.m_type->m_relocate(m_storage, assignFrom.m_storage);
+            m_type            = assignFrom.m_type;
+            assignFrom.m_type = nullptr;
+        }
+    }
+    return *this;
+}
+
+//----------------------------------------------------------------------------------------------------
+PropertyValue::~PropertyValue()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropertyValue::Clear()
+{
+    if (m_type != nullptr)
+    {
+        m_type->m_destroy(m_storage);
+        m_type = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// PropertyParseCache
+//----------------------------------------------------------------------------------------------------
+sPropertyTypeInfo const PropertyParseCache::s_filling = {};
+
+//----------------------------------------------------------------------------------------------------
+PropertyParseCache::PropertyParseCache(PropertyParseCache const& /*copyFrom*/)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+PropertyParseCache& PropertyParseCache::operator=(PropertyParseCache const& /*assignFrom*/)
+{
+    Reset();
+    return *this;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropertyParseCache::Reset()
+{
+    m_type.store(nullptr, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+// NamedPropertyTable
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::NamedPropertyTable(eKeyMatch const keyMatch)
+    : m_keyMatch(keyMatch)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry const* NamedPropertyTable::Find(std::string_view const key) const
+{
+    return Find(key, HashedCaseInsensitiveString::CalcHashForText(key));
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry const* NamedPropertyTable::Find(HashedCaseInsensitiveString const& key) const
+{
+    return Find(key.GetOriginalString(), key.GetHash());
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry const* NamedPropertyTable::Find(std::string_view const key, uint32_t const hash) const
+{
+    if (m_entries.empty())
+    {
+        return nullptr;
+    }
+
+    sIndexSlot const& slot = m_index[FindIndexSlot(key, hash)];
+    return slot.m_entryIndex != 0 ? &m_entries[slot.m_entryIndex - 1] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry& NamedPropertyTable::FindOrAdd(std::string_view const key)
+{
+    return FindOrAdd(key, HashedCaseInsensitiveString::CalcHashForText(key));
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry& NamedPropertyTable::FindOrAdd(HashedCaseInsensitiveString const& key)
+{
+    return FindOrAdd(key.GetOriginalString(), key.GetHash());
+}
+
+//----------------------------------------------------------------------------------------------------
+NamedPropertyTable::sEntry& NamedPropertyTable::FindOrAdd(std::string_view const key, uint32_t const hash)
+{
+    if ((m_entries.size() + 1) * 4 > m_index.size() * 3)
+    {
+        Rehash(m_index.empty() ? MIN_SLOT_COUNT : m_index.size() * 2);
+    }
+
+    sIndexSlot& slot = m_index[FindIndexSlot(key, hash)];
+    if (slot.m_entryIndex == 0)
+    {
+        m_entries.emplace_back().m_key = key;
+        slot.m_hash       = hash;
+        slot.m_entryIndex = static_cast<uint32_t>(m_entries.size());
+    }
+    return m_entries[slot.m_entryIndex - 1];
+}
+
+//----------------------------------------------------------------------------------------------------
+void NamedPropertyTable::Reserve(size_t const entryCount)
+{
+    m_entries.reserve(entryCount);
+
+    size_t slotCount = m_index.empty() ? MIN_SLOT_COUNT : m_index.size();
+    while (entryCount * 4 > slotCount * 3)
+    {
+        slotCount *= 2;
+    }
+
+    if (slotCount != m_index.size())
+    {
+        Rehash(slotCount);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t NamedPropertyTable::FindIndexSlot(std::string_view const key, uint32_t const hash) const
+{
+    size_t const mask = m_index.size() - 1;
+
+    for (size_t index = GetHomeSlot(hash);; index = (index + 1) & mask)
+    {
+        sIndexSlot const& slot = m_index[index];
+        if (slot.m_entryIndex == 0)
+        {
+            return index;   // At most 3/4 full, so every probe ends
+        }
+        if (slot.m_hash != hash)
+        {
+            continue;
+        }
+
+        String const& slotKey = m_entries[slot.m_entryIndex - 1].m_key;
+        bool const    matches = m_keyMatch == eKeyMatch::CASE_SENSITIVE ? std::string_view(slotKey) == key
+                                                                        : EqualsCaseInsensitive(slotKey, key);
+        if (matches)
+        {
+            return index;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Fibonacci hashing: the key hash (31-multiply) is weak in its low bits, so take the high bits of the product
+size_t NamedPropertyTable::GetHomeSlot(uint32_t const hash) const
+{
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> m_slotShift);
+}
+
+//----------------------------------------------------------------------------------------------------
+void NamedPropertyTable::Rehash(size_t const slotCount)
+{
+    std::vector<sIndexSlot> const oldIndex = std::move(m_index);
+    m_index.assign(slotCount, sIndexSlot{});
+
+    m_slotShift = 64;
+    for (size_t count = slotCount; count > 1; count >>= 1)
+    {
+        --m_slotShift;
+    }
+
+    size_t const mask = slotCount - 1;
+    for (sIndexSlot const& oldSlot : oldIndex)
+    {
+        if (oldSlot.m_entryIndex == 0)
+        {
+            continue;
+        }
+
+        size_t index = GetHomeSlot(oldSlot.m_hash);
+        while (m_index[index].m_entryIndex != 0)
+        {
+            index = (index + 1) & mask;
+        }
+        m_index[index] = oldSlot;
+    }
+}
@@ -0,0 +1,288 @@
+//----------------------------------------------------------------------------------------------------
+// NamedPropertyTable.hpp
+// Engine Core Module - Flat Hashed Key/Value Storage
+//
+// Purpose:
+//   Storage behind NamedProperties (any value type, case-insensitive keys) and NamedStrings
+//   (String values, case-sensitive keys). Definitions loaded from XML populate and read these
+//   thousands of times at startup, so lookups and typed reads must not allocate or re-parse.
+//
+// Design Rationale:
+//   - Entries sit densely in one vector (insertion order); a flat open-addressing index of
+//     (hash, entry) pairs finds them (linear probing, at most 3/4 full). The hash is
+//     HashedCaseInsensitiveString::CalcHashForText of the key, computed once per lookup (callers
+//     holding a HashedCaseInsensitiveString or the hash pass it in instead); a case-sensitive table
+//     compares the key bytes exactly after the hash matches. Growing rebuilds only the 8-byte index slots.
+//   - PropertyValue is type-tagged: the tag is the address of a per-type sPropertyTypeInfo, so a
+//     typed read is one pointer compare instead of a dynamic_cast. Values up to
+//     PROPERTY_INLINE_BYTES (ints, floats, Vec2/3/4, Rgba8, FloatRange, ...) live inline in the slot;
+//     larger values are boxed on the heap. std::string is inline in Release (32 bytes on MSVC x64)
+//     but boxed in Debug, where iterator debugging makes it 40 bytes.
+//   - PropertyParseCache: the first typed value parsed out of a String value is kept next to it, so
+//     "1.5,2" is turned into a Vec2 once. Only trivially destructible results of up to
+//     PROPERTY_PARSE_CACHE_BYTES are cached, and only for the first type a value is read as.
+//
+// Thread Safety:
+//   - Same as the standard containers: concurrent const reads are safe, writes need exclusive access.
+//     The parse cache is filled from const reads, so it is published through an atomic type tag:
+//     one reader fills it, the others parse on their own until the tag is visible.
+//
+// Author: Named Property Storage
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+class HashedCaseInsensitiveString;
+
+//----------------------------------------------------------------------------------------------------
+size_t constexpr PROPERTY_INLINE_BYTES      = 32;
+size_t constexpr PROPERTY_INLINE_ALIGN      = 8;
+size_t constexpr PROPERTY_PARSE_CACHE_BYTES = 16;
+
+//----------------------------------------------------------------------------------------------------
+// Per-type operations; its address is the type tag
+//----------------------------------------------------------------------------------------------------
+struct sPropertyTypeInfo
+{
+    void (*m_copy)(void* dstStorage, void const* srcStorage)  = nullptr;   // Construct a copy into raw storage
+    void (*m_relocate)(void* dstStorage, void* srcStorage)    = nullptr;   // Move into raw storage, destroy the source
+    void (*m_destroy)(void* storage)                          = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct PropertyTypeOps
+{
+    static bool constexpr IS_INLINE = sizeof(T) <= PROPERTY_INLINE_BYTES &&
+                                      alignof(T) <= PROPERTY_INLINE_ALIGN &&
+                                      std::is_nothrow_move_constructible_v<T>;
+
+    static T* Get(void* storage)
+    {
+        if constexpr (IS_INLINE) { return std::launder(static_cast<T*>(storage)); }
+        else                     { return *static_cast<T**>(storage); }
+    }
+
+    static void Construct(void* storage, T const& value)
+    {
+        if constexpr (IS_INLINE) { new (storage) T(value); }
+        else                     { *static_cast<T**>(storage) = new T(value); }
+    }
+
+    static void Copy(void* dstStorage, void const* srcStorage)
+    {
+        Construct(dstStorage, *Get(const_cast<void*>(srcStorage)));
+    }
+
+    static void Relocate(void* dstStorage, void* srcStorage)
+    {
+        if constexpr (IS_INLINE)
+        {
+            new (dstStorage) T(std::move(*Get(srcStorage)));
+            Get(srcStorage)->~T();
+        }
+        else
+        {
+            std::memcpy(dstStorage, srcStorage, sizeof(T*));
+        }
+    }
+
+    static void Destroy(void* storage)
+    {
+        if constexpr (IS_INLINE) { Get(storage)->~T(); }
+        else                     { delete Get(storage); }
+    }
+};
+
+template <typename T>
+inline constexpr sPropertyTypeInfo PROPERTY_TYPE_INFO = { &PropertyTypeOps<T>::Copy, &PropertyTypeOps<T>::Relocate, &PropertyTypeOps<T>::Destroy };
+
+//----------------------------------------------------------------------------------------------------
+// One value of any copyable type
+//----------------------------------------------------------------------------------------------------
+class PropertyValue
+{
+public:
+    PropertyValue() = default;
+    PropertyValue(PropertyValue const& copyFrom);
+    PropertyValue(PropertyValue&& moveFrom) noexcept;
+    PropertyValue& operator=(PropertyValue const& assignFrom);
+    PropertyValue& operator=(PropertyValue&& assignFrom) noexcept;
+    ~PropertyValue();
+
+    template <typename T>
+    void Set(T const& value);
+
+    template <typename T>
+    T const* TryGet() const;    // nullptr unless the stored type is exactly T
+
+    bool IsEmpty() const { return m_type == nullptr; }
+    void Clear();
+
+private:
+    sPropertyTypeInfo const* m_type = nullptr;
+    alignas(PROPERTY_INLINE_ALIGN) unsigned char m_storage[PROPERTY_INLINE_BYTES];
+};
+
+//----------------------------------------------------------------------------------------------------
+// Typed value parsed from a String property, filled on first read
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool constexpr IS_PROPERTY_PARSE_CACHEABLE = std::is_trivially_destructible_v<T> &&
+                                             std::is_copy_constructible_v<T> &&
+                                             sizeof(T) <= PROPERTY_PARSE_CACHE_BYTES &&
+                                             alignof(T) <= PROPERTY_INLINE_ALIGN;
+
+class PropertyParseCache
+{
+public:
+    // Copies start empty: the copy re-parses on its first read
+    PropertyParseCache() = default;
+    PropertyParseCache(PropertyParseCache const& copyFrom);
+    PropertyParseCache& operator=(PropertyParseCache const& assignFrom);
+
+    template <typename T>
+    bool TryGet(T& outValue) const;
+
+    template <typename T>
+    void Store(T const& value) const;   // Ignored once a value (of any type) is cached
+
+    void Reset();                       // Caller has exclusive access (the String changed)
+
+private:
+    static sPropertyTypeInfo const s_filling;   // Tag while one reader writes m_bytes
+
+    mutable std::atomic<sPropertyTypeInfo const*>        m_type = nullptr;
+    alignas(PROPERTY_INLINE_ALIGN) mutable unsigned char m_bytes[PROPERTY_PARSE_CACHE_BYTES] = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+class NamedPropertyTable
+{
+public:
+    enum class eKeyMatch : uint8_t
+    {
+        CASE_INSENSITIVE,
+        CASE_SENSITIVE
+    };
+
+    struct sEntry
+    {
+        String             m_key;           // Spelling of the first SetValue
+        PropertyValue      m_value;
+        PropertyParseCache m_parseCache;    // Only meaningful while m_value holds a String
+    };
+
+    explicit NamedPropertyTable(eKeyMatch keyMatch);
+
+    sEntry const* Find(std::string_view key) const;
+    sEntry const* Find(std::string_view key, uint32_t hash) const;         // hash = HashedCaseInsensitiveString::CalcHashForText(key)
+    sEntry const* Find(HashedCaseInsensitiveString const& key) const;      // Reuses the key's stored hash
+    sEntry&       FindOrAdd(std::string_view key);                         // New entries have an empty m_value
+    sEntry&       FindOrAdd(std::string_view key, uint32_t hash);
+    sEntry&       FindOrAdd(HashedCaseInsensitiveString const& key);
+    void          Reserve(size_t entryCount);           // Grow once up front (e.g. before populating from XML)
+    size_t        GetSize() const { return m_entries.size(); }
+
+    template <typename Visitor>
+    void ForEach(Visitor visitor) const;                // visitor(sEntry const&), in insertion order
+
+private:
+    struct sIndexSlot
+    {
+        uint32_t m_hash       = 0;
+        uint32_t m_entryIndex = 0;      // Into m_entries, + 1; 0 = unused slot
+    };
+
+    size_t FindIndexSlot(std::string_view key, uint32_t hash) const;   // Matching slot, or the unused slot ending the probe
+    size_t GetHomeSlot(uint32_t hash) const;
+    void   Rehash(size_t slotCount);
+
+    std::vector<sIndexSlot> m_index;        // Power-of-two size, at most 3/4 full
+    std::vector<sEntry>     m_entries;      // Dense; only as many as are used
+    int                     m_slotShift = 64;
+    eKeyMatch               m_keyMatch  = eKeyMatch::CASE_INSENSITIVE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Template implementations
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void PropertyValue::Set(T const& value)
+{
+    static_assert(!std::is_array_v<T>, "PropertyValue stores arrays by pointer; pass a String instead");
+
+    if (m_type == &PROPERTY_TYPE_INFO<T>)
+    {
+        *PropertyTypeOps<T>::Get(m_storage) = value;
+        return;
+    }
+
+    Clear();
+    PropertyTypeOps<T>::Construct(m_storage, value);
+    m_type = &PROPERTY_TYPE_INFO<T>;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T const* PropertyValue::TryGet() const
+{
+    if (m_type != &PROPERTY_TYPE_INFO<T>)
+    {
+        return nullptr;
+    }
+    return PropertyTypeOps<T>::Get(const_cast<unsigned char*>(m_storage));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool PropertyParseCache::TryGet(T& outValue) const
+{
+    static_assert(IS_PROPERTY_PARSE_CACHEABLE<T>);
+
+    if (m_type.load(std::memory_order_acquire) != &PROPERTY_TYPE_INFO<T>)
+    {
+        return false;
+    }
+    outValue = *std::launder(reinterpret_cast<T const*>(m_bytes));
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void PropertyParseCache::Store(T const& value) const
+{
+    static_assert(IS_PROPERTY_PARSE_CACHEABLE<T>);
+
+    sPropertyTypeInfo const* expected = nullptr;
+    if (!m_type.compare_exchange_strong(expected, &s_filling, std::memory_order_relaxed))
+    {
+        return;
+    }
+    new (m_bytes) T(value);
+    m_type.store(&PROPERTY_TYPE_INFO<T>, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Visitor>
+void NamedPropertyTable::ForEach(Visitor visitor) const
+{
+    for (sEntry const& entry : m_entries)
+    {
+        visitor(entry);
+    }
+}
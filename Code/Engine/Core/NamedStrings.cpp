@@ -15,6 +15,18 @@
 //----------------------------------------------------------------------------------------------------
 void NamedStrings::PopulateFromXmlElementAttributes(XmlElement const& element)
 {
+    // Size the table once instead of growing it while inserting
+    size_t entryCount = 0;
+    for (XmlAttribute const* attribute = element.FirstAttribute(); attribute; attribute = attribute->Next())
+    {
+        ++entryCount;
+    }
+    for (XmlElement const* childElement = element.FirstChildElement(); childElement; childElement = childElement->NextSiblingElement())
+    {
+        ++entryCount;
+    }
+    m_keyValuePairs.Reserve(m_keyValuePairs.GetSize() + entryCount);
+
     XmlAttribute const* attribute = element.FirstAttribute();
 
     while (attribute)
@@ -90,100 +102,110 @@ void NamedStrings::PopulateFromXmlElementAttributes(XmlElement const& element)
 //----------------------------------------------------------------------------------------------------
 void NamedStrings::SetValue(String const& keyName, String const& newValue)
 {
-    m_keyValuePairs[keyName] = newValue;
+    NamedPropertyTable::sEntry& entry = m_keyValuePairs.FindOrAdd(keyName);
+    entry.m_value.Set(newValue);
+    entry.m_parseCache.Reset();
 }
 
 //----------------------------------------------------------------------------------------------------
-String NamedStrings::GetValue(String const& keyName, String const& defaultValue) const
+template <typename T, typename Parser>
+T NamedStrings::GetParsedValue(String const& keyName, T const& defaultValue, Parser parser) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
+    NamedPropertyTable::sEntry const* const entry = m_keyValuePairs.Find(keyName);
 
-    if (it == m_keyValuePairs.end())
+    if (entry == nullptr)
     {
-        printf("%s not found\n", keyName.c_str());
+        printf("( %s ) is not in the game config!\n", keyName.c_str());
 
         return defaultValue;
     }
 
-    return it->second;
+    T result = defaultValue;
+
+    if (entry->m_parseCache.TryGet(result))
+    {
+        return result;
+    }
+
+    if (parser(*entry->m_value.TryGet<String>(), result))
+    {
+        entry->m_parseCache.Store(result);
+    }
+
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------
-bool NamedStrings::GetValue(String const& keyName, bool const defaultValue) const
+String NamedStrings::GetValue(String const& keyName, String const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
+    NamedPropertyTable::sEntry const* const entry = m_keyValuePairs.Find(keyName);
 
-    if (it == m_keyValuePairs.end())
+    if (entry == nullptr)
     {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
+        printf("%s not found\n", keyName.c_str());
 
         return defaultValue;
     }
 
-    return it->second == "true" || it->second == "1";
+    return *entry->m_value.TryGet<String>();
 }
 
 //----------------------------------------------------------------------------------------------------
-int NamedStrings::GetValue(String const& keyName, int const defaultValue) const
+bool NamedStrings::GetValue(String const& keyName, bool const defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
+    return GetParsedValue(keyName, defaultValue, [](String const& text, bool& outValue)
     {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
+        outValue = text == "true" || text == "1";
+        return true;
+    });
+}
 
-    return atoi(it->second.c_str());
+//----------------------------------------------------------------------------------------------------
+int NamedStrings::GetValue(String const& keyName, int const defaultValue) const
+{
+    return GetParsedValue(keyName, defaultValue, [](String const& text, int& outValue)
+    {
+        outValue = atoi(text.c_str());
+        return true;
+    });
 }
 
 //----------------------------------------------------------------------------------------------------
 unsigned short NamedStrings::GetValue(String const&        keyName,
                                       unsigned short const defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
+    return GetParsedValue(keyName, defaultValue, [&keyName](String const& text, unsigned short& outValue)
     {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
+        try
+        {
+            unsigned long const value = std::stoul(text);
 
-    try
-    {
-        unsigned long const value = std::stoul(it->second);
+            // Check if exceeding unsigned short's range (0-65535)
+            if (value > std::numeric_limits<unsigned short>::max())
+            {
+                printf("Value for ( %s ) exceeds unsigned short range, using default\n", keyName.c_str());
+                return false;
+            }
 
-        // Check if exceeding unsigned short's range (0-65535)
-        if (value > std::numeric_limits<unsigned short>::max())
+            outValue = static_cast<unsigned short>(value);
+            return true;
+        }
+        catch (std::exception const& e)
         {
-            printf("Value for ( %s ) exceeds unsigned short range, using default\n", keyName.c_str());
-            return defaultValue;
+            printf("Failed to convert ( %s ) to number, using default: %s\n", keyName.c_str(), e.what());
+            return false;
         }
-
-        return static_cast<unsigned short>(value);
-    }
-    catch (std::exception const& e)
-    {
-        printf("Failed to convert ( %s ) to number, using default: %s\n", keyName.c_str(), e.what());
-        return defaultValue;
-    }
+    });
 }
 
 //----------------------------------------------------------------------------------------------------
 float NamedStrings::GetValue(String const& keyName, float const defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
+    return GetParsedValue(keyName, defaultValue, [](String const& text, float& outValue)
     {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    return static_cast<float>(atof(it->second.c_str()));
+        outValue = static_cast<float>(atof(text.c_str()));
+        return true;
+    });
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -193,113 +215,59 @@ String NamedStrings::GetValue(String const& keyName, char const* defaultValue) c
 }
 
 //----------------------------------------------------------------------------------------------------
-Rgba8 NamedStrings::GetValue(String const& keyName, Rgba8 const& defaultValue) const
+// SetFromText overwrites every component (invalid text resets to zero / white), so results are cacheable
+template <typename T>
+static bool ParseWithSetFromText(String const& text, T& outValue)
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    Rgba8 result = defaultValue;
-    result.SetFromText(it->second.c_str());
+    outValue.SetFromText(text.c_str());
+    return true;
+}
 
-    return result;
+//----------------------------------------------------------------------------------------------------
+Rgba8 NamedStrings::GetValue(String const& keyName, Rgba8 const& defaultValue) const
+{
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<Rgba8>);
 }
 
 //----------------------------------------------------------------------------------------------------
 Vec2 NamedStrings::GetValue(String const& keyName, Vec2 const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    Vec2 result = defaultValue;
-    result.SetFromText(it->second.c_str());
-
-    return result;
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<Vec2>);
 }
 
 //----------------------------------------------------------------------------------------------------
 Vec3 NamedStrings::GetValue(String const& keyName, Vec3 const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    Vec3 result = defaultValue;
-    result.SetFromText(it->second.c_str());
-
-    return result;
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<Vec3>);
 }
 
 //----------------------------------------------------------------------------------------------------
 IntVec2 NamedStrings::GetValue(String const& keyName, IntVec2 const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    IntVec2 result = defaultValue;
-    result.SetFromText(it->second.c_str());
-
-    return result;
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<IntVec2>);
 }
 
 //----------------------------------------------------------------------------------------------------
 EulerAngles NamedStrings::GetValue(String const& keyName, EulerAngles const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    EulerAngles result = defaultValue;
-    result.SetFromText(it->second.c_str());
-
-    return result;
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<EulerAngles>);
 }
 
+//----------------------------------------------------------------------------------------------------
 FloatRange NamedStrings::GetValue(String const& keyName, FloatRange const& defaultValue) const
 {
-    auto const it = m_keyValuePairs.find(keyName);
-
-    if (it == m_keyValuePairs.end())
-    {
-        printf("( %s ) is not in the game config!\n", keyName.c_str());
-
-        return defaultValue;
-    }
-
-    FloatRange result = defaultValue;
-    result.SetFromText(it->second.c_str());
-
-    return result;
+    return GetParsedValue(keyName, defaultValue, ParseWithSetFromText<FloatRange>);
 }
 
+//----------------------------------------------------------------------------------------------------
 std::map<String, String> NamedStrings::GetAllKeyValuePairs()
 {
-    return m_keyValuePairs;
+    std::map<String, String> keyValuePairs;
+
+    m_keyValuePairs.ForEach([&keyValuePairs](NamedPropertyTable::sEntry const& entry)
+    {
+        keyValuePairs[entry.m_key] = *entry.m_value.TryGet<String>();
+    });
+
+    return keyValuePairs;
 }
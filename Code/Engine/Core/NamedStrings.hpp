@@ -5,10 +5,14 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Core/NamedPropertyTable.hpp"
 #include "Engine/Core/XmlUtils.hpp"
 //----------------------------------------------------------------------------------------------------
 #include <map>
 
+//----------------------------------------------------------------------------------------------------
+// Case-sensitive keys → String values in a flat NamedPropertyTable. Each typed GetValue parses the
+// text once and then answers from the entry's PropertyParseCache.
 //----------------------------------------------------------------------------------------------------
 class NamedStrings
 {
@@ -30,5 +34,9 @@ public:
     std::map<String, String> GetAllKeyValuePairs();
 
 private:
-    std::map<String, String> m_keyValuePairs;
+    // parser(text, inOutValue) -> false if the text is invalid (value stays the default and is not cached)
+    template <typename T, typename Parser>
+    T GetParsedValue(String const& keyName, T const& defaultValue, Parser parser) const;
+
+    NamedPropertyTable m_keyValuePairs{NamedPropertyTable::eKeyMatch::CASE_SENSITIVE};
 };
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------------------------------
+// ParallelFor.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/ParallelFor.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------
+// Shared between the calling thread and its helper jobs. Helpers hold a shared_ptr because they may
+// be claimed after the caller has already finished every chunk and returned.
+//----------------------------------------------------------------------------------------------------
+struct sParallelForState
+{
+    ParallelForInvokeFunc m_invokeFunc = nullptr;
+    void const*           m_chunkFunc  = nullptr;
+    int                   m_begin      = 0;
+    int                   m_end        = 0;
+    int                   m_grainSize  = 1;
+    int                   m_chunkCount = 0;
+
+    std::atomic<int> m_nextChunk      = 0;
+    std::atomic<int> m_finishedChunks = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Claim and run chunks until none are left
+//----------------------------------------------------------------------------------------------------
+static void RunParallelForChunks(sParallelForState& state)
+{
+    for (;;)
+    {
+        int const chunkIndex = state.m_nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+        if (chunkIndex >= state.m_chunkCount)
+        {
+            return;
+        }
+
+        int const chunkBegin = state.m_begin + chunkIndex * state.m_grainSize;
+        int const chunkEnd   = static_cast<int>(std::min<long long>(static_cast<long long>(chunkBegin) + state.m_grainSize, state.m_end));
+
+        state.m_invokeFunc(state.m_chunkFunc, chunkBegin, chunkEnd);
+
+        // Release pairs with the caller's acquire so chunk side effects are visible after ParallelFor()
+        state.m_finishedChunks.fetch_add(1, std::memory_order_release);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+class ParallelForJob : public Job
+{
+public:
+    explicit ParallelForJob(std::shared_ptr<sParallelForState> state)
+        : Job(JOB_TYPE_GENERIC)
+        , m_state(std::move(state))
+    {
+        SetDeleteOnCompletion(true);
+    }
+
+    void Execute() override
+    {
+        RunParallelForChunks(*m_state);
+    }
+
+private:
+    std::shared_ptr<sParallelForState> m_state;
+};
+
+//----------------------------------------------------------------------------------------------------
+void ParallelForInternal(int const begin, int const end, int const grainSize, ParallelForInvokeFunc const invokeFunc, void const* chunkFunc, JobSystem* jobSystem)
+{
+    if (end <= begin || invokeFunc == nullptr)
+    {
+        return;
+    }
+
+    int const grain      = grainSize > 0 ? grainSize : 1;
+    int const chunkCount = static_cast<int>((static_cast<long long>(end) - begin + grain - 1) / grain);
+
+    if (jobSystem == nullptr)
+    {
+        jobSystem = g_jobSystem;
+    }
+
+    int const helperCount = (jobSystem != nullptr && jobSystem->IsRunning())
+        ? std::min(chunkCount - 1, jobSystem->GetGenericWorkerThreadCount())
+        : 0;
+
+    // Serial fallback: no workers available or nothing to split
+    if (helperCount <= 0)
+    {
+        for (int chunkBegin = begin; chunkBegin < end; )
+        {
+            int const chunkEnd = static_cast<int>(std::min<long long>(static_cast<long long>(chunkBegin) + grain, end));
+            invokeFunc(chunkFunc, chunkBegin, chunkEnd);
+            chunkBegin = chunkEnd;
+        }
+        return;
+    }
+
+    std::shared_ptr<sParallelForState> const state = std::make_shared<sParallelForState>();
+    state->m_invokeFunc = invokeFunc;
+    state->m_chunkFunc  = chunkFunc;
+    state->m_begin      = begin;
+    state->m_end        = end;
+    state->m_grainSize  = grain;
+    state->m_chunkCount = chunkCount;
+
+    std::vector<Job*> helperJobs;
+    helperJobs.reserve(static_cast<size_t>(helperCount));
+
+    for (int helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+    {
+        helperJobs.push_back(new ParallelForJob(state));
+    }
+
+    // The JobSystem may have stopped since the IsRunning() check: then the helpers were never queued and
+    // the caller runs every chunk below
+    if (!jobSystem->SubmitJobs(helperJobs))
+    {
+        for (Job const* helperJob : helperJobs)
+        {
+            delete helperJob;
+        }
+    }
+
+    // The caller works too, so progress never depends on a free worker (safe to call from a job)
+    RunParallelForChunks(*state);
+
+    // Chunks claimed by helpers may still be running
+    while (state->m_finishedChunks.load(std::memory_order_acquire) < chunkCount)
+    {
+        std::this_thread::yield();
+    }
+}
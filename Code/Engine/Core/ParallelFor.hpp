@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------------------------------
+// ParallelFor.hpp
+// Engine Core Module - Data-Parallel Loops on the JobSystem
+//
+// Purpose:
+//   Split an index range [begin, end) into fixed-size chunks and process them on the JobSystem's
+//   generic worker threads. The calling thread always helps, so ParallelFor() is safe to call from
+//   the main thread or from inside a job.
+//
+// Design Rationale:
+//   - Chunks are claimed with one atomic increment; there is no per-chunk Job allocation
+//   - At most GetGenericWorkerThreadCount() helper jobs are submitted per call (one SubmitJobs() lock)
+//   - grainSize controls chunk size: use large grains for cheap bodies, small grains for uneven work
+//   - Falls back to a plain serial loop when the JobSystem is missing/stopped or only one chunk exists
+//   - ParallelReduce() keeps one partial per chunk and folds them in index order, so the result is
+//     deterministic regardless of which thread ran which chunk
+//
+// Usage:
+//   ParallelFor(0, vertexCount, 1024, [&](int chunkBegin, int chunkEnd)
+//   {
+//       for (int i = chunkBegin; i < chunkEnd; ++i) { TransformVertex(verts[i]); }
+//   });
+//
+//   float const sum = ParallelReduce<float>(0, count, 4096, 0.f,
+//       [&](int chunkBegin, int chunkEnd) { float s = 0.f; for (int i = chunkBegin; i < chunkEnd; ++i) s += values[i]; return s; },
+//       [](float a, float b) { return a + b; });
+//
+// Thread Safety Model:
+//   - chunkFunc runs concurrently on several threads with disjoint [chunkBegin, chunkEnd) ranges
+//   - ParallelFor() returns only after every chunk has finished (caller's captures stay valid)
+//
+// Author: JobSystem Data-Parallel Helpers
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class JobSystem;
+
+//----------------------------------------------------------------------------------------------------
+// Type-erased entry point (see ParallelFor.cpp). invokeFunc(chunkFunc, chunkBegin, chunkEnd)
+//----------------------------------------------------------------------------------------------------
+using ParallelForInvokeFunc = void (*)(void const* chunkFunc, int chunkBegin, int chunkEnd);
+
+void ParallelForInternal(int begin, int end, int grainSize, ParallelForInvokeFunc invokeFunc, void const* chunkFunc, JobSystem* jobSystem);
+
+//----------------------------------------------------------------------------------------------------
+// ParallelFor - call chunkFunc(chunkBegin, chunkEnd) for every grainSize-sized chunk of [begin, end)
+// jobSystem == nullptr uses g_jobSystem
+//----------------------------------------------------------------------------------------------------
+template <typename ChunkFunc>
+void ParallelFor(int const begin, int const end, int const grainSize, ChunkFunc const& chunkFunc, JobSystem* jobSystem = nullptr)
+{
+    static_assert(std::is_invocable_v<ChunkFunc const&, int, int>, "ParallelFor chunkFunc must be callable as (int chunkBegin, int chunkEnd)");
+
+    ParallelForInvokeFunc const invokeFunc = [](void const* func, int const chunkBegin, int const chunkEnd)
+    {
+        (*static_cast<ChunkFunc const*>(func))(chunkBegin, chunkEnd);
+    };
+
+    ParallelForInternal(begin, end, grainSize, invokeFunc, &chunkFunc, jobSystem);
+}
+
+//----------------------------------------------------------------------------------------------------
+// ParallelReduce - map each chunk to a partial T, then fold partials in chunk order
+//   mapFunc(chunkBegin, chunkEnd) -> T
+//   reduceFunc(T accumulated, T partial) -> T
+//----------------------------------------------------------------------------------------------------
+template <typename T, typename MapFunc, typename ReduceFunc>
+T ParallelReduce(int const begin, int const end, int const grainSize, T const& identity, MapFunc const& mapFunc, ReduceFunc const& reduceFunc, JobSystem* jobSystem = nullptr)
+{
+    // std::vector<bool> packs bits; concurrent writes to neighbouring partials would race
+    static_assert(!std::is_same_v<T, bool>, "ParallelReduce<bool> is not supported; reduce to int instead");
+
+    if (end <= begin)
+    {
+        return identity;
+    }
+
+    int const grain      = grainSize > 0 ? grainSize : 1;
+    int const chunkCount = static_cast<int>((static_cast<long long>(end) - begin + grain - 1) / grain);
+
+    std::vector<T> partials(static_cast<size_t>(chunkCount), identity);
+
+    ParallelFor(begin, end, grain, [&](int const chunkBegin, int const chunkEnd)
+    {
+        partials[static_cast<size_t>((static_cast<long long>(chunkBegin) - begin) / grain)] = mapFunc(chunkBegin, chunkEnd);
+    }, jobSystem);
+
+    T result = identity;
+    for (T& partial : partials)
+    {
+        result = reduceFunc(std::move(result), std::move(partial));
+    }
+    return result;
+}
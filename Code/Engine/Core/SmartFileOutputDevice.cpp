@@ -7,6 +7,7 @@
 #include "Engine/Core/SmartFileOutputDevice.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <ctime>
 #include <filesystem>
@@ -24,14 +25,18 @@
 // SmartFileOutputDevice implementation
 //----------------------------------------------------------------------------------------------------
 
-SmartFileOutputDevice::SmartFileOutputDevice(const String& logDirectory, const sSmartRotationConfig& config)
+SmartFileOutputDevice::SmartFileOutputDevice(const String& logDirectory, const sSmartRotationConfig& config, sLogFlushPolicy const& flushPolicy)
 	: m_logDirectory(logDirectory)
 	  , m_config(config)
 	  , m_currentSegmentNumber(1)
 	  , m_currentFileSize(0)
 	  , m_sessionStartTime(std::chrono::system_clock::now())
 	  , m_lastRotationTime(std::chrono::system_clock::now())
+	  , m_flushPolicy(flushPolicy)
 {
+	m_writeBuffer.reserve(m_flushPolicy.flushBytes + 4096);
+	ResetArchiveClockBase();
+
 	// Generate session ID (timestamp-based, Minecraft-style)
 	m_sessionId = GenerateSessionId();
 
@@ -72,6 +77,7 @@ SmartFileOutputDevice::~SmartFileOutputDevice()
 	// Close current file (but DON'T archive it - Minecraft keeps latest.log after shutdown)
 	if (m_currentFile.is_open())
 	{
+		WriteOutBuffer();
 		m_currentFile.close();
 	}
 
@@ -92,27 +98,27 @@ void SmartFileOutputDevice::WriteLog(const LogEntry& entry)
 		return; // Fail silently if file not available
 	}
 
-	// Format log entry (similar to regular FileOutputDevice)
-	String formattedEntry = Stringf("[%s][%s][%s:%d] %s\n",
-									entry.m_timestamp.c_str(),
-									entry.m_category.c_str(),
-									entry.m_fileName.c_str(),
-									entry.m_lineNum,
-									entry.m_message.c_str()
-	);
+	AppendFormattedLine(entry);
+	FlushIfDue(entry.m_verbosity <= eLogVerbosity::Error);
+}
 
-	// Write to current file
-	m_currentFile << formattedEntry;
-	m_currentFile.flush();
+void SmartFileOutputDevice::WriteLogBatch(std::span<LogEntry const* const> const entries)
+{
+	std::lock_guard<std::mutex> lock(m_fileMutex);
 
-	// Track file size
-	m_currentFileSize += formattedEntry.length();
+	if (!m_currentFile.is_open())
+	{
+		return;
+	}
 
-	// Check if rotation is needed
-	if (ShouldRotateBySize() || ShouldRotateByTime())
+	bool hasErrorEntry = false;
+	for (LogEntry const* entry : entries)
 	{
-		m_rotationPending = true;
+		AppendFormattedLine(*entry);
+		hasErrorEntry |= entry->m_verbosity <= eLogVerbosity::Error;
 	}
+
+	FlushIfDue(hasErrorEntry);
 }
 
 void SmartFileOutputDevice::Flush()
@@ -120,7 +126,7 @@ void SmartFileOutputDevice::Flush()
 	std::lock_guard<std::mutex> lock(m_fileMutex);
 	if (m_currentFile.is_open())
 	{
-		m_currentFile.flush();
+		WriteOutBuffer();
 	}
 }
 
@@ -130,6 +136,73 @@ bool SmartFileOutputDevice::IsAvailable() const
 	return m_currentFile.is_open();
 }
 
+//----------------------------------------------------------------------------------------------------
+// Write buffering
+//----------------------------------------------------------------------------------------------------
+
+// [timestamp][category][file:line] message
+void SmartFileOutputDevice::AppendFormattedLine(const LogEntry& entry)
+{
+	size_t const sizeBefore = m_writeBuffer.size();
+	if (sizeBefore == 0)
+	{
+		m_bufferStartTime = std::chrono::steady_clock::now();
+	}
+
+	char       lineText[16];
+	auto const result = std::to_chars(lineText, lineText + sizeof(lineText), entry.m_lineNum);
+
+	m_writeBuffer += '[';
+	m_writeBuffer += entry.m_timestamp;
+	m_writeBuffer += "][";
+	m_writeBuffer += entry.m_category;
+	m_writeBuffer += "][";
+	m_writeBuffer += entry.m_fileName;
+	m_writeBuffer += ':';
+	m_writeBuffer.append(lineText, result.ptr);
+	m_writeBuffer += "] ";
+	m_writeBuffer += entry.m_message;
+	m_writeBuffer += '\n';
+
+	size_t const lineBytes = m_writeBuffer.size() - sizeBefore;
+	m_currentFileSize += lineBytes;
+
+	if (m_config.compressArchives)
+	{
+		auto const     sinceBase = std::chrono::steady_clock::duration(entry.m_ticks - m_clockBaseTicks);
+		int64_t const  timeMs    = m_clockBaseEpochMs + std::chrono::duration_cast<std::chrono::milliseconds>(sinceBase).count();
+		uint32_t const lineCount = 1 + static_cast<uint32_t>(std::count(entry.m_message.begin(), entry.m_message.end(), '\n'));
+		m_archiveIndex.AddLine(lineBytes, lineCount, timeMs, entry.m_category, entry.m_verbosity);
+	}
+}
+
+void SmartFileOutputDevice::FlushIfDue(bool const hasErrorEntry)
+{
+	if (m_writeBuffer.size() >= m_flushPolicy.flushBytes ||
+		(hasErrorEntry && m_flushPolicy.flushOnError) ||
+		std::chrono::steady_clock::now() - m_bufferStartTime >= std::chrono::milliseconds(m_flushPolicy.flushIntervalMs))
+	{
+		WriteOutBuffer();
+
+		// Checked per flush rather than per line: a segment overshoots maxFileSizeBytes by at most one buffer
+		if (ShouldRotateBySize() || ShouldRotateByTime())
+		{
+			m_rotationPending = true;
+		}
+	}
+}
+
+void SmartFileOutputDevice::WriteOutBuffer()
+{
+	if (!m_writeBuffer.empty())
+	{
+		m_currentFile.write(m_writeBuffer.data(), static_cast<std::streamsize>(m_writeBuffer.size()));
+		m_writeBuffer.clear();
+	}
+
+	m_currentFile.flush();
+}
+
 //----------------------------------------------------------------------------------------------------
 // Rotation control methods
 //----------------------------------------------------------------------------------------------------
@@ -169,17 +242,20 @@ void SmartFileOutputDevice::PerformRotation()
 		return; // Nothing to rotate
 	}
 
-	// Close current file
+	// Close current file, taking its archive index with it
+	LogArchiveIndexBuilder liveIndex;
 	{
 		std::lock_guard<std::mutex> fileLock(m_fileMutex);
 		if (m_currentFile.is_open())
 		{
+			WriteOutBuffer();
 			m_currentFile.close();
 		}
+		std::swap(liveIndex, m_archiveIndex);
 	}
 
 	// Archive the current file
-	ArchiveCurrentFile();
+	ArchiveCurrentFile(m_config.compressArchives ? &liveIndex : nullptr);
 
 	// Increment segment number for next rotation
 	m_currentSegmentNumber++;
@@ -190,6 +266,7 @@ void SmartFileOutputDevice::PerformRotation()
 		m_currentFile.open(m_currentFilePath, std::ios::out | std::ios::trunc);
 		m_currentFileSize  = 0;
 		m_lastRotationTime = std::chrono::system_clock::now();
+		ResetArchiveClockBase();
 	}
 
 	// Update statistics
@@ -265,7 +342,7 @@ String SmartFileOutputDevice::GenerateSessionId()
 	return ss.str();
 }
 
-void SmartFileOutputDevice::ArchiveCurrentFile()
+void SmartFileOutputDevice::ArchiveCurrentFile(LogArchiveIndexBuilder const* const liveIndex)
 {
 	if (!std::filesystem::exists(m_currentFilePath))
 	{
@@ -280,6 +357,29 @@ void SmartFileOutputDevice::ArchiveCurrentFile()
 		// Create date-based directory if needed
 		CreateDirectoryIfNeeded(archivePath.parent_path());
 
+		// Compress into a .dlog next to where the .log would go; keep the text if that fails
+		if (m_config.compressArchives)
+		{
+			std::filesystem::path compressedPath = archivePath;
+			compressedPath.replace_extension(LOG_ARCHIVE_EXTENSION);
+
+			sLogArchiveWriteResult result;
+			String                 error;
+			if (WriteLogArchive(m_currentFilePath, compressedPath, liveIndex, &result, &error))
+			{
+				std::filesystem::remove(m_currentFilePath);
+				m_stats.archivedTextBytes += result.m_textBytes;
+				m_stats.archivedFileBytes += result.m_archiveBytes;
+				LogRotationEvent(Stringf("Archived log file: %s (%llu -> %llu bytes, %zu blocks)", compressedPath.string().c_str(),
+										 static_cast<unsigned long long>(result.m_textBytes),
+										 static_cast<unsigned long long>(result.m_archiveBytes), result.m_blockCount));
+				return;
+			}
+
+			m_stats.lastError = error;
+			LogRotationEvent(Stringf("Archive compression failed, keeping text: %s", error.c_str()));
+		}
+
 		// Simply move the file to the date-based folder
 		std::filesystem::rename(m_currentFilePath, archivePath);
 
@@ -292,6 +392,13 @@ void SmartFileOutputDevice::ArchiveCurrentFile()
 	}
 }
 
+// Index times come from LogEntry::m_ticks (steady clock); re-anchored per segment so wall clock adjustments do not accumulate
+void SmartFileOutputDevice::ResetArchiveClockBase()
+{
+	m_clockBaseTicks   = std::chrono::steady_clock::now().time_since_epoch().count();
+	m_clockBaseEpochMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
 std::filesystem::path SmartFileOutputDevice::GetDateBasedFolderPath() const
 {
 	if (!m_config.organizeDateFolders)
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "Engine/Core/ILogOutputDevice.hpp"
+#include "Engine/Core/LogArchive.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "ThirdParty/json/json.hpp"
 
@@ -26,6 +27,8 @@ struct sRotationStats
 {
     size_t      totalRotations    = 0;
     size_t      totalFilesDeleted = 0;
+    uint64_t    archivedTextBytes = 0;   // compressArchives: text in, .dlog bytes out
+    uint64_t    archivedFileBytes = 0;
     std::string lastError;
 };
 
@@ -43,6 +46,7 @@ struct sSmartRotationConfig
     String sessionPrefix       = "session";                    // Log directory path
     String currentLogName      = "latest.log";                // Archive prefix
     bool   organizeDateFolders = true;                   // Organize logs in date-based folders
+    bool   compressArchives    = false;                  // Archive as indexed .dlog (see LogArchive.hpp) instead of .log
 
     // Cleanup and retention
     std::chrono::hours retentionHours{720};            // 30 days default (720 hours)
@@ -68,6 +72,7 @@ struct sSmartRotationConfig
         if (j.contains("currentLogName")) config.currentLogName = j["currentLogName"].get<std::string>();
         if (j.contains("sessionPrefix")) config.sessionPrefix = j["sessionPrefix"].get<std::string>();
         if (j.contains("organizeDateFolders")) config.organizeDateFolders = j["organizeDateFolders"].get<bool>();
+        if (j.contains("compressArchives")) config.compressArchives = j["compressArchives"].get<bool>();
 
         // Cleanup and retention
         if (j.contains("retentionDays")) config.retentionHours = std::chrono::hours(j["retentionDays"].get<int>() * 24);
@@ -85,6 +90,7 @@ struct sSmartRotationConfig
 
 //----------------------------------------------------------------------------------------------------
 // Smart file output device with Minecraft-style rotation
+//   Lines are formatted into m_writeBuffer and reach latest.log in one write() per flush (see sLogFlushPolicy)
 //----------------------------------------------------------------------------------------------------
 class SmartFileOutputDevice : public ILogOutputDevice
 {
@@ -101,9 +107,19 @@ private:
     int                                   m_currentSegmentNumber;
 
     // File size and statistics
-    size_t         m_currentFileSize;
+    size_t         m_currentFileSize;   // Includes lines still in m_writeBuffer
     sRotationStats m_stats;
 
+    // Write buffering (guarded by m_fileMutex)
+    sLogFlushPolicy                       m_flushPolicy;
+    String                                m_writeBuffer;
+    std::chrono::steady_clock::time_point m_bufferStartTime;   // When the oldest buffered line was appended
+
+    // Archive index of latest.log, built as lines are appended when compressArchives is set (guarded by m_fileMutex)
+    LogArchiveIndexBuilder m_archiveIndex;
+    int64_t                m_clockBaseTicks   = 0;   // LogEntry::m_ticks → Unix epoch ms for the index
+    int64_t                m_clockBaseEpochMs = 0;
+
     // Thread safety
     mutable std::mutex m_fileMutex;
     mutable std::mutex m_rotationMutex;
@@ -114,11 +130,14 @@ private:
     std::atomic<bool> m_rotationPending{false};
 
 public:
-    explicit SmartFileOutputDevice(String const& logDirectory, sSmartRotationConfig const& config = sSmartRotationConfig{});
+    explicit SmartFileOutputDevice(String const&               logDirectory,
+                                   sSmartRotationConfig const& config      = sSmartRotationConfig{},
+                                   sLogFlushPolicy const&      flushPolicy = sLogFlushPolicy{});
     ~SmartFileOutputDevice();
 
     // ILogOutputDevice interface
     void WriteLog(const LogEntry& entry) override;
+    void WriteLogBatch(std::span<LogEntry const* const> entries) override;
     void Flush() override;
     bool IsAvailable() const override;
 
@@ -141,10 +160,16 @@ private:
     void PerformRotation();
     void RotationThreadMain();
 
+    // Write buffering (callers hold m_fileMutex)
+    void AppendFormattedLine(LogEntry const& entry);
+    void FlushIfDue(bool hasErrorEntry);
+    void WriteOutBuffer();
+
     // File management
     std::filesystem::path GenerateNewLogFilePath();
     String                GenerateSessionId();
-    void                  ArchiveCurrentFile();
+    void                  ArchiveCurrentFile(LogArchiveIndexBuilder const* liveIndex = nullptr);
+    void                  ResetArchiveClockBase();
 
     // Date-based folder organization helpers
     std::filesystem::path GetDateBasedFolderPath() const;
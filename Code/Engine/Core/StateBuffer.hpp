@@ -20,6 +20,8 @@
 //   - GetFrontBuffer(): Lock-free reads (main thread)
 //   - GetBackBuffer(): Lock-free writes (worker thread)
 //   - SwapBuffers(): Brief locked operation (main thread only)
+//   - TRIPLE_BUFFER mode: PublishBackBuffer() (worker) and SwapBuffers() (main) are each one
+//     atomic exchange; no mutex is taken on either side
 //
 // Author: M4-T8 Engine Refactoring
 // Date: 2025-10-26
@@ -30,12 +32,46 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/LogSubsystem.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>  // For std::chrono::milliseconds in try_lock_for
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_set>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// StateBuffer synchronization mode
+//
+//   DOUBLE_BUFFER: Worker writes back buffer, main thread copies it forward in SwapBuffers() under
+//                  a timed mutex (original behavior)
+//   TRIPLE_BUFFER: Worker calls PublishBackBuffer() to hand over a complete snapshot with one atomic
+//                  exchange; SwapBuffers() picks up the newest snapshot with another. No mutex, no
+//                  copy on the main thread, and neither side ever waits for the other.
+//----------------------------------------------------------------------------------------------------
+enum class eStateBufferMode : uint8_t
+{
+    DOUBLE_BUFFER,
+    TRIPLE_BUFFER
+};
+
+//----------------------------------------------------------------------------------------------------
+// Per-key dirty tracking backend (see StateBuffer::EnableDirtyTracking)
+//
+//   LOCKED_HASH_SET: MarkDirty() locks a mutex and inserts into std::unordered_set (Phase 4.2)
+//   APPEND_LOG:      MarkDirty() claims a slot in a preallocated log with one atomic increment;
+//                    the log is sorted and deduplicated in bulk when it is drained at swap/publish.
+//                    Two log segments alternate, so writers never touch the one being drained.
+//----------------------------------------------------------------------------------------------------
+enum class eDirtyTrackingBackend : uint8_t
+{
+    LOCKED_HASH_SET,
+    APPEND_LOG
+};
 
 //----------------------------------------------------------------------------------------------------
 // RunningAverage Helper Class (Phase 4.3)
@@ -144,12 +180,13 @@ public:
     //------------------------------------------------------------------------------------------------
     // Construction / Destruction
     //------------------------------------------------------------------------------------------------
-    StateBuffer()
+    explicit StateBuffer(eStateBufferMode const mode = eStateBufferMode::DOUBLE_BUFFER)
         : m_frontBuffer(&m_bufferA)
           , m_backBuffer(&m_bufferB)
           , m_totalSwaps(0)
           , m_swapErrorCount(0)
           , m_timeoutCount(0)
+          , m_mode(mode)
     {
     }
 
@@ -184,6 +221,91 @@ public:
         return m_backBuffer;
     }
 
+    eStateBufferMode GetMode() const
+    {
+        return m_mode;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Snapshot Publish (Worker Thread, TRIPLE_BUFFER mode only)
+    //------------------------------------------------------------------------------------------------
+
+    // Hand the finished back buffer to the reader and continue on a recycled buffer
+    //
+    // Algorithm:
+    //   1. Exchange the back buffer index into the shared "ready" slot, tagged fresh (one atomic op)
+    //   2. Take whichever buffer was in the ready slot as the new back buffer
+    //   3. Copy the just-published snapshot into it so the worker keeps building on current state
+    //
+    // Step 3 is a full copy, paid on the worker thread: the recycled buffer may be several publishes
+    // old (the reader can hold its snapshot for any number of frames), so per-key deltas are not enough.
+    // Thread Safety: Call from the single writer thread only; never blocks
+    void PublishBackBuffer()
+    {
+        // Nothing written since the last publish: the reader already has (or will get) this state
+        if (m_mode != eStateBufferMode::TRIPLE_BUFFER || (!m_isDirty.load(std::memory_order_acquire) && !HasPendingDirtyLog()))
+        {
+            return;
+        }
+
+        // Cleared before the dirty keys are drained, so a MarkDirty() racing this publish sets it again
+        m_isDirty.store(false, std::memory_order_release);
+
+        uint8_t const publishedIndex = m_writeIndex;
+        uint8_t const previousReady  = m_readyState.exchange(static_cast<uint8_t>(publishedIndex | READY_FRESH_BIT), std::memory_order_acq_rel);
+
+        m_writeIndex = static_cast<uint8_t>(previousReady & READY_INDEX_MASK);
+        m_backBuffer = GetBufferByIndex(m_writeIndex);
+        ++m_totalPublishes;
+
+        if ((previousReady & READY_FRESH_BIT) != 0)
+        {
+            ++m_droppedSnapshots;  // Reader never saw the previous snapshot
+        }
+
+        // The published buffer is read-only from here on, so reading it concurrently with the main thread is safe
+        TStateContainer const* publishedBuffer = GetBufferByIndex(publishedIndex);
+
+        try
+        {
+            *m_backBuffer = *publishedBuffer;
+            m_totalCopyOperations += publishedBuffer->size();
+        }
+        catch (std::exception const& e)
+        {
+            DAEMON_LOG(LogCore, eLogVerbosity::Error,
+                       "StateBuffer::PublishBackBuffer - Exception while recycling back buffer: %s", e.what());
+            ++m_publishErrorCount;
+        }
+        catch (...)
+        {
+            DAEMON_LOG(LogCore, eLogVerbosity::Error,
+                       "StateBuffer::PublishBackBuffer - Unknown exception while recycling back buffer");
+            ++m_publishErrorCount;
+        }
+
+        // Per-key dirty state describes the snapshot that was just published
+        if (m_dirtyTrackingEnabled && m_dirtyTrackingBackend == eDirtyTrackingBackend::APPEND_LOG)
+        {
+            size_t const dirtyCount = DrainDirtyLog();
+
+            if (dirtyCount > 0 && !publishedBuffer->empty())
+            {
+                m_dirtyRatios.Add(static_cast<float>(dirtyCount) / static_cast<float>(publishedBuffer->size()));
+            }
+        }
+        else if (m_dirtyTrackingEnabled)
+        {
+            std::lock_guard dirtyLock(m_dirtyKeysMutex);
+
+            if (!m_dirtyKeys.empty() && !publishedBuffer->empty())
+            {
+                m_dirtyRatios.Add(static_cast<float>(m_dirtyKeys.size()) / static_cast<float>(publishedBuffer->size()));
+            }
+            m_dirtyKeys.clear();
+        }
+    }
+
     //------------------------------------------------------------------------------------------------
     // Buffer Swap (Frame Boundary, Main Thread Only)
     //------------------------------------------------------------------------------------------------
@@ -207,9 +329,15 @@ public:
     //   - Exception details logged via DAEMON_LOG
     void SwapBuffers()
     {
+        if (m_mode == eStateBufferMode::TRIPLE_BUFFER)
+        {
+            AcquireLatestSnapshot();
+            return;
+        }
+
         // Phase 4.1: Check dirty flag before acquiring lock (optimization)
         // If buffer hasn't been modified, skip the expensive copy operation
-        if (!m_isDirty.load(std::memory_order_acquire))
+        if (!m_isDirty.load(std::memory_order_acquire) && !HasPendingDirtyLog())
         {
             ++m_skippedSwaps;
             // Temporary diagnostic - remove after verification
@@ -241,11 +369,37 @@ public:
             return;
         }
 
+        // Phase 4.1: Reset dirty flag before the copy; a MarkDirty() racing the copy sets it again so
+        // its key is not stranded until some unrelated write
+        m_isDirty.store(false, std::memory_order_release);
+
         // Phase 3.1: Wrap copy operation in try-catch for error recovery
         try
         {
+            // Lock-free append log: drain, deduplicate, then copy only those keys
+            if (m_dirtyTrackingEnabled && m_dirtyTrackingBackend == eDirtyTrackingBackend::APPEND_LOG)
+            {
+                size_t const dirtyCount = DrainDirtyLog();
+
+                for (KeyType const& key : m_drainedDirtyKeys)
+                {
+                    auto it = m_backBuffer->find(key);
+                    if (it != m_backBuffer->end())
+                    {
+                        (*m_frontBuffer)[key] = it->second;
+                    }
+                }
+
+                m_totalCopyOperations += dirtyCount;
+
+                size_t const totalEntities = m_frontBuffer->size();
+                if (dirtyCount > 0 && totalEntities > 0)
+                {
+                    m_dirtyRatios.Add(static_cast<float>(dirtyCount) / static_cast<float>(totalEntities));
+                }
+            }
             // Phase 4.2: Per-key dirty tracking optimization
-            if (m_dirtyTrackingEnabled)
+            else if (m_dirtyTrackingEnabled)
             {
                 std::lock_guard dirtyLock(m_dirtyKeysMutex);
 
@@ -294,9 +448,6 @@ public:
 
             // Increment swap counter for profiling
             ++m_totalSwaps;
-
-            // Phase 4.1: Reset dirty flag after successful copy
-            m_isDirty.store(false, std::memory_order_release);
             // DAEMON_LOG(LogCore, eLogVerbosity::Display,StringFormat("StateBuffer::SwapBuffers - Success (total swaps: {})", m_totalSwaps));
         }
         catch (std::bad_alloc const& e)
@@ -306,6 +457,7 @@ public:
                        "StateBuffer::SwapBuffers - Memory allocation failed: %s. Preserving stale front buffer.",
                        e.what());
             ++m_swapErrorCount;
+            m_isDirty.store(true, std::memory_order_release);  // Retry the copy next frame
             // Stale front buffer preserved - rendering continues with old state
         }
         catch (std::exception const& e)
@@ -315,6 +467,7 @@ public:
                        "StateBuffer::SwapBuffers - Exception during buffer copy: %s. Preserving stale front buffer.",
                        e.what());
             ++m_swapErrorCount;
+            m_isDirty.store(true, std::memory_order_release);  // Retry the copy next frame
             // Stale front buffer preserved - rendering continues with old state
         }
         catch (...)
@@ -323,6 +476,7 @@ public:
             DAEMON_LOG(LogCore, eLogVerbosity::Error,
                        "StateBuffer::SwapBuffers - Unknown exception during buffer copy. Preserving stale front buffer.");
             ++m_swapErrorCount;
+            m_isDirty.store(true, std::memory_order_release);  // Retry the copy next frame
             // Stale front buffer preserved - rendering continues with old state
         }
     }
@@ -353,14 +507,14 @@ public:
     // Thread Safety: Lock-free read, may race with SwapBuffers()
     uint64_t GetSwapErrorCount() const
     {
-        return m_swapErrorCount;
+        return m_swapErrorCount + m_publishErrorCount;
     }
 
     // Check if any swap errors have occurred
     // Thread Safety: Lock-free read, may race with SwapBuffers()
     bool HasSwapErrors() const
     {
-        return m_swapErrorCount > 0;
+        return GetSwapErrorCount() > 0;
     }
 
     // Get total mutex timeout events (for monitoring)
@@ -405,22 +559,75 @@ public:
     // Enable/disable per-key dirty tracking optimization
     // When enabled: SwapBuffers() copies only dirty keys (O(d) where d = dirty count)
     // When disabled: SwapBuffers() copies entire buffer (O(n) where n = total entities)
+    // backend selects how MarkDirty() records keys (see eDirtyTrackingBackend)
     // Thread Safety: Should be called before any GetBackBuffer() calls (setup only)
-    void EnableDirtyTracking(bool const enable)
+    void EnableDirtyTracking(bool const enable, eDirtyTrackingBackend const backend = eDirtyTrackingBackend::LOCKED_HASH_SET)
     {
         m_dirtyTrackingEnabled = enable;
+        m_dirtyTrackingBackend = backend;
+
+        if (enable && backend == eDirtyTrackingBackend::APPEND_LOG)
+        {
+            for (sDirtyLogSegment& segment : m_dirtyLogSegments)
+            {
+                if (segment.m_capacity == 0)
+                {
+                    segment.m_slots    = std::make_unique<sDirtyLogSlot[]>(DIRTY_LOG_INITIAL_CAPACITY);
+                    segment.m_capacity = DIRTY_LOG_INITIAL_CAPACITY;
+                }
+            }
+        }
     }
 
     // Mark specific key as dirty (call after modifying entity in back buffer)
-    // Thread Safety: Thread-safe with mutex protection
-    // Performance: O(1) unordered_set insert
+    // Thread Safety: Thread-safe from any number of threads, also while SwapBuffers() / PublishBackBuffer()
+    //                runs (LOCKED_HASH_SET: mutex; APPEND_LOG: lock-free unless the active segment is full).
+    //                A key marked during a drain is picked up by the next one.
+    // Performance: LOCKED_HASH_SET: O(1) unordered_set insert; APPEND_LOG: one atomic add + two stores
     void MarkDirty(KeyType const& key)
     {
         if (!m_dirtyTrackingEnabled) return;
 
+        // m_isDirty is raised after the key is recorded: a swap clears it before draining, so a key
+        // recorded too late for that drain always leaves the flag set for the next one
+        if (m_dirtyTrackingBackend == eDirtyTrackingBackend::APPEND_LOG)
+        {
+            for (;;)
+            {
+                sDirtyLogSegment& segment = m_dirtyLogSegments[m_activeDirtyLogSegment.load(std::memory_order_acquire)];
+
+                // A slot claimed before DrainDirtyLog() closes the segment is waited for by that drain;
+                // once closed, retry on the segment the drain switched to
+                uint64_t const previousState = segment.m_state.fetch_add(DIRTY_LOG_CLAIM_ONE, std::memory_order_acquire);
+                if ((previousState & DIRTY_LOG_CLOSED_BIT) != 0)
+                {
+                    continue;
+                }
+
+                // Each caller owns the slot it claimed; duplicates are removed at drain time
+                size_t const slot = static_cast<size_t>(previousState >> DIRTY_LOG_CLAIM_SHIFT);
+                if (slot < segment.m_capacity)
+                {
+                    // Release publishes the key to the drain that waits for this epoch
+                    segment.m_slots[slot].m_key = key;
+                    segment.m_slots[slot].m_writtenEpoch.store(segment.m_epoch, std::memory_order_release);
+                }
+                else
+                {
+                    // Segment full this frame: spill under the mutex, DrainDirtyLog() grows it for next time
+                    std::lock_guard lock(m_dirtyKeysMutex);
+                    segment.m_overflow.push_back(key);
+                }
+                break;
+            }
+        }
+        else
+        {
+            std::lock_guard lock(m_dirtyKeysMutex);
+            m_dirtyKeys.insert(key);
+        }
+
         m_isDirty.store(true, std::memory_order_release);
-        std::lock_guard lock(m_dirtyKeysMutex);
-        m_dirtyKeys.insert(key);
     }
 
     //------------------------------------------------------------------------------------------------
@@ -429,12 +636,18 @@ public:
 
     // Get count of dirty keys in current dirty set
     // Returns: Number of entities marked dirty since last swap
+    //          (APPEND_LOG: number of MarkDirty() calls, duplicates included, until the drain)
     // Thread Safety: Thread-safe with mutex protection
     // Performance: O(1) unordered_set::size()
     size_t GetDirtyCount() const
     {
         if (!m_dirtyTrackingEnabled) return 0;
 
+        if (m_dirtyTrackingBackend == eDirtyTrackingBackend::APPEND_LOG)
+        {
+            return GetDirtyLogClaimCount(0) + GetDirtyLogClaimCount(1);
+        }
+
         std::lock_guard lock(m_dirtyKeysMutex);
         return m_dirtyKeys.size();
     }
@@ -457,21 +670,55 @@ public:
         return m_totalCopyOperations;
     }
 
+    //------------------------------------------------------------------------------------------------
+    // Triple-Buffer Metrics
+    //------------------------------------------------------------------------------------------------
+
+    // Snapshots handed over by PublishBackBuffer()
+    uint64_t GetTotalPublishes() const
+    {
+        return m_totalPublishes;
+    }
+
+    // Snapshots replaced by a newer publish before SwapBuffers() picked them up (writer outpaced reader)
+    uint64_t GetDroppedSnapshotCount() const
+    {
+        return m_droppedSnapshots;
+    }
+
 private:
     //------------------------------------------------------------------------------------------------
     // Phase 3.3: Mutex Timeout Configuration
     //------------------------------------------------------------------------------------------------
     static constexpr std::chrono::milliseconds SWAP_MUTEX_TIMEOUT{10};  // 10ms timeout (10x normal swap duration)
 
+    //------------------------------------------------------------------------------------------------
+    // Triple-Buffer Ready Slot Encoding: low 2 bits = buffer index, bit 2 = unread snapshot
+    //------------------------------------------------------------------------------------------------
+    static constexpr uint8_t READY_INDEX_MASK = 0x03;
+    static constexpr uint8_t READY_FRESH_BIT  = 0x04;
+
     //------------------------------------------------------------------------------------------------
     // Double-Buffer Storage
     //------------------------------------------------------------------------------------------------
     TStateContainer m_bufferA;  // Buffer A (front or back)
     TStateContainer m_bufferB;  // Buffer B (front or back)
+    TStateContainer m_bufferC;  // Buffer C (TRIPLE_BUFFER mode only: front, back or ready)
 
     TStateContainer* m_frontBuffer;  // Pointer to current front buffer (read by main thread)
     TStateContainer* m_backBuffer;   // Pointer to current back buffer (written by worker thread)
 
+    //------------------------------------------------------------------------------------------------
+    // Triple-Buffer State (indices into A/B/C)
+    //------------------------------------------------------------------------------------------------
+    eStateBufferMode     m_mode;
+    uint8_t              m_readIndex  = 0;              // Main thread only (== m_frontBuffer)
+    uint8_t              m_writeIndex = 1;              // Worker thread only (== m_backBuffer)
+    std::atomic<uint8_t> m_readyState{2};               // Shared: last published buffer + fresh bit
+    uint64_t             m_totalPublishes{0};           // Worker thread only
+    uint64_t             m_droppedSnapshots{0};         // Worker thread only
+    uint64_t             m_publishErrorCount{0};        // Worker thread only
+
     //------------------------------------------------------------------------------------------------
     // Synchronization
     //------------------------------------------------------------------------------------------------
@@ -497,12 +744,155 @@ private:
     mutable std::mutex          m_dirtyKeysMutex;      // Protects m_dirtyKeys access
     bool                        m_dirtyTrackingEnabled{false};       // Enable per-key optimization
 
+    //------------------------------------------------------------------------------------------------
+    // Lock-Free Dirty Append Log (eDirtyTrackingBackend::APPEND_LOG)
+    //------------------------------------------------------------------------------------------------
+    static constexpr size_t DIRTY_LOG_INITIAL_CAPACITY = 1024;
+
+    // Segment state word: claimed slot count << 1 | closed bit
+    static constexpr int      DIRTY_LOG_CLAIM_SHIFT = 1;
+    static constexpr uint64_t DIRTY_LOG_CLAIM_ONE   = 1ull << DIRTY_LOG_CLAIM_SHIFT;
+    static constexpr uint64_t DIRTY_LOG_CLOSED_BIT  = 1;
+
+    struct sDirtyLogSlot
+    {
+        KeyType               m_key{};
+        std::atomic<uint32_t> m_writtenEpoch{0};    // Segment epoch of the drain this key belongs to
+    };
+
+    // One half of the append log; MarkDirty() appends to the active one while DrainDirtyLog() empties the other
+    struct sDirtyLogSegment
+    {
+        std::unique_ptr<sDirtyLogSlot[]> m_slots;           // Preallocated; replaced only by DrainDirtyLog() while closed
+        size_t                           m_capacity{0};
+        uint32_t                         m_epoch{1};        // Tags this round's slot writes; advanced by each drain, never 0
+        std::atomic<uint64_t>            m_state{0};        // See DIRTY_LOG_*; the claim count may exceed m_capacity
+        std::vector<KeyType>             m_overflow;        // Spill when the slots are full (m_dirtyKeysMutex)
+    };
+
+    eDirtyTrackingBackend                 m_dirtyTrackingBackend{eDirtyTrackingBackend::LOCKED_HASH_SET};
+    std::array<sDirtyLogSegment, 2>       m_dirtyLogSegments;
+    std::atomic<uint32_t>                 m_activeDirtyLogSegment{0};  // Segment MarkDirty() appends to
+    std::vector<KeyType>                  m_drainedDirtyKeys;          // Sorted, unique keys from the last drain
+
     //------------------------------------------------------------------------------------------------
     // Performance Metrics (Phase 4.3)
     //------------------------------------------------------------------------------------------------
     RunningAverage<float, 60> m_dirtyRatios;  // Average dirty ratio over last 60 frames
     uint64_t                  m_totalCopyOperations{0};        // Total entities copied (for profiling)
 
+    //------------------------------------------------------------------------------------------------
+    // Dirty Append Log Drain
+    //------------------------------------------------------------------------------------------------
+
+    // Switch writers to the other segment, close the old one and wait for the slots claimed before the
+    // close to be written, then move its keys into m_drainedDirtyKeys, sort + unique (no hash set) and reset it
+    // Returns: Number of unique dirty keys
+    // Called by the single swapping thread (SwapBuffers / PublishBackBuffer); writers keep running
+    size_t DrainDirtyLog()
+    {
+        uint32_t const    segmentIndex = m_activeDirtyLogSegment.load(std::memory_order_relaxed);
+        sDirtyLogSegment& segment      = m_dirtyLogSegments[segmentIndex];
+
+        // New writers go to the other segment; the close fixes which slots this drain owns
+        m_activeDirtyLogSegment.store(segmentIndex ^ 1u, std::memory_order_release);
+        uint64_t const closedState = segment.m_state.fetch_or(DIRTY_LOG_CLOSED_BIT, std::memory_order_acq_rel);
+
+        size_t const loggedCount = static_cast<size_t>(closedState >> DIRTY_LOG_CLAIM_SHIFT);
+        size_t const storedCount = std::min(loggedCount, segment.m_capacity);
+
+        // Writers that claimed before the close finish in a few instructions; later ones only retry
+        m_drainedDirtyKeys.clear();
+        for (size_t slot = 0; slot < storedCount; ++slot)
+        {
+            while (segment.m_slots[slot].m_writtenEpoch.load(std::memory_order_acquire) != segment.m_epoch)
+            {
+                std::this_thread::yield();
+            }
+            m_drainedDirtyKeys.push_back(segment.m_slots[slot].m_key);
+        }
+
+        if (loggedCount > segment.m_capacity)
+        {
+            size_t const overflowCount = loggedCount - segment.m_capacity;
+            for (;;)
+            {
+                std::unique_lock lock(m_dirtyKeysMutex);
+                if (segment.m_overflow.size() >= overflowCount)
+                {
+                    m_drainedDirtyKeys.insert(m_drainedDirtyKeys.end(), segment.m_overflow.begin(), segment.m_overflow.end());
+                    segment.m_overflow.clear();
+                    break;
+                }
+                lock.unlock();
+                std::this_thread::yield();
+            }
+
+            // Grow so a frame like this one fits without spilling next time
+            size_t newCapacity = std::max(segment.m_capacity, DIRTY_LOG_INITIAL_CAPACITY);
+            while (newCapacity < loggedCount)
+            {
+                newCapacity *= 2;
+            }
+            segment.m_slots    = std::make_unique<sDirtyLogSlot[]>(newCapacity);
+            segment.m_capacity = newCapacity;
+        }
+
+        // A new epoch invalidates every slot without touching them
+        if (++segment.m_epoch == 0)
+        {
+            segment.m_epoch = 1;
+        }
+
+        // Reopen empty (drops the claims of writers that retried). A writer that read the index before
+        // the switch may still append here: HasPendingDirtyLog() keeps swaps coming until a later
+        // drain picks that key up
+        segment.m_state.store(0, std::memory_order_release);
+
+        std::sort(m_drainedDirtyKeys.begin(), m_drainedDirtyKeys.end());
+        m_drainedDirtyKeys.erase(std::unique(m_drainedDirtyKeys.begin(), m_drainedDirtyKeys.end()), m_drainedDirtyKeys.end());
+
+        return m_drainedDirtyKeys.size();
+    }
+
+    size_t GetDirtyLogClaimCount(uint32_t const segmentIndex) const
+    {
+        return static_cast<size_t>(m_dirtyLogSegments[segmentIndex].m_state.load(std::memory_order_relaxed) >> DIRTY_LOG_CLAIM_SHIFT);
+    }
+
+    // Keys appended that no drain has taken yet (normally implies m_isDirty; see DrainDirtyLog)
+    bool HasPendingDirtyLog() const
+    {
+        return m_dirtyTrackingEnabled && m_dirtyTrackingBackend == eDirtyTrackingBackend::APPEND_LOG &&
+               GetDirtyLogClaimCount(0) + GetDirtyLogClaimCount(1) > 0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Triple-Buffer Helpers
+    //------------------------------------------------------------------------------------------------
+
+    TStateContainer* GetBufferByIndex(uint8_t const index)
+    {
+        return index == 0 ? &m_bufferA : (index == 1 ? &m_bufferB : &m_bufferC);
+    }
+
+    // Reader side of the triple buffer: swap the front buffer for the newest published snapshot
+    void AcquireLatestSnapshot()
+    {
+        if ((m_readyState.load(std::memory_order_relaxed) & READY_FRESH_BIT) == 0)
+        {
+            ++m_skippedSwaps;  // Nothing new published; keep the current snapshot
+            return;
+        }
+
+        // Acquire pairs with the writer's release so the snapshot contents are visible
+        uint8_t const previousReady = m_readyState.exchange(m_readIndex, std::memory_order_acq_rel);
+
+        m_readIndex   = static_cast<uint8_t>(previousReady & READY_INDEX_MASK);
+        m_frontBuffer = GetBufferByIndex(m_readIndex);
+        ++m_totalSwaps;
+    }
+
     //------------------------------------------------------------------------------------------------
     // Buffer Validation (Phase 3.1)
     //------------------------------------------------------------------------------------------------
@@ -684,4 +1074,43 @@ private:
 //   Monitoring API:
 //     - IsDirty(): Check if back buffer has pending changes
 //     - GetSkippedSwaps(): Count of swaps skipped due to clean buffer
+//
+// Triple-Buffer Mode (eStateBufferMode::TRIPLE_BUFFER)
+//   Goal:
+//     - Remove the swap mutex and its timeouts (GetTimeoutCount() stays 0 in this mode)
+//     - Reader always renders the newest complete snapshot; writer never waits for the reader
+//
+//   Implementation:
+//     - Three buffers: front (reader), back (writer), ready (last published, shared)
+//     - m_readyState packs the ready buffer index and a "fresh" bit into one atomic byte
+//     - Writer: PublishBackBuffer() exchanges back <-> ready (sets fresh), then copies the
+//       published snapshot into its recycled buffer so it continues from current state
+//     - Reader: SwapBuffers() exchanges front <-> ready only when the fresh bit is set
+//
+//   Usage:
+//     StateBuffer<MyStateMap> buffer(eStateBufferMode::TRIPLE_BUFFER);
+//     Worker: (*buffer.GetBackBuffer())[key] = state; ... buffer.PublishBackBuffer();
+//     Main:   buffer.SwapBuffers(); render *buffer.GetFrontBuffer();
+//
+//   Trade-offs:
+//     - 3x container storage instead of 2x
+//     - Writer pays one full copy per publish (off the main thread)
+//     - Snapshots published faster than the reader swaps are dropped (GetDroppedSnapshotCount())
+//     - Per-key dirty tracking only feeds statistics in this mode; it does not shorten the copy
+//
+// Lock-Free Dirty Tracking (eDirtyTrackingBackend::APPEND_LOG)
+//   Goal:
+//     - Remove the per-call mutex + unordered_set node allocation from MarkDirty()
+//
+//   Implementation:
+//     - MarkDirty(): one fetch_add on the active segment's m_state claims a slot in the preallocated
+//       m_slots; the key is published with a release store of the segment's current epoch
+//     - Drain at the frame boundary: flip m_activeDirtyLogSegment, close the old segment (fetch_or),
+//       wait until each slot claimed before the close carries the epoch, then copy, std::sort,
+//       std::unique; KeyType needs operator<. Writers that hit the closed segment retry on the new
+//       one, so no key is lost or half-written and a segment is never resized under a writer
+//     - Frames that overflow a segment spill into a mutex-protected vector, and the drain doubles
+//       that segment until the frame would have fit (steady state: no locks, no allocations)
+//     - GetAverageDirtyRatio() / GetTotalCopyOperations() use the deduplicated count, so both
+//       backends report comparable statistics
 //----------------------------------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+//----------------------------------------------------------------------------------------------------
+// WorkStealingDeque.hpp
+// Engine Core Module - Lock-Free Chase-Lev Work-Stealing Deque
+//
+// Purpose:
+//   Bounded, lock-free deque used by JobSystem's work-stealing scheduler. Each JobWorkerThread owns
+//   one deque: the owner pushes and pops at the bottom (LIFO, cache-warm), while idle workers steal
+//   from the top (FIFO, oldest work first).
+//
+// Design Rationale:
+//   - Chase-Lev algorithm (C11 memory model formulation by Le, Pop, Cohen, Zappa Nardelli 2013)
+//   - Fixed power-of-two capacity: index wrapping is a mask, no buffer growth or reclamation
+//   - PushBottom() returns false when full so the caller can fall back to a shared queue
+//   - Element type must be trivially copyable (JobSystem stores Job*)
+//
+// Thread Safety Model:
+//   - PushBottom() / PopBottom(): Owner thread only
+//   - StealTop(): Any thread, concurrently with the owner and other thieves
+//
+// Author: JobSystem Work-Stealing Scheduler
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+// Suppress C4324: Structure padding warning for cache-line alignment
+#pragma warning(push)
+#pragma warning(disable: 4324)
+
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque element type must be trivially copyable");
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t CACHE_LINE_SIZE  = 64;
+
+    // Capacity is rounded up to the next power of two
+    explicit WorkStealingDeque(size_t capacity = DEFAULT_CAPACITY);
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(WorkStealingDeque const&)            = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque const&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&)                 = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&)      = delete;
+
+    // Owner thread: push at the bottom. Returns false when the deque is full.
+    bool PushBottom(T item);
+
+    // Owner thread: pop the most recently pushed item. Returns false when empty or lost to a thief.
+    bool PopBottom(T& out_item);
+
+    // Any thread: steal the oldest item. Returns false when empty or when another thread won the race.
+    bool StealTop(T& out_item);
+
+    // Approximate number of items (monitoring only)
+    size_t GetApproximateSize() const;
+
+    size_t GetCapacity() const { return m_mask + 1; }
+
+private:
+    static size_t RoundUpToPowerOfTwo(size_t value);
+
+    std::unique_ptr<std::atomic<T>[]> m_buffer;
+    size_t                            m_mask = 0;
+
+    // Thieves CAS m_top, owner writes m_bottom; keep them on separate cache lines
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_top    = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_bottom = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Template Implementation
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t const capacity)
+{
+    size_t const roundedCapacity = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+    m_buffer = std::make_unique<std::atomic<T>[]>(roundedCapacity);
+    m_mask   = roundedCapacity - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+// PushBottom (owner only)
+//
+// The release fence publishes the slot write before the new bottom becomes visible to thieves.
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool WorkStealingDeque<T>::PushBottom(T item)
+{
+    int64_t const bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t const top    = m_top.load(std::memory_order_acquire);
+
+    if (bottom - top > static_cast<int64_t>(m_mask))
+    {
+        return false;  // Full - caller falls back to shared queue
+    }
+
+    m_buffer[static_cast<size_t>(bottom) & m_mask].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// PopBottom (owner only)
+//
+// Reserves the bottom slot first, then races thieves with a CAS on m_top only when a single item
+// remains. The seq_cst fence orders the bottom reservation against the top read.
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool WorkStealingDeque<T>::PopBottom(T& out_item)
+{
+    int64_t const bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // Empty - restore bottom
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    out_item = m_buffer[static_cast<size_t>(bottom) & m_mask].load(std::memory_order_relaxed);
+
+    if (top != bottom)
+    {
+        return true;  // More than one item left, no race possible
+    }
+
+    // Last item - race against thieves
+    bool const won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return won;
+}
+
+//----------------------------------------------------------------------------------------------------
+// StealTop (any thread)
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool WorkStealingDeque<T>::StealTop(T& out_item)
+{
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t const bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;  // Empty
+    }
+
+    T const item = m_buffer[static_cast<size_t>(top) & m_mask].load(std::memory_order_relaxed);
+
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return false;  // Lost race to owner or another thief
+    }
+
+    out_item = item;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+size_t WorkStealingDeque<T>::GetApproximateSize() const
+{
+    int64_t const bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t const top    = m_top.load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+size_t WorkStealingDeque<T>::RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Restore warning settings
+#pragma warning(pop)
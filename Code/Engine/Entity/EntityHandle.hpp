@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------------------------------
+// EntityHandle.hpp
+// Engine Entity Module - Generational Entity Slot Handle
+//
+// Purpose:
+//   Defines EntityHandle, a (slot index, generation) pair returned by EntityStateSoABuffer.
+//   Resolving a handle is two array reads instead of an EntityID hash lookup.
+//
+// Design Rationale:
+//   - Slot index is stable for the entity's lifetime (dense storage may move, the slot does not)
+//   - Generation increments whenever a slot is freed, so stale handles fail IsAlive() checks
+//   - Generation 0 is never issued, so a default-constructed handle is always invalid
+//   - 8 bytes, trivially copyable, safe to store in components or pass to JavaScript as a number
+//
+// Author: Entity State SoA Storage
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct EntityHandle
+{
+    uint32_t m_slotIndex  = 0;
+    uint32_t m_generation = 0;    // 0 = invalid handle
+
+    bool IsValid() const { return m_generation != 0; }
+
+    // Pack into a single 64-bit value (generation in the high bits) for scripting / serialization
+    uint64_t ToPacked() const { return (static_cast<uint64_t>(m_generation) << 32) | m_slotIndex; }
+
+    static EntityHandle FromPacked(uint64_t const packed)
+    {
+        return EntityHandle{ static_cast<uint32_t>(packed & 0xFFFFFFFFu), static_cast<uint32_t>(packed >> 32) };
+    }
+
+    bool operator==(EntityHandle const& compare) const = default;
+};
@@ -83,4 +83,9 @@ using EntityStateBuffer = StateBuffer<EntityStateMap>;
 //   - If game-specific helper methods needed, create wrapper class
 //   - Example: GetPlayerEntity(), GetEntitiesByTag(), etc.
 //   - For now, simple typedef is sufficient
+//
+// High Entity Counts:
+//   - Every swap deep-copies EntityState's meshType/cameraType strings for each copied entity
+//   - For tens of thousands of entities use EntityStateSoABuffer (EntityStateSoABuffer.hpp):
+//     interned type IDs, SoA columns, EntityHandle access, lock-free O(dirty) publishes
 //----------------------------------------------------------------------------------------------------
@@ -0,0 +1,456 @@
+//----------------------------------------------------------------------------------------------------
+// EntityStateSoABuffer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Entity/EntityStateSoABuffer.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Entity/EntityState.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+// sEntityStateColumns
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::Reserve(size_t const capacity)
+{
+    m_entityIDs.reserve(capacity);
+    m_positions.reserve(capacity);
+    m_orientations.reserve(capacity);
+    m_colors.reserve(capacity);
+    m_radii.reserve(capacity);
+    m_meshTypeIDs.reserve(capacity);
+    m_cameraTypeIDs.reserve(capacity);
+    m_textureIDs.reserve(capacity);
+    m_isActive.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::PushRow(EntityID const entityID, EntityState const& state)
+{
+    m_entityIDs.push_back(entityID);
+    m_positions.push_back(state.position);
+    m_orientations.push_back(state.orientation);
+    m_colors.push_back(state.color);
+    m_radii.push_back(state.radius);
+    m_meshTypeIDs.push_back(InternString(state.meshType));
+    m_cameraTypeIDs.push_back(InternString(state.cameraType));
+    m_textureIDs.push_back(state.textureId);
+    m_isActive.push_back(state.isActive ? 1 : 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::SetRow(size_t const row, EntityState const& state)
+{
+    m_positions[row]     = state.position;
+    m_orientations[row]  = state.orientation;
+    m_colors[row]        = state.color;
+    m_radii[row]         = state.radius;
+    m_meshTypeIDs[row]   = InternString(state.meshType);
+    m_cameraTypeIDs[row] = InternString(state.cameraType);
+    m_textureIDs[row]    = state.textureId;
+    m_isActive[row]      = state.isActive ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::CopyRow(size_t const destinationRow, size_t const sourceRow)
+{
+    m_entityIDs[destinationRow]     = m_entityIDs[sourceRow];
+    m_positions[destinationRow]     = m_positions[sourceRow];
+    m_orientations[destinationRow]  = m_orientations[sourceRow];
+    m_colors[destinationRow]        = m_colors[sourceRow];
+    m_radii[destinationRow]         = m_radii[sourceRow];
+    m_meshTypeIDs[destinationRow]   = m_meshTypeIDs[sourceRow];
+    m_cameraTypeIDs[destinationRow] = m_cameraTypeIDs[sourceRow];
+    m_textureIDs[destinationRow]    = m_textureIDs[sourceRow];
+    m_isActive[destinationRow]      = m_isActive[sourceRow];
+}
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::CopyRowFrom(sEntityStateColumns const& source, size_t const row)
+{
+    m_entityIDs[row]     = source.m_entityIDs[row];
+    m_positions[row]     = source.m_positions[row];
+    m_orientations[row]  = source.m_orientations[row];
+    m_colors[row]        = source.m_colors[row];
+    m_radii[row]         = source.m_radii[row];
+    m_meshTypeIDs[row]   = source.m_meshTypeIDs[row];
+    m_cameraTypeIDs[row] = source.m_cameraTypeIDs[row];
+    m_textureIDs[row]    = source.m_textureIDs[row];
+    m_isActive[row]      = source.m_isActive[row];
+}
+
+//----------------------------------------------------------------------------------------------------
+// Column elements own no heap memory, so each assignment is one tight copy loop (a memmove for the
+// trivially copyable columns) that reuses the destination's capacity; it only allocates when the
+// entity count reaches a new high.
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::CopyAllFrom(sEntityStateColumns const& source)
+{
+    m_entityIDs     = source.m_entityIDs;
+    m_positions     = source.m_positions;
+    m_orientations  = source.m_orientations;
+    m_colors        = source.m_colors;
+    m_radii         = source.m_radii;
+    m_meshTypeIDs   = source.m_meshTypeIDs;
+    m_cameraTypeIDs = source.m_cameraTypeIDs;
+    m_textureIDs    = source.m_textureIDs;
+    m_isActive      = source.m_isActive;
+}
+
+//----------------------------------------------------------------------------------------------------
+void sEntityStateColumns::PopRow()
+{
+    m_entityIDs.pop_back();
+    m_positions.pop_back();
+    m_orientations.pop_back();
+    m_colors.pop_back();
+    m_radii.pop_back();
+    m_meshTypeIDs.pop_back();
+    m_cameraTypeIDs.pop_back();
+    m_textureIDs.pop_back();
+    m_isActive.pop_back();
+}
+
+//----------------------------------------------------------------------------------------------------
+// EntityStateSoABuffer
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+EntityStateSoABuffer::EntityStateSoABuffer(size_t const initialCapacity)
+{
+    if (initialCapacity > 0)
+    {
+        for (sEntityStateColumns& buffer : m_buffers)
+        {
+            buffer.Reserve(initialCapacity);
+        }
+        m_slots.reserve(initialCapacity);
+        m_denseRowToSlot.reserve(initialCapacity);
+        m_rowDirtyFlags.reserve(initialCapacity);
+        m_dirtyRows.reserve(initialCapacity);
+        m_handlesByEntityID.reserve(initialCapacity);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityHandle EntityStateSoABuffer::CreateEntity(EntityID const entityID, EntityState const& initialState)
+{
+    if (m_handlesByEntityID.contains(entityID))
+    {
+        return EntityHandle{};
+    }
+
+    uint32_t slotIndex;
+    if (!m_freeSlots.empty())
+    {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    uint32_t const denseRow = static_cast<uint32_t>(m_backBuffer->GetCount());
+
+    sEntitySlot& slot = m_slots[slotIndex];
+    slot.m_denseRow   = denseRow;
+
+    m_backBuffer->PushRow(entityID, initialState);
+    m_denseRowToSlot.push_back(slotIndex);
+    m_rowDirtyFlags.push_back(0);
+
+    EntityHandle const handle{ slotIndex, slot.m_generation };
+    m_handlesByEntityID.emplace(entityID, handle);
+
+    m_isStructureDirty = true;
+    m_isDirty          = true;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EntityStateSoABuffer::DestroyEntity(EntityHandle const handle)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW)
+    {
+        return false;
+    }
+
+    m_handlesByEntityID.erase(m_backBuffer->m_entityIDs[denseRow]);
+
+    // Swap-and-pop: move the last row into the hole and re-point its slot
+    uint32_t const lastRow = static_cast<uint32_t>(m_backBuffer->GetCount() - 1);
+    if (denseRow != lastRow)
+    {
+        m_backBuffer->CopyRow(denseRow, lastRow);
+
+        uint32_t const movedSlot      = m_denseRowToSlot[lastRow];
+        m_denseRowToSlot[denseRow]    = movedSlot;
+        m_slots[movedSlot].m_denseRow = denseRow;
+    }
+
+    m_backBuffer->PopRow();
+    m_denseRowToSlot.pop_back();
+    m_rowDirtyFlags.pop_back();
+
+    // Retire the slot; skip generation 0 on wrap so handles never become "invalid but alive"
+    sEntitySlot& slot = m_slots[handle.m_slotIndex];
+    slot.m_denseRow   = INVALID_DENSE_ROW;
+    slot.m_generation = (slot.m_generation == 0xFFFFFFFFu) ? 1 : slot.m_generation + 1;
+    m_freeSlots.push_back(handle.m_slotIndex);
+
+    m_isStructureDirty = true;
+    m_isDirty          = true;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityHandle EntityStateSoABuffer::FindEntity(EntityID const entityID) const
+{
+    auto const found = m_handlesByEntityID.find(entityID);
+    return found != m_handlesByEntityID.end() ? found->second : EntityHandle{};
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EntityStateSoABuffer::IsAlive(EntityHandle const handle) const
+{
+    return ResolveDenseRow(handle) != INVALID_DENSE_ROW;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetPosition(EntityHandle const handle, Vec3 const& position)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_positions[denseRow] = position;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetOrientation(EntityHandle const handle, EulerAngles const& orientation)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_orientations[denseRow] = orientation;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetColor(EntityHandle const handle, Rgba8 const& color)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_colors[denseRow] = color;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetRadius(EntityHandle const handle, float const radius)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_radii[denseRow] = radius;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetMeshType(EntityHandle const handle, InternedStringID const meshTypeID)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_meshTypeIDs[denseRow] = meshTypeID;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetCameraType(EntityHandle const handle, InternedStringID const cameraTypeID)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_cameraTypeIDs[denseRow] = cameraTypeID;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetTextureID(EntityHandle const handle, uint64_t const textureID)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_textureIDs[denseRow] = textureID;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetActive(EntityHandle const handle, bool const isActive)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->m_isActive[denseRow] = isActive ? 1 : 0;
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SetState(EntityHandle const handle, EntityState const& state)
+{
+    uint32_t const denseRow = ResolveDenseRow(handle);
+    if (denseRow == INVALID_DENSE_ROW) return;
+
+    m_backBuffer->SetRow(denseRow, state);
+    MarkRowDirty(denseRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+// PublishBackBuffer
+//
+// 1. Exchange the back buffer index into the ready slot, tagged fresh (release: the column writes
+//    become visible to the SwapBuffers() that takes it)
+// 2. Continue on whichever buffer was in the ready slot, and catch it up to the published snapshot:
+//      - one snapshot behind (the reader skipped one): copy this publish's dirty rows
+//      - two behind (the reader's previous front, the per-frame steady state): also the rows
+//        dirtied by the publish before
+//      - older, structural change, or mostly-dirty: whole-column copy
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::PublishBackBuffer()
+{
+    if (!m_isDirty)
+    {
+        return;
+    }
+
+    uint8_t const publishedIndex      = m_writeIndex;
+    m_bufferSequences[publishedIndex] = ++m_publishSequence;
+
+    uint8_t const previousReady = m_readyState.exchange(static_cast<uint8_t>(publishedIndex | READY_FRESH_BIT), std::memory_order_acq_rel);
+
+    m_writeIndex = static_cast<uint8_t>(previousReady & READY_INDEX_MASK);
+    m_backBuffer = &m_buffers[m_writeIndex];
+    ++m_totalPublishes;
+
+    if ((previousReady & READY_FRESH_BIT) != 0)
+    {
+        ++m_droppedSnapshots;  // Reader never saw the previous snapshot
+    }
+
+    // The published buffer is read-only from here on, so reading it concurrently with the main thread is safe
+    sEntityStateColumns const& publishedBuffer = m_buffers[publishedIndex];
+
+    size_t const   rowCount        = publishedBuffer.GetCount();
+    uint64_t const snapshotsBehind = m_publishSequence - m_bufferSequences[m_writeIndex];
+    bool const     canCopyRows     = !m_isStructureDirty && (snapshotsBehind == 1 || (snapshotsBehind == 2 && !m_wasStructureDirtyBefore));
+    size_t const   copyCount       = m_dirtyRows.size() + (snapshotsBehind == 2 ? m_previousDirtyRows.size() : 0);
+
+    if (!canCopyRows || static_cast<float>(copyCount) > static_cast<float>(rowCount) * FULL_COPY_DIRTY_RATIO)
+    {
+        m_backBuffer->CopyAllFrom(publishedBuffer);
+        m_totalCopyOperations += rowCount;
+        ++m_fullCopyCount;
+
+        // Rows may have moved since they were listed; reset every flag (already paying O(n))
+        std::fill(m_rowDirtyFlags.begin(), m_rowDirtyFlags.end(), static_cast<uint8_t>(0));
+    }
+    else
+    {
+        for (uint32_t const row : m_dirtyRows)
+        {
+            m_backBuffer->CopyRowFrom(publishedBuffer, row);
+        }
+        m_totalCopyOperations += m_dirtyRows.size();
+
+        // Rows still flagged were just copied; the hot set is usually the same from frame to frame
+        if (snapshotsBehind == 2)
+        {
+            for (uint32_t const row : m_previousDirtyRows)
+            {
+                if (m_rowDirtyFlags[row] == 0)
+                {
+                    m_backBuffer->CopyRowFrom(publishedBuffer, row);
+                    ++m_totalCopyOperations;
+                }
+            }
+        }
+
+        for (uint32_t const row : m_dirtyRows)
+        {
+            m_rowDirtyFlags[row] = 0;
+        }
+    }
+
+    m_bufferSequences[m_writeIndex] = m_publishSequence;
+
+    if (rowCount > 0)
+    {
+        size_t const dirtyCount = m_isStructureDirty ? rowCount : m_dirtyRows.size();
+        m_dirtyRatios.Add(static_cast<float>(dirtyCount) / static_cast<float>(rowCount));
+    }
+
+    // Keep this publish's rows: the next recycled buffer may be the one published before it
+    m_previousDirtyRows.swap(m_dirtyRows);
+    m_dirtyRows.clear();
+
+    m_wasStructureDirtyBefore = m_isStructureDirty;
+    m_isStructureDirty        = false;
+    m_isDirty                 = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// SwapBuffers
+//
+// Only this function clears the fresh bit, so a relaxed pre-check cannot miss a snapshot it would
+// have taken; the exchange itself acquires the snapshot and returns the old front buffer to the writer.
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::SwapBuffers()
+{
+    if ((m_readyState.load(std::memory_order_relaxed) & READY_FRESH_BIT) == 0)
+    {
+        ++m_skippedSwaps;  // Nothing new published; keep the current snapshot
+        return;
+    }
+
+    uint8_t const previousReady = m_readyState.exchange(m_readIndex, std::memory_order_acq_rel);
+
+    m_readIndex   = static_cast<uint8_t>(previousReady & READY_INDEX_MASK);
+    m_frontBuffer = &m_buffers[m_readIndex];
+    ++m_totalSwaps;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t EntityStateSoABuffer::ResolveDenseRow(EntityHandle const handle) const
+{
+    if (!handle.IsValid() || handle.m_slotIndex >= m_slots.size())
+    {
+        return INVALID_DENSE_ROW;
+    }
+
+    sEntitySlot const& slot = m_slots[handle.m_slotIndex];
+    return slot.m_generation == handle.m_generation ? slot.m_denseRow : INVALID_DENSE_ROW;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityStateSoABuffer::MarkRowDirty(uint32_t const denseRow)
+{
+    m_isDirty = true;
+
+    // A structural change already forces a full copy; rows may also have moved since being listed
+    if (m_isStructureDirty || m_rowDirtyFlags[denseRow] != 0)
+    {
+        return;
+    }
+
+    m_rowDirtyFlags[denseRow] = 1;
+    m_dirtyRows.push_back(denseRow);
+}
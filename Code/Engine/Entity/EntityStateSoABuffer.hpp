@@ -0,0 +1,233 @@
+//----------------------------------------------------------------------------------------------------
+// EntityStateSoABuffer.hpp
+// Engine Entity Module - Structure-of-Arrays Triple-Buffered Entity State
+//
+// Purpose:
+//   High-entity-count alternative to EntityStateBuffer (StateBuffer<EntityStateMap>). Stores entity
+//   render state as dense, heap-free columns and addresses entities by generational
+//   EntityHandle instead of hashing EntityID on every update.
+//
+// Design Rationale:
+//   - Structure of arrays: the render loop streams only the columns it needs (position, color, ...)
+//   - Mesh and camera types are InternedStringIDs, so no column owns heap memory and a row copy is
+//     a handful of plain stores (EntityState copies two std::strings per entity)
+//   - Slots (handle -> dense row) decouple stable handles from the packed dense arrays; destroying
+//     an entity moves the last row into the hole (swap-and-pop) and patches that entity's slot
+//   - Three column sets (front, back, ready) handed over through one atomic index, the same protocol
+//     as StateBuffer's TRIPLE_BUFFER mode: the writer never waits for the reader and vice versa
+//   - PublishBackBuffer() releases the finished back buffer into the ready slot, then brings the
+//     recycled buffer it gets back up to date:
+//       * O(dirty) row copies when that buffer is one or two snapshots old and no rows moved
+//         (two is the steady state when the main thread swaps once per publish)
+//       * whole-column copy (contiguous, per column) after create/destroy, for older buffers, or
+//         when most rows are dirty
+//   - SwapBuffers() acquires the newest published snapshot as the front buffer; no copy
+//   - Steady state is allocation-free: columns keep their capacity across publishes
+//
+// Usage:
+//   Worker Thread:
+//     EntityHandle handle = buffer->CreateEntity(entityID, EntityState(...));
+//     buffer->SetPosition(handle, newPosition);
+//     buffer->PublishBackBuffer();                // End of the worker's update
+//
+//   Main Thread (Frame Boundary):
+//     buffer->SwapBuffers();
+//
+//   Main Thread (Rendering):
+//     sEntityStateColumns const* front = buffer->GetFrontBuffer();
+//     for (size_t row = 0; row < front->GetCount(); ++row) {
+//         if (front->m_isActive[row]) RenderEntity(front->m_positions[row], front->m_colors[row], ...);
+//     }
+//
+// Thread Safety Model:
+//   - Writer methods (Create/Destroy/Set*/Find/IsAlive/PublishBackBuffer): single worker thread
+//   - GetFrontBuffer()/SwapBuffers(): single main thread
+//   - The only state both threads touch is m_readyState. PublishBackBuffer()'s acq_rel exchange
+//     releases the snapshot's column writes; SwapBuffers()'s exchange acquires them and releases the
+//     main thread's reads of the old front buffer before the writer can recycle it
+//   - Both sides are lock-free and may run at any time relative to each other. A front buffer
+//     pointer is valid until the next SwapBuffers() on the main thread
+//
+// Author: Entity State SoA Storage
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/InternedString.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StateBuffer.hpp"  // RunningAverage
+#include "Engine/Entity/EntityHandle.hpp"
+#include "Engine/Entity/EntityID.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct EntityState;
+
+//----------------------------------------------------------------------------------------------------
+// sEntityStateColumns
+//
+// One full copy of entity state, one column per EntityState field. Row r of every column belongs to
+// the same entity. No element type owns heap memory.
+//----------------------------------------------------------------------------------------------------
+struct sEntityStateColumns
+{
+    std::vector<EntityID>         m_entityIDs;
+    std::vector<Vec3>             m_positions;
+    std::vector<EulerAngles>      m_orientations;
+    std::vector<Rgba8>            m_colors;
+    std::vector<float>            m_radii;
+    std::vector<InternedStringID> m_meshTypeIDs;      // GetInternedString() -> "cube", "sphere", ...
+    std::vector<InternedStringID> m_cameraTypeIDs;    // GetInternedString() -> "world" / "screen"
+    std::vector<uint64_t>         m_textureIDs;
+    std::vector<uint8_t>          m_isActive;         // uint8_t, not bool: std::vector<bool> is bit-packed
+
+    size_t GetCount() const { return m_entityIDs.size(); }
+
+    void Reserve(size_t capacity);
+    void PushRow(EntityID entityID, EntityState const& state);
+    void SetRow(size_t row, EntityState const& state);
+    void CopyRow(size_t destinationRow, size_t sourceRow);                        // Within this buffer
+    void CopyRowFrom(sEntityStateColumns const& source, size_t row);              // Same row, other buffer
+    void CopyAllFrom(sEntityStateColumns const& source);
+    void PopRow();
+};
+
+//----------------------------------------------------------------------------------------------------
+class EntityStateSoABuffer
+{
+public:
+    explicit EntityStateSoABuffer(size_t initialCapacity = 0);
+    ~EntityStateSoABuffer() = default;
+
+    EntityStateSoABuffer(EntityStateSoABuffer const&)            = delete;
+    EntityStateSoABuffer& operator=(EntityStateSoABuffer const&) = delete;
+    EntityStateSoABuffer(EntityStateSoABuffer&&)                 = delete;
+    EntityStateSoABuffer& operator=(EntityStateSoABuffer&&)      = delete;
+
+    //------------------------------------------------------------------------------------------------
+    // Writer API (worker thread)
+    //------------------------------------------------------------------------------------------------
+
+    // Add an entity; returns an invalid handle if entityID already exists
+    EntityHandle CreateEntity(EntityID entityID, EntityState const& initialState);
+
+    // Remove an entity; returns false for stale or invalid handles
+    bool DestroyEntity(EntityHandle handle);
+
+    // Look up the handle for an EntityID (hash lookup; cache the handle instead of calling per frame)
+    EntityHandle FindEntity(EntityID entityID) const;
+
+    bool IsAlive(EntityHandle handle) const;
+
+    // Field setters ignore stale handles. Each marks only the touched row dirty.
+    void SetPosition(EntityHandle handle, Vec3 const& position);
+    void SetOrientation(EntityHandle handle, EulerAngles const& orientation);
+    void SetColor(EntityHandle handle, Rgba8 const& color);
+    void SetRadius(EntityHandle handle, float radius);
+    void SetMeshType(EntityHandle handle, InternedStringID meshTypeID);
+    void SetCameraType(EntityHandle handle, InternedStringID cameraTypeID);
+    void SetTextureID(EntityHandle handle, uint64_t textureID);
+    void SetActive(EntityHandle handle, bool isActive);
+    void SetState(EntityHandle handle, EntityState const& state);   // Interns meshType / cameraType
+
+    // Hand the current back buffer to the main thread (no-op if nothing changed since the last publish)
+    void PublishBackBuffer();
+
+    //------------------------------------------------------------------------------------------------
+    // Reader API (main thread)
+    //------------------------------------------------------------------------------------------------
+    sEntityStateColumns const* GetFrontBuffer() const { return m_frontBuffer; }
+
+    //------------------------------------------------------------------------------------------------
+    // Frame boundary (main thread)
+    //------------------------------------------------------------------------------------------------
+
+    // Take the newest published snapshot as the front buffer; keeps the current one if none is new
+    void SwapBuffers();
+
+    //------------------------------------------------------------------------------------------------
+    // Monitoring: reader side (main thread)
+    //------------------------------------------------------------------------------------------------
+    size_t   GetElementCount() const { return m_frontBuffer->GetCount(); }
+    uint64_t GetTotalSwaps() const { return m_totalSwaps; }
+    uint64_t GetSkippedSwaps() const { return m_skippedSwaps; }
+
+    //------------------------------------------------------------------------------------------------
+    // Monitoring: writer side (worker thread)
+    //------------------------------------------------------------------------------------------------
+    size_t   GetDirtyCount() const { return m_dirtyRows.size(); }
+    uint64_t GetTotalPublishes() const { return m_totalPublishes; }
+    uint64_t GetDroppedSnapshots() const { return m_droppedSnapshots; }   // Replaced before the reader took them
+    uint64_t GetFullCopyCount() const { return m_fullCopyCount; }
+    uint64_t GetTotalCopyOperations() const { return m_totalCopyOperations; }
+    float    GetAverageDirtyRatio() const { return m_dirtyRatios.GetAverage(); }
+
+private:
+    // Past this fraction of dirty rows a contiguous column copy beats scattered row copies
+    static constexpr float FULL_COPY_DIRTY_RATIO = 0.5f;
+
+    static constexpr uint32_t INVALID_DENSE_ROW = 0xFFFFFFFFu;
+
+    // m_readyState layout: buffer index in the low bits, plus a flag set while the reader has not taken it
+    static constexpr uint8_t READY_INDEX_MASK = 0x03;
+    static constexpr uint8_t READY_FRESH_BIT  = 0x04;
+
+    struct sEntitySlot
+    {
+        uint32_t m_denseRow   = INVALID_DENSE_ROW;
+        uint32_t m_generation = 1;
+    };
+
+    // Dense row for a live handle, INVALID_DENSE_ROW otherwise
+    uint32_t ResolveDenseRow(EntityHandle handle) const;
+    void     MarkRowDirty(uint32_t denseRow);
+
+    std::array<sEntityStateColumns, 3> m_buffers;
+
+    // Main thread only
+    uint8_t              m_readIndex   = 0;
+    sEntityStateColumns* m_frontBuffer = &m_buffers[0];
+
+    // Worker thread only
+    uint8_t              m_writeIndex = 1;
+    sEntityStateColumns* m_backBuffer = &m_buffers[1];
+
+    // Shared: last published buffer + fresh bit
+    std::atomic<uint8_t> m_readyState{2};
+
+    // Writer-only bookkeeping
+    std::vector<sEntitySlot>                   m_slots;
+    std::vector<uint32_t>                      m_freeSlots;
+    std::vector<uint32_t>                      m_denseRowToSlot;
+    std::unordered_map<EntityID, EntityHandle> m_handlesByEntityID;
+
+    // Dirty tracking (worker thread only)
+    std::vector<uint8_t>    m_rowDirtyFlags;                  // Parallel to the dense rows
+    std::vector<uint32_t>   m_dirtyRows;                      // Since the last publish
+    std::vector<uint32_t>   m_previousDirtyRows;              // Between the last two publishes
+    bool                    m_isStructureDirty        = false; // Rows were added, removed or moved
+    bool                    m_wasStructureDirtyBefore = false; // Same, for m_previousDirtyRows
+    bool                    m_isDirty                 = false;
+    uint64_t                m_publishSequence         = 0;
+    std::array<uint64_t, 3> m_bufferSequences{};              // Snapshot each buffer last held
+
+    // Metrics (main thread)
+    uint64_t m_totalSwaps   = 0;
+    uint64_t m_skippedSwaps = 0;
+
+    // Metrics (worker thread)
+    uint64_t                  m_totalPublishes      = 0;
+    uint64_t                  m_droppedSnapshots    = 0;
+    uint64_t                  m_fullCopyCount       = 0;
+    uint64_t                  m_totalCopyOperations = 0;
+    RunningAverage<float, 60> m_dirtyRatios;
+};
@@ -8,27 +8,6 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
-//----------------------------------------------------------------------------------------------------
-Mat44::Mat44()
-{
-    m_values[Ix] = 1.f;
-    m_values[Iy] = 0.f;
-    m_values[Iz] = 0.f;
-    m_values[Iw] = 0.f;
-    m_values[Jx] = 0.f;
-    m_values[Jy] = 1.f;
-    m_values[Jz] = 0.f;
-    m_values[Jw] = 0.f;
-    m_values[Kx] = 0.f;
-    m_values[Ky] = 0.f;
-    m_values[Kz] = 1.f;
-    m_values[Kw] = 0.f;
-    m_values[Tx] = 0.f;
-    m_values[Ty] = 0.f;
-    m_values[Tz] = 0.f;
-    m_values[Tw] = 1.f;
-}
-
 //----------------------------------------------------------------------------------------------------
 Mat44::Mat44(Vec2 const& iBasis2D,
              Vec2 const& jBasis2D,
@@ -311,217 +290,195 @@ Mat44 const Mat44::MakePerspectiveProjection(float const fovYDegrees,
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec2 const Mat44::TransformVectorQuantity2D(Vec2 const& vectorQuantityXY) const
+Mat44 const Mat44::GetOrthonormalInverse() const
 {
-    float const x =
-        m_values[Ix] * vectorQuantityXY.x +
-        m_values[Jx] * vectorQuantityXY.y;
+    Mat44 result;
 
-    float const y =
-        m_values[Iy] * vectorQuantityXY.x +
-        m_values[Jy] * vectorQuantityXY.y;
+    // Transpose the rotation part (i.e., the 3x3 top-left submatrix)
+    result.m_values[Ix] = m_values[Ix];
+    result.m_values[Jx] = m_values[Iy];
+    result.m_values[Kx] = m_values[Iz];
+    result.m_values[Tx] = 0.f;  // We'll handle translation below
 
-    return Vec2(x, y);
-}
+    result.m_values[Iy] = m_values[Jx];
+    result.m_values[Jy] = m_values[Jy];
+    result.m_values[Ky] = m_values[Jz];
+    result.m_values[Ty] = 0.f;
 
-//----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::TransformVectorQuantity3D(Vec3 const& vectorQuantityXYZ) const
-{
-    float const x =
-        m_values[Ix] * vectorQuantityXYZ.x +
-        m_values[Jx] * vectorQuantityXYZ.y +
-        m_values[Kx] * vectorQuantityXYZ.z;
+    result.m_values[Iz] = m_values[Kx];
+    result.m_values[Jz] = m_values[Ky];
+    result.m_values[Kz] = m_values[Kz];
+    result.m_values[Tz] = 0.f;
 
-    float const y =
-        m_values[Iy] * vectorQuantityXYZ.x +
-        m_values[Jy] * vectorQuantityXYZ.y +
-        m_values[Ky] * vectorQuantityXYZ.z;
+    // Negate and apply rotation to translation
+    result.m_values[Tx] = -(result.m_values[Ix] * m_values[Tx] + result.m_values[Jx] * m_values[Ty] + result.m_values[Kx] * m_values[Tz]);
+    result.m_values[Ty] = -(result.m_values[Iy] * m_values[Tx] + result.m_values[Jy] * m_values[Ty] + result.m_values[Ky] * m_values[Tz]);
+    result.m_values[Tz] = -(result.m_values[Iz] * m_values[Tx] + result.m_values[Jz] * m_values[Ty] + result.m_values[Kz] * m_values[Tz]);
 
-    float const z =
-        m_values[Iz] * vectorQuantityXYZ.x +
-        m_values[Jz] * vectorQuantityXYZ.y +
-        m_values[Kz] * vectorQuantityXYZ.z;
+    //  bottom row for an affine transformation is always [0, 0, 0, 1]
+    result.m_values[Tw] = 1.f;
 
-    return Vec3(x, y, z);
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
-{
-    float const x =
-        m_values[Ix] * positionXY.x +
-        m_values[Jx] * positionXY.y +
-        m_values[Tx];
-
-    float const y =
-        m_values[Iy] * positionXY.x +
-        m_values[Jy] * positionXY.y +
-        m_values[Ty];
-
-    return Vec2(x, y);
-}
-
+// 2x2 minors of the I/J bases (s0..s5) and the K/T bases (c0..c5), shared by GetInverse() and
+// GetDeterminant()
 //----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::TransformPosition3D(Vec3 const& position3D) const
+namespace
 {
-    float const x =
-        m_values[Ix] * position3D.x +
-        m_values[Jx] * position3D.y +
-        m_values[Kx] * position3D.z +
-        m_values[Tx];
-
-    float const y =
-        m_values[Iy] * position3D.x +
-        m_values[Jy] * position3D.y +
-        m_values[Ky] * position3D.z +
-        m_values[Ty];
+    struct sMat44Minors
+    {
+        float s0, s1, s2, s3, s4, s5;
+        float c0, c1, c2, c3, c4, c5;
 
-    float const z =
-        m_values[Iz] * position3D.x +
-        m_values[Jz] * position3D.y +
-        m_values[Kz] * position3D.z +
-        m_values[Tz];
+        float GetDeterminant() const
+        {
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    };
 
-    return Vec3(x, y, z);
+    sMat44Minors ComputeMat44Minors(float const* a)
+    {
+        sMat44Minors minors;
+
+        minors.s0 = a[0] * a[5] - a[4] * a[1];
+        minors.s1 = a[0] * a[6] - a[4] * a[2];
+        minors.s2 = a[0] * a[7] - a[4] * a[3];
+        minors.s3 = a[1] * a[6] - a[5] * a[2];
+        minors.s4 = a[1] * a[7] - a[5] * a[3];
+        minors.s5 = a[2] * a[7] - a[6] * a[3];
+
+        minors.c5 = a[10] * a[15] - a[14] * a[11];
+        minors.c4 = a[9] * a[15] - a[13] * a[11];
+        minors.c3 = a[9] * a[14] - a[13] * a[10];
+        minors.c2 = a[8] * a[15] - a[12] * a[11];
+        minors.c1 = a[8] * a[14] - a[12] * a[10];
+        minors.c0 = a[8] * a[13] - a[12] * a[9];
+
+        return minors;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const
+// Laplace expansion by 2x2 minors (s0..s5 from the I/J bases, c0..c5 from K/T). The formula is written
+// for a[row][col]; applying it to the basis-major array computes the inverse of the transpose, which
+// is the transpose of the inverse, so the result comes out in the same layout.
+//----------------------------------------------------------------------------------------------------
+Mat44 const Mat44::GetInverse() const
 {
-    float const x =
-        m_values[Ix] * homogeneousPoint3D.x +
-        m_values[Jx] * homogeneousPoint3D.y +
-        m_values[Kx] * homogeneousPoint3D.z +
-        m_values[Tx] * homogeneousPoint3D.w;
+    float const* a = m_values;
 
-    float const y =
-        m_values[Iy] * homogeneousPoint3D.x +
-        m_values[Jy] * homogeneousPoint3D.y +
-        m_values[Ky] * homogeneousPoint3D.z +
-        m_values[Ty] * homogeneousPoint3D.w;
+    sMat44Minors const minors      = ComputeMat44Minors(a);
+    float const        determinant = minors.GetDeterminant();
+    if (std::abs(determinant) < FLOAT_MIN)
+    {
+        return Mat44();
+    }
 
-    float const z =
-        m_values[Iz] * homogeneousPoint3D.x +
-        m_values[Jz] * homogeneousPoint3D.y +
-        m_values[Kz] * homogeneousPoint3D.z +
-        m_values[Tz] * homogeneousPoint3D.w;
+    float const invDet = 1.f / determinant;
+    auto const& [s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5] = minors;
 
-    float const w =
-        m_values[Iw] * homogeneousPoint3D.x +
-        m_values[Jw] * homogeneousPoint3D.y +
-        m_values[Kw] * homogeneousPoint3D.z +
-        m_values[Tw] * homogeneousPoint3D.w;
+    float inverse[16];
+    inverse[0]  = (a[5] * c5 - a[6] * c4 + a[7] * c3) * invDet;
+    inverse[1]  = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * invDet;
+    inverse[2]  = (a[13] * s5 - a[14] * s4 + a[15] * s3) * invDet;
+    inverse[3]  = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * invDet;
 
-    return Vec4(x, y, z, w);
-}
+    inverse[4]  = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * invDet;
+    inverse[5]  = (a[0] * c5 - a[2] * c2 + a[3] * c1) * invDet;
+    inverse[6]  = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * invDet;
+    inverse[7]  = (a[8] * s5 - a[10] * s2 + a[11] * s1) * invDet;
 
-//----------------------------------------------------------------------------------------------------
-float* Mat44::GetAsFloatArray()
-{
-    return m_values;
-}
+    inverse[8]  = (a[4] * c4 - a[5] * c2 + a[7] * c0) * invDet;
+    inverse[9]  = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * invDet;
+    inverse[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * invDet;
+    inverse[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * invDet;
 
-//----------------------------------------------------------------------------------------------------
-float const* Mat44::GetAsFloatArray() const
-{
-    return m_values;
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec2 const Mat44::GetIBasis2D() const
-{
-    return Vec2(m_values[Ix], m_values[Iy]);
-}
+    inverse[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * invDet;
+    inverse[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * invDet;
+    inverse[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * invDet;
+    inverse[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * invDet;
 
-//----------------------------------------------------------------------------------------------------
-Vec2 const Mat44::GetJBasis2D() const
-{
-    return Vec2(m_values[Jx], m_values[Jy]);
+    return Mat44(inverse);
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec2 const Mat44::GetTranslation2D() const
+Mat44 const Mat44::GetTransposed() const
 {
-    return Vec2(m_values[Tx], m_values[Ty]);
+    Mat44 result = *this;
+    result.Transpose();
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::GetIBasis3D() const
+float Mat44::GetDeterminant() const
 {
-    return Vec3(m_values[Ix], m_values[Iy], m_values[Iz]);
+    return ComputeMat44Minors(m_values).GetDeterminant();
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::GetJBasis3D() const
-{
-    return Vec3(m_values[Jx], m_values[Jy], m_values[Jz]);
-}
-
+// Batched transforms: the four basis columns stay in registers and each element is a broadcast,
+// three (four) multiplies and adds in the single-element order, so results match bit for bit.
+// Each element is read completely before it is written, which makes in-place calls safe.
 //----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::GetKBasis3D() const
+void Mat44::TransformPositions3D(Vec3 const* const positions, Vec3* const outPositions, int const count) const
 {
-    return Vec3(m_values[Kx], m_values[Ky], m_values[Kz]);
-}
+    __m128 const iBasis = _mm_loadu_ps(&m_values[Ix]);
+    __m128 const jBasis = _mm_loadu_ps(&m_values[Jx]);
+    __m128 const kBasis = _mm_loadu_ps(&m_values[Kx]);
+    __m128 const tBasis = _mm_loadu_ps(&m_values[Tx]);
 
-//----------------------------------------------------------------------------------------------------
-Vec3 const Mat44::GetTranslation3D() const
-{
-    return Vec3(m_values[Tx], m_values[Ty], m_values[Tz]);
+    for (int index = 0; index < count; ++index)
+    {
+        Vec3 const& position = positions[index];
+        __m128      result   = _mm_mul_ps(iBasis, _mm_set1_ps(position.x));
+        result               = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_set1_ps(position.y)));
+        result               = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_set1_ps(position.z)));
+        result               = _mm_add_ps(result, tBasis);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&outPositions[index].x), result);
+        _mm_store_ss(&outPositions[index].z, _mm_movehl_ps(result, result));
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec4 const Mat44::GetIBasis4D() const
+void Mat44::TransformVectorQuantities3D(Vec3 const* const vectorQuantities, Vec3* const outVectorQuantities, int const count) const
 {
-    return Vec4(m_values[Ix], m_values[Iy], m_values[Iz], m_values[Iw]);
-}
+    __m128 const iBasis = _mm_loadu_ps(&m_values[Ix]);
+    __m128 const jBasis = _mm_loadu_ps(&m_values[Jx]);
+    __m128 const kBasis = _mm_loadu_ps(&m_values[Kx]);
 
-//----------------------------------------------------------------------------------------------------
-Vec4 const Mat44::GetJBasis4D() const
-{
-    return Vec4(m_values[Jx], m_values[Jy], m_values[Jz], m_values[Jw]);
-}
+    for (int index = 0; index < count; ++index)
+    {
+        Vec3 const& vectorQuantity = vectorQuantities[index];
+        __m128      result         = _mm_mul_ps(iBasis, _mm_set1_ps(vectorQuantity.x));
+        result                     = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_set1_ps(vectorQuantity.y)));
+        result                     = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_set1_ps(vectorQuantity.z)));
 
-//----------------------------------------------------------------------------------------------------
-Vec4 const Mat44::GetKBasis4D() const
-{
-    return Vec4(m_values[Kx], m_values[Ky], m_values[Kz], m_values[Kw]);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&outVectorQuantities[index].x), result);
+        _mm_store_ss(&outVectorQuantities[index].z, _mm_movehl_ps(result, result));
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec4 const Mat44::GetTranslation4D() const
-{
-    return Vec4(m_values[Tx], m_values[Ty], m_values[Tz], m_values[Tw]);
-}
-
-Mat44 const Mat44::GetOrthonormalInverse() const
+void Mat44::TransformHomogeneous3D(Vec4 const* const homogeneousPoints, Vec4* const outHomogeneousPoints, int const count) const
 {
-    Mat44 result;
-
-    // Transpose the rotation part (i.e., the 3x3 top-left submatrix)
-    result.m_values[Ix] = m_values[Ix];
-    result.m_values[Jx] = m_values[Iy];
-    result.m_values[Kx] = m_values[Iz];
-    result.m_values[Tx] = 0.f;  // We'll handle translation below
+    __m128 const iBasis = _mm_loadu_ps(&m_values[Ix]);
+    __m128 const jBasis = _mm_loadu_ps(&m_values[Jx]);
+    __m128 const kBasis = _mm_loadu_ps(&m_values[Kx]);
+    __m128 const tBasis = _mm_loadu_ps(&m_values[Tx]);
 
-    result.m_values[Iy] = m_values[Jx];
-    result.m_values[Jy] = m_values[Jy];
-    result.m_values[Ky] = m_values[Jz];
-    result.m_values[Ty] = 0.f;
-
-    result.m_values[Iz] = m_values[Kx];
-    result.m_values[Jz] = m_values[Ky];
-    result.m_values[Kz] = m_values[Kz];
-    result.m_values[Tz] = 0.f;
-
-    // Negate and apply rotation to translation
-    result.m_values[Tx] = -(result.m_values[Ix] * m_values[Tx] + result.m_values[Jx] * m_values[Ty] + result.m_values[Kx] * m_values[Tz]);
-    result.m_values[Ty] = -(result.m_values[Iy] * m_values[Tx] + result.m_values[Jy] * m_values[Ty] + result.m_values[Ky] * m_values[Tz]);
-    result.m_values[Tz] = -(result.m_values[Iz] * m_values[Tx] + result.m_values[Jz] * m_values[Ty] + result.m_values[Kz] * m_values[Tz]);
-
-    //  bottom row for an affine transformation is always [0, 0, 0, 1]
-    result.m_values[Tw] = 1.f;
+    for (int index = 0; index < count; ++index)
+    {
+        __m128 const point  = _mm_loadu_ps(&homogeneousPoints[index].x);
+        __m128       result = _mm_mul_ps(iBasis, _mm_shuffle_ps(point, point, _MM_SHUFFLE(0, 0, 0, 0)));
+        result              = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_shuffle_ps(point, point, _MM_SHUFFLE(1, 1, 1, 1))));
+        result              = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_shuffle_ps(point, point, _MM_SHUFFLE(2, 2, 2, 2))));
+        result              = _mm_add_ps(result, _mm_mul_ps(tBasis, _mm_shuffle_ps(point, point, _MM_SHUFFLE(3, 3, 3, 3))));
 
-    return result;
+        _mm_storeu_ps(&outHomogeneousPoints[index].x, result);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -624,34 +581,6 @@ void Mat44::SetIJKT4D(Vec4 const& iBasis4D,
     m_values[Tw] = translation4D.w;
 }
 
-//----------------------------------------------------------------------------------------------------
-void Mat44::Transpose()
-{
-    float temp   = m_values[Iy];
-    m_values[Iy] = m_values[Jx];
-    m_values[Jx] = temp;
-
-    temp         = m_values[Iz];
-    m_values[Iz] = m_values[Kx];
-    m_values[Kx] = temp;
-
-    temp         = m_values[Iw];
-    m_values[Iw] = m_values[Tx];
-    m_values[Tx] = temp;
-
-    temp         = m_values[Jz];
-    m_values[Jz] = m_values[Ky];
-    m_values[Ky] = temp;
-
-    temp         = m_values[Jw];
-    m_values[Jw] = m_values[Ty];
-    m_values[Ty] = temp;
-
-    temp         = m_values[Kw];
-    m_values[Kw] = m_values[Tz];
-    m_values[Tz] = temp;
-}
-
 //----------------------------------------------------------------------------------------------------
 void Mat44::Orthonormalize_IFwd_JLeft_KUp()
 {
@@ -684,48 +613,6 @@ void Mat44::Orthonormalize_IFwd_JLeft_KUp()
     m_values[Kz] = k.z;
 }
 
-//----------------------------------------------------------------------------------------------------
-// Subsequent point transformations will be affected by the last-appended matrix first,
-// followed by the previously appended matrices, in reverse order.
-//
-// In different notations, the transformations are represented as follows:
-//
-//  this(append(p))     // Function notation: apply the 'append' matrix to point 'p' first, 
-//                      // then apply the 'this' matrix.
-//
-//  [this][append][p]   // Column-major notation: the point 'p' is transformed by the 
-//                      // 'append' matrix first, then by the 'this' matrix (right-to-left order).
-//
-//  [p][append][this]   // Row-major notation: the point 'p' is transformed by the 
-//                      // 'append' matrix first, then by the 'this' matrix (left-to-right order).
-//
-void Mat44::Append(Mat44 const& appendThis)
-{
-    Mat44 const  copyOfThis = *this;
-    float const* left       = &copyOfThis.m_values[0];
-    float const* right      = &appendThis.m_values[0];
-
-    m_values[Ix] = left[Ix] * right[Ix] + left[Jx] * right[Iy] + left[Kx] * right[Iz] + left[Tx] * right[Iw];
-    m_values[Iy] = left[Iy] * right[Ix] + left[Jy] * right[Iy] + left[Ky] * right[Iz] + left[Ty] * right[Iw];
-    m_values[Iz] = left[Iz] * right[Ix] + left[Jz] * right[Iy] + left[Kz] * right[Iz] + left[Tz] * right[Iw];
-    m_values[Iw] = left[Iw] * right[Ix] + left[Jw] * right[Iy] + left[Kw] * right[Iz] + left[Tw] * right[Iw];
-
-    m_values[Jx] = left[Ix] * right[Jx] + left[Jx] * right[Jy] + left[Kx] * right[Jz] + left[Tx] * right[Jw];
-    m_values[Jy] = left[Iy] * right[Jx] + left[Jy] * right[Jy] + left[Ky] * right[Jz] + left[Ty] * right[Jw];
-    m_values[Jz] = left[Iz] * right[Jx] + left[Jz] * right[Jy] + left[Kz] * right[Jz] + left[Tz] * right[Jw];
-    m_values[Jw] = left[Iw] * right[Jx] + left[Jw] * right[Jy] + left[Kw] * right[Jz] + left[Tw] * right[Jw];
-
-    m_values[Kx] = left[Ix] * right[Kx] + left[Jx] * right[Ky] + left[Kx] * right[Kz] + left[Tx] * right[Kw];
-    m_values[Ky] = left[Iy] * right[Kx] + left[Jy] * right[Ky] + left[Ky] * right[Kz] + left[Ty] * right[Kw];
-    m_values[Kz] = left[Iz] * right[Kx] + left[Jz] * right[Ky] + left[Kz] * right[Kz] + left[Tz] * right[Kw];
-    m_values[Kw] = left[Iw] * right[Kx] + left[Jw] * right[Ky] + left[Kw] * right[Kz] + left[Tw] * right[Kw];
-
-    m_values[Tx] = left[Ix] * right[Tx] + left[Jx] * right[Ty] + left[Kx] * right[Tz] + left[Tx] * right[Tw];
-    m_values[Ty] = left[Iy] * right[Tx] + left[Jy] * right[Ty] + left[Ky] * right[Tz] + left[Ty] * right[Tw];
-    m_values[Tz] = left[Iz] * right[Tx] + left[Jz] * right[Ty] + left[Kz] * right[Tz] + left[Tz] * right[Tw];
-    m_values[Tw] = left[Iw] * right[Tx] + left[Jw] * right[Ty] + left[Kw] * right[Tz] + left[Tw] * right[Tw];
-}
-
 //----------------------------------------------------------------------------------------------------
 void Mat44::AppendZRotation(float const degreesRotationAboutZ)
 {
@@ -14,6 +14,8 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec4.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <xmmintrin.h>
 
 //----------------------------------------------------------------------------------------------------
 struct Mat44
@@ -45,6 +47,12 @@ struct Mat44
     Vec3 const TransformPosition3D(Vec3 const& position3D) const;                   // assumes w=1
     Vec4 const TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const;        // w is provided
 
+    // Batched transforms (SSE, one column load for the whole array). in and out may be the same array;
+    // results are bit-identical to the single-element versions above.
+    void TransformPositions3D(Vec3 const* positions, Vec3* outPositions, int count) const;
+    void TransformVectorQuantities3D(Vec3 const* vectorQuantities, Vec3* outVectorQuantities, int count) const;
+    void TransformHomogeneous3D(Vec4 const* homogeneousPoints, Vec4* outHomogeneousPoints, int count) const;
+
     float*       GetAsFloatArray();         // non-cont (mutable) version
     float const* GetAsFloatArray() const;
     Vec2 const   GetIBasis2D() const;
@@ -59,6 +67,9 @@ struct Mat44
     Vec4 const   GetKBasis4D() const;
     Vec4 const   GetTranslation4D() const;
     Mat44 const  GetOrthonormalInverse() const;      // Only works for orthonormal affine matrices
+    Mat44 const  GetInverse() const;                 // Any invertible matrix (projections, non-uniform scale); singular returns identity
+    Mat44 const  GetTransposed() const;
+    float        GetDeterminant() const;
 
     void SetTranslation2D(Vec2 const& translationXY);          // Sets translationZ = 0, translationW = 1
     void SetTranslation3D(Vec3 const& translationXYZ);         // Sets translationW = 1
@@ -85,3 +96,137 @@ struct Mat44
     bool operator==( Mat44 const& mat44) const;
     bool operator!=( Mat44 const& mat44) const;
 };
+
+//----------------------------------------------------------------------------------------------------
+// Inline definitions
+//   Accessors, single-element transforms, Transpose and Append are called per vertex / per object
+//   from every module, so they live here where the compiler can inline them. Transforms keep the
+//   out-of-line evaluation order (I*x + J*y + K*z + T, left to right) and stay bit-identical.
+//   Append and Transpose use SSE on the four basis columns; the layout is unchanged.
+//----------------------------------------------------------------------------------------------------
+inline Mat44::Mat44()
+    : m_values{1.f, 0.f, 0.f, 0.f,
+               0.f, 1.f, 0.f, 0.f,
+               0.f, 0.f, 1.f, 0.f,
+               0.f, 0.f, 0.f, 1.f}
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+inline Vec2 const Mat44::TransformVectorQuantity2D(Vec2 const& vectorQuantityXY) const
+{
+    float const x = m_values[Ix] * vectorQuantityXY.x + m_values[Jx] * vectorQuantityXY.y;
+    float const y = m_values[Iy] * vectorQuantityXY.x + m_values[Jy] * vectorQuantityXY.y;
+
+    return Vec2(x, y);
+}
+
+inline Vec3 const Mat44::TransformVectorQuantity3D(Vec3 const& vectorQuantityXYZ) const
+{
+    float const x = m_values[Ix] * vectorQuantityXYZ.x + m_values[Jx] * vectorQuantityXYZ.y + m_values[Kx] * vectorQuantityXYZ.z;
+    float const y = m_values[Iy] * vectorQuantityXYZ.x + m_values[Jy] * vectorQuantityXYZ.y + m_values[Ky] * vectorQuantityXYZ.z;
+    float const z = m_values[Iz] * vectorQuantityXYZ.x + m_values[Jz] * vectorQuantityXYZ.y + m_values[Kz] * vectorQuantityXYZ.z;
+
+    return Vec3(x, y, z);
+}
+
+inline Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
+{
+    float const x = m_values[Ix] * positionXY.x + m_values[Jx] * positionXY.y + m_values[Tx];
+    float const y = m_values[Iy] * positionXY.x + m_values[Jy] * positionXY.y + m_values[Ty];
+
+    return Vec2(x, y);
+}
+
+inline Vec3 const Mat44::TransformPosition3D(Vec3 const& position3D) const
+{
+    float const x = m_values[Ix] * position3D.x + m_values[Jx] * position3D.y + m_values[Kx] * position3D.z + m_values[Tx];
+    float const y = m_values[Iy] * position3D.x + m_values[Jy] * position3D.y + m_values[Ky] * position3D.z + m_values[Ty];
+    float const z = m_values[Iz] * position3D.x + m_values[Jz] * position3D.y + m_values[Kz] * position3D.z + m_values[Tz];
+
+    return Vec3(x, y, z);
+}
+
+inline Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const
+{
+    Vec4 const& p = homogeneousPoint3D;
+    float const x = m_values[Ix] * p.x + m_values[Jx] * p.y + m_values[Kx] * p.z + m_values[Tx] * p.w;
+    float const y = m_values[Iy] * p.x + m_values[Jy] * p.y + m_values[Ky] * p.z + m_values[Ty] * p.w;
+    float const z = m_values[Iz] * p.x + m_values[Jz] * p.y + m_values[Kz] * p.z + m_values[Tz] * p.w;
+    float const w = m_values[Iw] * p.x + m_values[Jw] * p.y + m_values[Kw] * p.z + m_values[Tw] * p.w;
+
+    return Vec4(x, y, z, w);
+}
+
+//----------------------------------------------------------------------------------------------------
+inline float*       Mat44::GetAsFloatArray() { return m_values; }
+inline float const* Mat44::GetAsFloatArray() const { return m_values; }
+inline Vec2 const   Mat44::GetIBasis2D() const { return Vec2(m_values[Ix], m_values[Iy]); }
+inline Vec2 const   Mat44::GetJBasis2D() const { return Vec2(m_values[Jx], m_values[Jy]); }
+inline Vec2 const   Mat44::GetTranslation2D() const { return Vec2(m_values[Tx], m_values[Ty]); }
+inline Vec3 const   Mat44::GetIBasis3D() const { return Vec3(m_values[Ix], m_values[Iy], m_values[Iz]); }
+inline Vec3 const   Mat44::GetJBasis3D() const { return Vec3(m_values[Jx], m_values[Jy], m_values[Jz]); }
+inline Vec3 const   Mat44::GetKBasis3D() const { return Vec3(m_values[Kx], m_values[Ky], m_values[Kz]); }
+inline Vec3 const   Mat44::GetTranslation3D() const { return Vec3(m_values[Tx], m_values[Ty], m_values[Tz]); }
+inline Vec4 const   Mat44::GetIBasis4D() const { return Vec4(m_values[Ix], m_values[Iy], m_values[Iz], m_values[Iw]); }
+inline Vec4 const   Mat44::GetJBasis4D() const { return Vec4(m_values[Jx], m_values[Jy], m_values[Jz], m_values[Jw]); }
+inline Vec4 const   Mat44::GetKBasis4D() const { return Vec4(m_values[Kx], m_values[Ky], m_values[Kz], m_values[Kw]); }
+inline Vec4 const   Mat44::GetTranslation4D() const { return Vec4(m_values[Tx], m_values[Ty], m_values[Tz], m_values[Tw]); }
+
+//----------------------------------------------------------------------------------------------------
+inline void Mat44::Transpose()
+{
+    __m128 iBasis = _mm_loadu_ps(&m_values[Ix]);
+    __m128 jBasis = _mm_loadu_ps(&m_values[Jx]);
+    __m128 kBasis = _mm_loadu_ps(&m_values[Kx]);
+    __m128 tBasis = _mm_loadu_ps(&m_values[Tx]);
+
+    _MM_TRANSPOSE4_PS(iBasis, jBasis, kBasis, tBasis);
+
+    _mm_storeu_ps(&m_values[Ix], iBasis);
+    _mm_storeu_ps(&m_values[Jx], jBasis);
+    _mm_storeu_ps(&m_values[Kx], kBasis);
+    _mm_storeu_ps(&m_values[Tx], tBasis);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Subsequent point transformations will be affected by the last-appended matrix first,
+// followed by the previously appended matrices, in reverse order.
+//
+// In different notations, the transformations are represented as follows:
+//
+//  this(append(p))     // Function notation: apply the 'append' matrix to point 'p' first, 
+//                      // then apply the 'this' matrix.
+//
+//  [this][append][p]   // Column-major notation: the point 'p' is transformed by the 
+//                      // 'append' matrix first, then by the 'this' matrix (right-to-left order).
+//
+//  [p][append][this]   // Row-major notation: the point 'p' is transformed by the 
+//                      // 'append' matrix first, then by the 'this' matrix (left-to-right order).
+//
+// SSE: column c of the result is ((I * r.x + J * r.y) + K * r.z) + T * r.w for column r of appendThis,
+// the same products and sum order as the old scalar version. Both operands are loaded up front, so
+// m.Append(m) is safe.
+//----------------------------------------------------------------------------------------------------
+inline void Mat44::Append(Mat44 const& appendThis)
+{
+    __m128 const iBasis = _mm_loadu_ps(&m_values[Ix]);
+    __m128 const jBasis = _mm_loadu_ps(&m_values[Jx]);
+    __m128 const kBasis = _mm_loadu_ps(&m_values[Kx]);
+    __m128 const tBasis = _mm_loadu_ps(&m_values[Tx]);
+
+    __m128 const right[4] = {_mm_loadu_ps(&appendThis.m_values[Ix]),
+                             _mm_loadu_ps(&appendThis.m_values[Jx]),
+                             _mm_loadu_ps(&appendThis.m_values[Kx]),
+                             _mm_loadu_ps(&appendThis.m_values[Tx])};
+
+    for (int column = 0; column < 4; ++column)
+    {
+        __m128 const r      = right[column];
+        __m128       result = _mm_mul_ps(iBasis, _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0)));
+        result              = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1))));
+        result              = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2))));
+        result              = _mm_add_ps(result, _mm_mul_ps(tBasis, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(&m_values[column * 4], result);
+    }
+}
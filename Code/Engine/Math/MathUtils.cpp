@@ -188,27 +188,6 @@ float DotProduct2D(Vec2 const& a,
         a.y * b.y;
 }
 
-//----------------------------------------------------------------------------------------------------
-float DotProduct3D(Vec3 const& a,
-                   Vec3 const& b)
-{
-    return
-        a.x * b.x +
-        a.y * b.y +
-        a.z * b.z;
-}
-
-//----------------------------------------------------------------------------------------------------
-float DotProduct4D(Vec4 const& a,
-                   Vec4 const& b)
-{
-    return
-        a.x * b.x +
-        a.y * b.y +
-        a.z * b.z +
-        a.w * b.w;
-}
-
 //----------------------------------------------------------------------------------------------------
 float CrossProduct2D(Vec2 const& a,
                      Vec2 const& b)
@@ -218,14 +197,6 @@ float CrossProduct2D(Vec2 const& a,
         a.y * b.x;
 }
 
-//----------------------------------------------------------------------------------------------------
-Vec3 CrossProduct3D(Vec3 const& a,
-                    Vec3 const& b)
-{
-    return
-        Vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
-}
-
 //-End-of-Dot-and-Cross-------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
 //-Start-of-Distance-&-Projections-Utilities----------------------------------------------------------
@@ -6,6 +6,8 @@
 #pragma once
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Vec4.hpp"
 //----------------------------------------------------------------------------------------------------
 #include <cstdint>
 
@@ -77,10 +79,10 @@ float GetAngleDegreesBetweenVectors2D(Vec2 const& a, Vec2 const& b);
 //-Start-of-Dot-and-Cross-----------------------------------------------------------------------------
 
 float DotProduct2D(Vec2 const& a, Vec2 const& b);
-float DotProduct3D(Vec3 const& a, Vec3 const& b);
-float DotProduct4D(Vec4 const& a, Vec4 const& b);
+constexpr float DotProduct3D(Vec3 const& a, Vec3 const& b);    // Inline, defined at the end of this file
+constexpr float DotProduct4D(Vec4 const& a, Vec4 const& b);
 float CrossProduct2D(Vec2 const& a, Vec2 const& b);
-Vec3  CrossProduct3D(Vec3 const& a, Vec3 const& b);
+constexpr Vec3  CrossProduct3D(Vec3 const& a, Vec3 const& b);
 
 //-End-of-Dot-and-Cross-------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
@@ -205,3 +207,21 @@ float CustomFunkyEasingFunction(float t);
 //----------------------------------------------------------------------------------------------------
 bool IsPointInsideConvexHull2D(Vec2 const& point, ConvexHull2 const& convexHull);
 Vec2 GetPlaneIntersection2D(Plane2 const& planeA, Plane2 const& planeB);
+
+//----------------------------------------------------------------------------------------------------
+// Inline Dot and Cross (hot in collision and mesh code; same evaluation order as the old out-of-line versions)
+//----------------------------------------------------------------------------------------------------
+constexpr float DotProduct3D(Vec3 const& a, Vec3 const& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+constexpr float DotProduct4D(Vec4 const& a, Vec4 const& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+constexpr Vec3 CrossProduct3D(Vec3 const& a, Vec3 const& b)
+{
+    return Vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
@@ -15,26 +15,6 @@ STATIC Vec3 Vec3::X_BASIS = Vec3(1, 0, 0);
 STATIC Vec3 Vec3::Y_BASIS = Vec3(0, 1, 0);
 STATIC Vec3 Vec3::Z_BASIS = Vec3(0, 0, 1);
 
-//----------------------------------------------------------------------------------------------------
-Vec3::Vec3(float const initialX,
-           float const initialY,
-           float const initialZ)
-    : x(initialX),
-      y(initialY),
-      z(initialZ)
-{
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3::Vec3(int const initialX,
-           int const initialY,
-           int const initialZ)
-    : x(static_cast<float>(initialX)),
-      y(static_cast<float>(initialY)),
-      z(static_cast<float>(initialZ))
-{
-}
-
 //----------------------------------------------------------------------------------------------------
 float Vec3::GetLength() const
 {
@@ -183,119 +163,6 @@ void Vec3::SetFromText(char const* text)
     z = static_cast<float>(atof(parts[2].c_str()));
 }
 
-//----------------------------------------------------------------------------------------------------
-bool Vec3::operator==(Vec3 const& compare) const
-{
-    return
-        std::fabs(x - compare.x) < FLOAT_MIN &&
-        std::fabs(y - compare.y) < FLOAT_MIN &&
-        std::fabs(z - compare.z) < FLOAT_MIN;
-}
-
-//----------------------------------------------------------------------------------------------------
-bool Vec3::operator!=(Vec3 const& compare) const
-{
-    return
-        !(*this == compare);
-}
-
-bool Vec3::operator<(Vec3 const& compare) const
-{
-    if (x != compare.x) return x < compare.x;
-    if (y != compare.y) return y < compare.y;
-    return z < compare.z;
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 const Vec3::operator+(Vec3 const& vecToAdd) const
-{
-    return
-        Vec3(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z);
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 const Vec3::operator-(Vec3 const& vecToSubtract) const
-{
-    return
-        Vec3(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z);
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 Vec3::operator-() const
-{
-    return
-        Vec3(-x, -y, -z);
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 const Vec3::operator*(float const uniformScale) const
-{
-    return
-        Vec3(x * uniformScale, y * uniformScale, z * uniformScale);
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 const Vec3::operator/(float const inverseScale) const
-{
-    float const scale = 1.f / inverseScale;
-
-    return Vec3(x * scale, y * scale, z * scale);
-}
-
-//----------------------------------------------------------------------------------------------------
-void Vec3::operator+=(Vec3 const& vecToAdd)
-{
-    x += vecToAdd.x;
-    y += vecToAdd.y;
-    z += vecToAdd.z;
-}
-
-//----------------------------------------------------------------------------------------------------
-void Vec3::operator-=(Vec3 const& vecToSubtract)
-{
-    x -= vecToSubtract.x;
-    y -= vecToSubtract.y;
-    z -= vecToSubtract.z;
-}
-
-//----------------------------------------------------------------------------------------------------
-void Vec3::operator*=(const float uniformScale)
-{
-    x *= uniformScale;
-    y *= uniformScale;
-    z *= uniformScale;
-}
-
-//----------------------------------------------------------------------------------------------------
-void Vec3::operator/=(const float uniformDivisor)
-{
-    float const scale = 1.f / uniformDivisor;
-
-    x *= scale;
-    y *= scale;
-    z *= scale;
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3& Vec3::operator=(Vec3 const& copyFrom)
-{
-    // Check for self-assignment
-    if (this != &copyFrom)
-    {
-        x = copyFrom.x;
-        y = copyFrom.y;
-        z = copyFrom.z;
-    }
-
-    return *this;	// Return the current object by reference (dereference)
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 const operator*(float const uniformScale, Vec3 const& vecToScale)
-{
-    return Vec3(uniformScale * vecToScale.x, uniformScale * vecToScale.y, uniformScale * vecToScale.z);
-}
-
 //----------------------------------------------------------------------------------------------------
 Vec3 Interpolate(Vec3 const& start,
                  Vec3 const& end,
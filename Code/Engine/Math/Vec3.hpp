@@ -4,6 +4,8 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+//----------------------------------------------------------------------------------------------------
+#include <limits>
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 struct Vec2;
@@ -24,8 +26,8 @@ struct Vec3
 
     // Construction / Destruction
     Vec3() = default;
-    explicit Vec3(float initialX, float initialY, float initialZ);
-    explicit Vec3(int initialX, int initialY, int initialZ);
+    constexpr explicit Vec3(float initialX, float initialY, float initialZ);
+    constexpr explicit Vec3(int initialX, int initialY, int initialZ);
     ~Vec3() = default;
 
     // Accessors (const methods)
@@ -44,25 +46,130 @@ struct Vec3
 
     void SetFromText(char const* text);
 
-    // Operators (const)
-    bool       operator==(Vec3 const& compare) const;       // vec3 == vec3
-    bool       operator!=(Vec3 const& compare) const;       // vec3 != vec3
-    bool       operator<(Vec3 const& compare) const;
-    Vec3 const operator+(Vec3 const& vecToAdd) const;       // vec3 + vec3
-    Vec3 const operator-(Vec3 const& vecToSubtract) const;  // vec3 - vec3
-    Vec3       operator-() const;                           // -vec3, i.e. "unary negation"
-    Vec3 const operator*(float uniformScale) const;         // vec3 * float
-    Vec3 const operator/(float inverseScale) const;         // vec3 / float
-
-    // Operators (self-mutating / non-const)
-    void  operator+=(Vec3 const& vecToAdd);         // vec3 += vec3
-    void  operator-=(Vec3 const& vecToSubtract);    // vec3 -= vec3
-    void  operator*=(float uniformScale);           // vec3 *= float
-    void  operator/=(float uniformDivisor);         // vec3 /= float
-    Vec3& operator=(Vec3 const& copyFrom);          // vec3 = vec3
+    // Operators (const) - defined inline below
+    constexpr bool       operator==(Vec3 const& compare) const;       // vec3 == vec3
+    constexpr bool       operator!=(Vec3 const& compare) const;       // vec3 != vec3
+    constexpr bool       operator<(Vec3 const& compare) const;
+    constexpr Vec3 const operator+(Vec3 const& vecToAdd) const;       // vec3 + vec3
+    constexpr Vec3 const operator-(Vec3 const& vecToSubtract) const;  // vec3 - vec3
+    constexpr Vec3       operator-() const;                           // -vec3, i.e. "unary negation"
+    constexpr Vec3 const operator*(float uniformScale) const;         // vec3 * float
+    constexpr Vec3 const operator/(float inverseScale) const;         // vec3 / float
+
+    // Operators (self-mutating / non-const) - copy assignment is implicit, so Vec3 stays trivially copyable
+    constexpr void operator+=(Vec3 const& vecToAdd);         // vec3 += vec3
+    constexpr void operator-=(Vec3 const& vecToSubtract);    // vec3 -= vec3
+    constexpr void operator*=(float uniformScale);           // vec3 *= float
+    constexpr void operator/=(float uniformDivisor);         // vec3 /= float
 
     // Standalone "friend" functions that are conceptually, but not actually, part of Vec3::
-    friend Vec3 const operator*(float uniformScale, Vec3 const& vecToScale); // float * vec3
+    friend constexpr Vec3 const operator*(float uniformScale, Vec3 const& vecToScale); // float * vec3
 };
 
 Vec3 Interpolate(Vec3 const& start, Vec3 const& end, float t);
+
+//----------------------------------------------------------------------------------------------------
+// Inline definitions
+//   Every call site used to pay an out-of-line call per operator, which also kept the compiler from
+//   vectorizing loops over Vec3. The arithmetic (and its evaluation order) is unchanged.
+//----------------------------------------------------------------------------------------------------
+constexpr Vec3::Vec3(float const initialX, float const initialY, float const initialZ)
+    : x(initialX),
+      y(initialY),
+      z(initialZ)
+{
+}
+
+constexpr Vec3::Vec3(int const initialX, int const initialY, int const initialZ)
+    : x(static_cast<float>(initialX)),
+      y(static_cast<float>(initialY)),
+      z(static_cast<float>(initialZ))
+{
+}
+
+// |a - b| < FLOAT_MIN per component, written without std::fabs so it stays constexpr
+constexpr bool Vec3::operator==(Vec3 const& compare) const
+{
+    float constexpr tolerance = (std::numeric_limits<float>::min)();
+    float const     dx        = x - compare.x;
+    float const     dy        = y - compare.y;
+    float const     dz        = z - compare.z;
+
+    return dx < tolerance && -dx < tolerance &&
+           dy < tolerance && -dy < tolerance &&
+           dz < tolerance && -dz < tolerance;
+}
+
+constexpr bool Vec3::operator!=(Vec3 const& compare) const
+{
+    return !(*this == compare);
+}
+
+constexpr bool Vec3::operator<(Vec3 const& compare) const
+{
+    if (x != compare.x) return x < compare.x;
+    if (y != compare.y) return y < compare.y;
+    return z < compare.z;
+}
+
+constexpr Vec3 const Vec3::operator+(Vec3 const& vecToAdd) const
+{
+    return Vec3(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z);
+}
+
+constexpr Vec3 const Vec3::operator-(Vec3 const& vecToSubtract) const
+{
+    return Vec3(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z);
+}
+
+constexpr Vec3 Vec3::operator-() const
+{
+    return Vec3(-x, -y, -z);
+}
+
+constexpr Vec3 const Vec3::operator*(float const uniformScale) const
+{
+    return Vec3(x * uniformScale, y * uniformScale, z * uniformScale);
+}
+
+constexpr Vec3 const Vec3::operator/(float const inverseScale) const
+{
+    float const scale = 1.f / inverseScale;
+
+    return Vec3(x * scale, y * scale, z * scale);
+}
+
+constexpr void Vec3::operator+=(Vec3 const& vecToAdd)
+{
+    x += vecToAdd.x;
+    y += vecToAdd.y;
+    z += vecToAdd.z;
+}
+
+constexpr void Vec3::operator-=(Vec3 const& vecToSubtract)
+{
+    x -= vecToSubtract.x;
+    y -= vecToSubtract.y;
+    z -= vecToSubtract.z;
+}
+
+constexpr void Vec3::operator*=(float const uniformScale)
+{
+    x *= uniformScale;
+    y *= uniformScale;
+    z *= uniformScale;
+}
+
+constexpr void Vec3::operator/=(float const uniformDivisor)
+{
+    float const scale = 1.f / uniformDivisor;
+
+    x *= scale;
+    y *= scale;
+    z *= scale;
+}
+
+constexpr Vec3 const operator*(float const uniformScale, Vec3 const& vecToScale)
+{
+    return Vec3(uniformScale * vecToScale.x, uniformScale * vecToScale.y, uniformScale * vecToScale.z);
+}
@@ -21,7 +21,7 @@ struct Vec4
     ~Vec4() = default;                              // Destructor
     Vec4() = default;                               // Default constructor
     Vec4(Vec4 const& copyFrom) = default;           // Copy constructor
-    explicit Vec4(float initialX, float initialY, float initialZ, float initialW); // Custom constructor
+    constexpr explicit Vec4(float initialX, float initialY, float initialZ, float initialW); // Custom constructor
 
     // Accessors (const methods)
     float GetLength() const;                        // Returns the magnitude of the vector
@@ -34,22 +34,105 @@ struct Vec4
     void  Normalize();                              // Normalizes the vector
     void  ClampLength(float maxLength);             // Clamps the length of the vector to a max
 
-    // Operators (const)
-    bool operator==(Vec4 const& compare) const;     // Equality operator
-    bool operator!=(Vec4 const& compare) const;     // Inequality operator
-    Vec4 operator+(Vec4 const& vecToAdd) const;     // Addition operator
-    Vec4 operator-(Vec4 const& vecToSubtract) const;// Subtraction operator
-    Vec4 operator-() const;                         // Unary negation operator
-    Vec4 operator*(float uniformScale) const;       // Scalar multiplication
-    Vec4 operator/(float inverseScale) const;       // Scalar division
+    // Operators (const) - defined inline below
+    constexpr bool operator==(Vec4 const& compare) const;     // Equality operator
+    constexpr bool operator!=(Vec4 const& compare) const;     // Inequality operator
+    constexpr Vec4 operator+(Vec4 const& vecToAdd) const;     // Addition operator
+    constexpr Vec4 operator-(Vec4 const& vecToSubtract) const;// Subtraction operator
+    constexpr Vec4 operator-() const;                         // Unary negation operator
+    constexpr Vec4 operator*(float uniformScale) const;       // Scalar multiplication
+    constexpr Vec4 operator/(float inverseScale) const;       // Scalar division
 
     // Operators (self-mutating / non-const)
-    void  operator+=(Vec4 const& vecToAdd);         // Addition-assignment
-    void  operator-=(Vec4 const& vecToSubtract);    // Subtraction-assignment
-    void  operator*=(float uniformScale);           // Multiplication-assignment
-    void  operator/=(float uniformDivisor);         // Division-assignment
-    Vec4& operator=(Vec4 const& copyFrom);          // Assignment operator
+    constexpr void  operator+=(Vec4 const& vecToAdd);         // Addition-assignment
+    constexpr void  operator-=(Vec4 const& vecToSubtract);    // Subtraction-assignment
+    constexpr void  operator*=(float uniformScale);           // Multiplication-assignment
+    constexpr void  operator/=(float uniformDivisor);         // Division-assignment
+    Vec4&           operator=(Vec4 const& copyFrom) = default; // Assignment operator (trivial)
 
     // Standalone "friend" functions
-    friend Vec4 operator*(float uniformScale, Vec4 const& vecToScale); // Scalar multiplication
+    friend constexpr Vec4 operator*(float uniformScale, Vec4 const& vecToScale); // Scalar multiplication
 };
+
+//----------------------------------------------------------------------------------------------------
+// Inline definitions (same arithmetic as before, now visible to every translation unit)
+//----------------------------------------------------------------------------------------------------
+constexpr Vec4::Vec4(float const initialX, float const initialY, float const initialZ, float const initialW)
+    : x(initialX),
+      y(initialY),
+      z(initialZ),
+      w(initialW)
+{
+}
+
+constexpr bool Vec4::operator==(Vec4 const& compare) const
+{
+    return x == compare.x && y == compare.y && z == compare.z && w == compare.w;
+}
+
+constexpr bool Vec4::operator!=(Vec4 const& compare) const
+{
+    return !(*this == compare);
+}
+
+constexpr Vec4 Vec4::operator+(Vec4 const& vecToAdd) const
+{
+    return Vec4(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z, w + vecToAdd.w);
+}
+
+constexpr Vec4 Vec4::operator-(Vec4 const& vecToSubtract) const
+{
+    return Vec4(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z, w - vecToSubtract.w);
+}
+
+constexpr Vec4 Vec4::operator-() const
+{
+    return Vec4(-x, -y, -z, -w);
+}
+
+constexpr Vec4 Vec4::operator*(float const uniformScale) const
+{
+    return Vec4(x * uniformScale, y * uniformScale, z * uniformScale, w * uniformScale);
+}
+
+constexpr Vec4 Vec4::operator/(float const inverseScale) const
+{
+    return Vec4(x / inverseScale, y / inverseScale, z / inverseScale, w / inverseScale);
+}
+
+constexpr void Vec4::operator+=(Vec4 const& vecToAdd)
+{
+    x += vecToAdd.x;
+    y += vecToAdd.y;
+    z += vecToAdd.z;
+    w += vecToAdd.w;
+}
+
+constexpr void Vec4::operator-=(Vec4 const& vecToSubtract)
+{
+    x -= vecToSubtract.x;
+    y -= vecToSubtract.y;
+    z -= vecToSubtract.z;
+    w -= vecToSubtract.w;
+}
+
+constexpr void Vec4::operator*=(float const uniformScale)
+{
+    x *= uniformScale;
+    y *= uniformScale;
+    z *= uniformScale;
+    w *= uniformScale;
+}
+
+constexpr void Vec4::operator/=(float const uniformDivisor)
+{
+    x /= uniformDivisor;
+    y /= uniformDivisor;
+    z /= uniformDivisor;
+    w /= uniformDivisor;
+}
+
+constexpr Vec4 operator*(float const uniformScale, Vec4 const& vecToScale)
+{
+    return Vec4(vecToScale.x * uniformScale, vecToScale.y * uniformScale, vecToScale.z * uniformScale, vecToScale.w * uniformScale);
+}
@@ -117,9 +117,10 @@ LRESULT CALLBACK WindowsMessageHandlingProcedure(HWND const   windowHandle,
             // {
             //     return 0;
             // }
+            static EventID const s_eventID = EventSystem::InternEventName("OnWindowKeyPressed");
             EventArgs args;
-            args.SetValue("OnWindowKeyPressed", Stringf("%d", static_cast<unsigned char>(wParam)));
-            FireEvent("OnWindowKeyPressed", args);
+            args.SetValue("OnWindowKeyPressed", static_cast<int>(static_cast<unsigned char>(wParam)));
+            FireEvent(s_eventID, args);
             return 0;
         }
 
@@ -129,9 +130,10 @@ LRESULT CALLBACK WindowsMessageHandlingProcedure(HWND const   windowHandle,
             // {
             //     return 0;
             // }
+            static EventID const s_eventID = EventSystem::InternEventName("OnWindowKeyReleased");
             EventArgs args;
-            args.SetValue("OnWindowKeyReleased", Stringf("%d", static_cast<unsigned char>(wParam)));
-            FireEvent("OnWindowKeyReleased", args);
+            args.SetValue("OnWindowKeyReleased", static_cast<int>(static_cast<unsigned char>(wParam)));
+            FireEvent(s_eventID, args);
             return 0;
         }
 
@@ -141,9 +143,10 @@ LRESULT CALLBACK WindowsMessageHandlingProcedure(HWND const   windowHandle,
             // {
             //     return 0;
             // }
+            static EventID const s_eventID = EventSystem::InternEventName("OnWindowCharInput");
             EventArgs args;
-            args.SetValue("OnWindowCharInput", Stringf("%d", static_cast<unsigned char>(wParam)));
-            FireEvent("OnWindowCharInput", args);
+            args.SetValue("OnWindowCharInput", static_cast<int>(static_cast<unsigned char>(wParam)));
+            FireEvent(s_eventID, args);
 
             return 0;
         }
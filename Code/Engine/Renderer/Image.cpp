@@ -85,6 +85,12 @@ void const* Image::GetRawData() const
     return m_rgbaTexels.data();
 }
 
+//----------------------------------------------------------------------------------------------------
+Rgba8 const* Image::GetTexels() const
+{
+    return m_rgbaTexels.data();
+}
+
 //----------------------------------------------------------------------------------------------------
 void Image::SetTexelColor(IntVec2 const& texelCoords,
                           Rgba8 const&   newColor)
@@ -98,3 +104,9 @@ void Image::SetTexelColor(IntVec2 const& texelCoords,
     size_t const index  = texelCoords.y * m_dimensions.x + texelCoords.x;
     m_rgbaTexels[index] = newColor;
 }
+
+//----------------------------------------------------------------------------------------------------
+Rgba8* Image::GetTexels()
+{
+    return m_rgbaTexels.data();
+}
@@ -21,9 +21,11 @@ public:
     IntVec2       GetDimensions() const;
     Rgba8         GetTexelColor(IntVec2 const& texelCoords) const;
     void const*   GetRawData() const;
+    Rgba8 const*  GetTexels() const;     // Tightly packed rows, m_dimensions.x texels each
 
     // Mutators
-    void SetTexelColor(IntVec2 const& texelCoords, Rgba8 const& newColor);
+    void   SetTexelColor(IntVec2 const& texelCoords, Rgba8 const& newColor);
+    Rgba8* GetTexels();    // Bulk access for ImageProcessing kernels
 
 private:
     String             m_imageFilePath;
@@ -0,0 +1,670 @@
+//----------------------------------------------------------------------------------------------------
+// ImageProcessing.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/ImageProcessing.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/CpuFeatures.hpp"
+#include "Engine/Core/ParallelFor.hpp"
+#include "Engine/Renderer/Image.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int constexpr   LINEAR_TO_SRGB_TABLE_SIZE = 8192;           // < 0.5 LSB error near black
+    float constexpr ALPHA_WEIGHT_EPSILON      = 1.f / 65536.f;  // Keeps the color of fully transparent areas
+    int constexpr   TEXELS_PER_CHUNK          = 32768;          // Output texels per ParallelFor chunk
+    int constexpr   MIN_PARALLEL_TEXELS       = 65536;          // Smaller outputs stay on the calling thread
+    int constexpr   KAISER_TAP_COUNT          = 8;              // Source texels per axis per output texel
+    int constexpr   KAISER_MIN_ROWS_PER_CHUNK = 16;             // Each chunk re-filters 6 border rows
+    double constexpr KAISER_BETA              = 4.0;
+
+    //------------------------------------------------------------------------------------------------
+    // Lookup tables
+    //------------------------------------------------------------------------------------------------
+    struct sColorTables
+    {
+        float   m_srgbToLinear[256];
+        uint8_t m_linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE];
+    };
+
+    sColorTables BuildColorTables()
+    {
+        sColorTables tables;
+
+        for (int value = 0; value < 256; ++value)
+        {
+            float const encoded          = static_cast<float>(value) / 255.f;
+            tables.m_srgbToLinear[value] = encoded <= 0.04045f ? encoded / 12.92f : std::pow((encoded + 0.055f) / 1.055f, 2.4f);
+        }
+
+        for (int index = 0; index < LINEAR_TO_SRGB_TABLE_SIZE; ++index)
+        {
+            float const linear           = static_cast<float>(index) / static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+            float const encoded          = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1.f / 2.4f) - 0.055f;
+            tables.m_linearToSrgb[index] = static_cast<uint8_t>(std::lround((std::clamp)(encoded, 0.f, 1.f) * 255.f));
+        }
+
+        return tables;
+    }
+
+    sColorTables const& GetColorTables()
+    {
+        static sColorTables const s_tables = BuildColorTables();
+        return s_tables;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Kaiser-windowed sinc for a 2x decimation. Output texel x is centered between source texels
+    // 2x and 2x+1; tap k reads source texel 2x - 3 + k, (k - 3.5) texels from that center.
+    //------------------------------------------------------------------------------------------------
+    struct sKaiserKernel
+    {
+        float m_weights[KAISER_TAP_COUNT];
+    };
+
+    double BesselI0(double const x)
+    {
+        double sum  = 1.0;
+        double term = 1.0;
+        for (int k = 1; k < 64 && term > sum * 1e-12; ++k)
+        {
+            double const factor = x / (2.0 * k);
+            term *= factor * factor;
+            sum += term;
+        }
+        return sum;
+    }
+
+    sKaiserKernel BuildKaiserKernel()
+    {
+        double constexpr PI          = 3.14159265358979323846;
+        double constexpr HALF_WIDTH  = KAISER_TAP_COUNT / 2;
+        double           weights[KAISER_TAP_COUNT];
+        double           weightSum   = 0.0;
+        double const     windowScale = 1.0 / BesselI0(KAISER_BETA);
+
+        for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+        {
+            double const distance = static_cast<double>(tap) - (HALF_WIDTH - 0.5);
+            double const t        = distance / HALF_WIDTH;
+            double const window   = BesselI0(KAISER_BETA * std::sqrt((std::max)(0.0, 1.0 - t * t))) * windowScale;
+            double const phase    = PI * distance * 0.5;    // Cutoff at the destination Nyquist frequency
+            double const sinc     = std::sin(phase) / phase;
+            weights[tap]          = sinc * window;
+            weightSum += weights[tap];
+        }
+
+        sKaiserKernel kernel;
+        for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+        {
+            kernel.m_weights[tap] = static_cast<float>(weights[tap] / weightSum);
+        }
+        return kernel;
+    }
+
+    sKaiserKernel const& GetKaiserKernel()
+    {
+        static sKaiserKernel const s_kernel = BuildKaiserKernel();
+        return s_kernel;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Filter space: one __m128 per texel, linear light, optionally alpha-weighted as
+    // (r * w, g * w, b * w, w) with w = alpha + ALPHA_WEIGHT_EPSILON. Every kernel's weights sum
+    // to 1, so the filtered alpha is w - ALPHA_WEIGHT_EPSILON.
+    //------------------------------------------------------------------------------------------------
+    struct sFilterSpace
+    {
+        sColorTables const* m_tables          = nullptr;
+        bool                m_isSrgb          = false;
+        bool                m_isAlphaWeighted = false;
+    };
+
+    // Filter-space texel in scratch rows. __m128 itself is not used as a std::vector element type:
+    // its alignment attribute is dropped on template arguments, so keep the alignment on a plain
+    // struct and move data in and out with _mm_load_ps / _mm_store_ps.
+    struct alignas(16) sFilterTexel
+    {
+        float m_rgba[4];
+    };
+
+    sFilterSpace MakeFilterSpace(sImageFilterOptions const& options)
+    {
+        sFilterSpace space;
+        space.m_isSrgb          = options.m_colorSpace == eImageColorSpace::SRGB;
+        space.m_isAlphaWeighted = options.m_isAlphaWeighted && !options.m_isPremultiplied;
+        space.m_tables          = space.m_isSrgb ? &GetColorTables() : nullptr;
+        return space;
+    }
+
+    __m128 ToFilterSpace(Rgba8 const texel, sFilterSpace const& space)
+    {
+        __m128 color;
+        if (space.m_isSrgb)
+        {
+            float const* const toLinear = space.m_tables->m_srgbToLinear;
+            color = _mm_setr_ps(toLinear[texel.r], toLinear[texel.g], toLinear[texel.b], static_cast<float>(texel.a) * (1.f / 255.f));
+        }
+        else
+        {
+            color = _mm_mul_ps(_mm_setr_ps(texel.r, texel.g, texel.b, texel.a), _mm_set1_ps(1.f / 255.f));
+        }
+
+        if (space.m_isAlphaWeighted)
+        {
+            __m128 const rgbMask  = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+            __m128 const alphaOne = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+            __m128 const weight   = _mm_add_ps(_mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(ALPHA_WEIGHT_EPSILON));
+            color                 = _mm_mul_ps(_mm_or_ps(_mm_and_ps(color, rgbMask), alphaOne), weight);
+        }
+
+        return color;
+    }
+
+    Rgba8 FromFilterSpace(__m128 color, sFilterSpace const& space)
+    {
+        if (space.m_isAlphaWeighted)
+        {
+            float const weight    = _mm_cvtss_f32(_mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3)));
+            float const invWeight = weight > 1e-12f ? 1.f / weight : 0.f;
+            color                 = _mm_sub_ps(_mm_mul_ps(color, _mm_setr_ps(invWeight, invWeight, invWeight, 1.f)), _mm_setr_ps(0.f, 0.f, 0.f, ALPHA_WEIGHT_EPSILON));
+        }
+
+        color = _mm_min_ps(_mm_max_ps(color, _mm_setzero_ps()), _mm_set1_ps(1.f));
+
+        Rgba8 texel;
+        if (space.m_isSrgb)
+        {
+            float constexpr tableScale = static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+            alignas(16) int32_t indices[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_cvtps_epi32(_mm_mul_ps(color, _mm_setr_ps(tableScale, tableScale, tableScale, 255.f))));
+
+            uint8_t const* const toSrgb = space.m_tables->m_linearToSrgb;
+            texel.r = toSrgb[indices[0]];
+            texel.g = toSrgb[indices[1]];
+            texel.b = toSrgb[indices[2]];
+            texel.a = static_cast<unsigned char>(indices[3]);
+        }
+        else
+        {
+            __m128i packed = _mm_cvtps_epi32(_mm_mul_ps(color, _mm_set1_ps(255.f)));
+            packed         = _mm_packs_epi32(packed, packed);
+            packed         = _mm_packus_epi16(packed, packed);
+            uint32_t const value = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+            texel.r              = static_cast<unsigned char>(value);
+            texel.g              = static_cast<unsigned char>(value >> 8);
+            texel.b              = static_cast<unsigned char>(value >> 16);
+            texel.a              = static_cast<unsigned char>(value >> 24);
+        }
+
+        return texel;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Runs rowFunc(rowBegin, rowEnd) over [0, rowCount), split across JobSystem workers when the
+    // output is large enough to pay for the fork/join
+    //------------------------------------------------------------------------------------------------
+    template <typename RowFunc>
+    void ForEachRowRange(int const rowCount, int const texelsPerRow, int const minRowsPerChunk, sImageFilterOptions const& options, RowFunc const& rowFunc)
+    {
+        int64_t const texelCount = static_cast<int64_t>(rowCount) * texelsPerRow;
+        if (!options.m_runInParallel || texelCount < MIN_PARALLEL_TEXELS)
+        {
+            rowFunc(0, rowCount);
+            return;
+        }
+
+        int const rowsPerChunk = (std::max)(minRowsPerChunk, TEXELS_PER_CHUNK / (std::max)(texelsPerRow, 1));
+        ParallelFor(0, rowCount, rowsPerChunk, rowFunc, options.m_jobSystem);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Integer 2x2 box: (a + b + c + d + 2) >> 2 per channel. Each function starts at dst texel x
+    // and returns the first texel it did not write.
+    //------------------------------------------------------------------------------------------------
+    int BoxRowIntegerAvx2(Rgba8 const* row0, Rgba8 const* row1, Rgba8* dst, int x, int const dstWidth)
+    {
+        __m256i const zero     = _mm256_setzero_si256();
+        __m256i const rounding = _mm256_set1_epi16(2);
+
+        // 16 source texels per row -> 8 output texels
+        for (; x + 8 <= dstWidth; x += 8)
+        {
+            __m256 const a0 = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(row0 + 2 * x)));
+            __m256 const b0 = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(row0 + 2 * x + 8)));
+            __m256 const a1 = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(row1 + 2 * x)));
+            __m256 const b1 = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(row1 + 2 * x + 8)));
+
+            // shuffle_ps works per 128-bit lane; the 64-bit permute restores texel order
+            __m256i const even0 = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a0, b0, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+            __m256i const odd0  = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a0, b0, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0));
+            __m256i const even1 = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a1, b1, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+            __m256i const odd1  = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a1, b1, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0));
+
+            __m256i lo = _mm256_add_epi16(_mm256_add_epi16(_mm256_unpacklo_epi8(even0, zero), _mm256_unpacklo_epi8(odd0, zero)),
+                                          _mm256_add_epi16(_mm256_unpacklo_epi8(even1, zero), _mm256_unpacklo_epi8(odd1, zero)));
+            __m256i hi = _mm256_add_epi16(_mm256_add_epi16(_mm256_unpackhi_epi8(even0, zero), _mm256_unpackhi_epi8(odd0, zero)),
+                                          _mm256_add_epi16(_mm256_unpackhi_epi8(even1, zero), _mm256_unpackhi_epi8(odd1, zero)));
+            lo         = _mm256_srli_epi16(_mm256_add_epi16(lo, rounding), 2);
+            hi         = _mm256_srli_epi16(_mm256_add_epi16(hi, rounding), 2);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_packus_epi16(lo, hi));
+        }
+
+        return x;
+    }
+
+    int BoxRowIntegerSse2(Rgba8 const* row0, Rgba8 const* row1, Rgba8* dst, int x, int const dstWidth)
+    {
+        __m128i const zero     = _mm_setzero_si128();
+        __m128i const rounding = _mm_set1_epi16(2);
+
+        // 8 source texels per row -> 4 output texels
+        for (; x + 4 <= dstWidth; x += 4)
+        {
+            __m128 const a0 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + 2 * x)));
+            __m128 const b0 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + 2 * x + 4)));
+            __m128 const a1 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + 2 * x)));
+            __m128 const b1 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + 2 * x + 4)));
+
+            __m128i const even0 = _mm_castps_si128(_mm_shuffle_ps(a0, b0, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128i const odd0  = _mm_castps_si128(_mm_shuffle_ps(a0, b0, _MM_SHUFFLE(3, 1, 3, 1)));
+            __m128i const even1 = _mm_castps_si128(_mm_shuffle_ps(a1, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128i const odd1  = _mm_castps_si128(_mm_shuffle_ps(a1, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+            __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(even0, zero), _mm_unpacklo_epi8(odd0, zero)),
+                                       _mm_add_epi16(_mm_unpacklo_epi8(even1, zero), _mm_unpacklo_epi8(odd1, zero)));
+            __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(even0, zero), _mm_unpackhi_epi8(odd0, zero)),
+                                       _mm_add_epi16(_mm_unpackhi_epi8(even1, zero), _mm_unpackhi_epi8(odd1, zero)));
+            lo         = _mm_srli_epi16(_mm_add_epi16(lo, rounding), 2);
+            hi         = _mm_srli_epi16(_mm_add_epi16(hi, rounding), 2);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(lo, hi));
+        }
+
+        return x;
+    }
+
+    void BoxRowIntegerScalar(Rgba8 const* row0, Rgba8 const* row1, Rgba8* dst, int x, int const dstWidth, int const srcWidth)
+    {
+        for (; x < dstWidth; ++x)
+        {
+            int const    x0 = (std::min)(2 * x, srcWidth - 1);
+            int const    x1 = (std::min)(2 * x + 1, srcWidth - 1);
+            Rgba8 const& a  = row0[x0];
+            Rgba8 const& b  = row0[x1];
+            Rgba8 const& c  = row1[x0];
+            Rgba8 const& d  = row1[x1];
+
+            dst[x].r = static_cast<unsigned char>((a.r + b.r + c.r + d.r + 2) >> 2);
+            dst[x].g = static_cast<unsigned char>((a.g + b.g + c.g + d.g + 2) >> 2);
+            dst[x].b = static_cast<unsigned char>((a.b + b.b + c.b + d.b + 2) >> 2);
+            dst[x].a = static_cast<unsigned char>((a.a + b.a + c.a + d.a + 2) >> 2);
+        }
+    }
+
+    void BoxRowFloat(Rgba8 const* row0, Rgba8 const* row1, Rgba8* dst, int const dstWidth, int const srcWidth, sFilterSpace const& space)
+    {
+        __m128 const quarter = _mm_set1_ps(0.25f);
+
+        for (int x = 0; x < dstWidth; ++x)
+        {
+            int const    x0  = (std::min)(2 * x, srcWidth - 1);
+            int const    x1  = (std::min)(2 * x + 1, srcWidth - 1);
+            __m128 const top = _mm_add_ps(ToFilterSpace(row0[x0], space), ToFilterSpace(row0[x1], space));
+            __m128 const bot = _mm_add_ps(ToFilterSpace(row1[x0], space), ToFilterSpace(row1[x1], space));
+            dst[x]           = FromFilterSpace(_mm_mul_ps(_mm_add_ps(top, bot), quarter), space);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Premultiply: rgb = round(rgb * a / 255) via (t + (t >> 8)) >> 8 with t = rgb * a + 128
+    //------------------------------------------------------------------------------------------------
+    void PremultiplyRangeSse2(Rgba8* texels, size_t begin, size_t const end)
+    {
+        __m128i const zero      = _mm_setzero_si128();
+        __m128i const rgbMask   = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        __m128i const alphaKeep = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        __m128i const rounding  = _mm_set1_epi16(128);
+
+        auto const premultiplyHalf = [&](__m128i const channels)
+        {
+            __m128i const alpha  = _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i const factor = _mm_or_si128(_mm_and_si128(alpha, rgbMask), alphaKeep);
+            __m128i const t      = _mm_add_epi16(_mm_mullo_epi16(channels, factor), rounding);
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        };
+
+        for (; begin + 4 <= end; begin += 4)
+        {
+            __m128i const texels4 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(texels + begin));
+            __m128i const lo      = premultiplyHalf(_mm_unpacklo_epi8(texels4, zero));
+            __m128i const hi      = premultiplyHalf(_mm_unpackhi_epi8(texels4, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(texels + begin), _mm_packus_epi16(lo, hi));
+        }
+
+        for (; begin < end; ++begin)
+        {
+            Rgba8&     texel    = texels[begin];
+            auto const multiply = [&](unsigned char const channel)
+            {
+                int const t = channel * texel.a + 128;
+                return static_cast<unsigned char>((t + (t >> 8)) >> 8);
+            };
+            texel.r = multiply(texel.r);
+            texel.g = multiply(texel.g);
+            texel.b = multiply(texel.b);
+        }
+    }
+
+    void UnpremultiplyRange(Rgba8* texels, size_t begin, size_t const end)
+    {
+        for (; begin < end; ++begin)
+        {
+            Rgba8& texel = texels[begin];
+            if (texel.a == 0 || texel.a == 255)
+            {
+                continue;
+            }
+
+            int const  alpha  = texel.a;
+            auto const divide = [alpha](unsigned char const channel)
+            {
+                return static_cast<unsigned char>((std::min)(255, (channel * 255 + alpha / 2) / alpha));
+            };
+            texel.r = divide(texel.r);
+            texel.g = divide(texel.g);
+            texel.b = divide(texel.b);
+        }
+    }
+
+    // Texel-range kernels are split into fixed blocks, reusing the row scheduler
+    int constexpr TEXELS_PER_BLOCK = 4096;
+
+    template <typename RangeFunc>
+    void ForEachTexelRange(size_t const texelCount, sImageFilterOptions const& options, RangeFunc const& rangeFunc)
+    {
+        int const blockCount = static_cast<int>((texelCount + TEXELS_PER_BLOCK - 1) / TEXELS_PER_BLOCK);
+        ForEachRowRange(blockCount, TEXELS_PER_BLOCK, 1, options, [&](int const blockBegin, int const blockEnd)
+        {
+            size_t const begin = static_cast<size_t>(blockBegin) * TEXELS_PER_BLOCK;
+            size_t const end   = (std::min)(texelCount, static_cast<size_t>(blockEnd) * TEXELS_PER_BLOCK);
+            rangeFunc(begin, end);
+        });
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 ImageProcessing::GetDownsampledDimensions(IntVec2 const& dimensions)
+{
+    return IntVec2((std::max)(dimensions.x / 2, 1), (std::max)(dimensions.y / 2, 1));
+}
+
+//----------------------------------------------------------------------------------------------------
+int ImageProcessing::GetMipCount(IntVec2 const& dimensions)
+{
+    int mipCount = 1;
+    int largest  = (std::max)(dimensions.x, dimensions.y);
+    while (largest > 1)
+    {
+        largest >>= 1;
+        ++mipCount;
+    }
+    return mipCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::Downsample(Rgba8 const*               src,
+                                 IntVec2 const&             srcDimensions,
+                                 Rgba8*                     dst,
+                                 eImageDownsampleFilter const filter,
+                                 sImageFilterOptions const& options)
+{
+    if (filter == eImageDownsampleFilter::KAISER)
+    {
+        DownsampleKaiser(src, srcDimensions, dst, options);
+    }
+    else
+    {
+        DownsampleBox(src, srcDimensions, dst, options);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Odd sizes drop the last source row/column (floor), except for 1-texel axes which are clamped
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::DownsampleBox(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, sImageFilterOptions const& options)
+{
+    if (srcDimensions.x <= 0 || srcDimensions.y <= 0)
+    {
+        return;
+    }
+
+    IntVec2 const      dstDimensions = GetDownsampledDimensions(srcDimensions);
+    sFilterSpace const space         = MakeFilterSpace(options);
+    bool const         isIntegerPath = !space.m_isSrgb && !space.m_isAlphaWeighted;
+    bool const         useAvx2       = isIntegerPath && GetSimdLevel() >= eSimdLevel::AVX2;
+
+    ForEachRowRange(dstDimensions.y, dstDimensions.x, 1, options, [&](int const rowBegin, int const rowEnd)
+    {
+        for (int y = rowBegin; y < rowEnd; ++y)
+        {
+            Rgba8 const* row0 = src + static_cast<size_t>((std::min)(2 * y, srcDimensions.y - 1)) * srcDimensions.x;
+            Rgba8 const* row1 = src + static_cast<size_t>((std::min)(2 * y + 1, srcDimensions.y - 1)) * srcDimensions.x;
+            Rgba8*       out  = dst + static_cast<size_t>(y) * dstDimensions.x;
+
+            if (isIntegerPath)
+            {
+                int x = useAvx2 ? BoxRowIntegerAvx2(row0, row1, out, 0, dstDimensions.x) : 0;
+                x     = BoxRowIntegerSse2(row0, row1, out, x, dstDimensions.x);
+                BoxRowIntegerScalar(row0, row1, out, x, dstDimensions.x, srcDimensions.x);
+            }
+            else
+            {
+                BoxRowFloat(row0, row1, out, dstDimensions.x, srcDimensions.x, space);
+            }
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Separable: each chunk of output rows filters the source rows it needs horizontally into a
+// scratch buffer (6 border rows are shared with neighbouring chunks and filtered twice), then
+// runs the vertical pass. Edges are clamped.
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::DownsampleKaiser(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, sImageFilterOptions const& options)
+{
+    if (srcDimensions.x <= 0 || srcDimensions.y <= 0)
+    {
+        return;
+    }
+
+    IntVec2 const      dstDimensions = GetDownsampledDimensions(srcDimensions);
+    sFilterSpace const space         = MakeFilterSpace(options);
+    float const* const weights       = GetKaiserKernel().m_weights;
+    int constexpr      TAP_OFFSET    = KAISER_TAP_COUNT / 2 - 1;    // First tap of output x is source 2x - 3
+
+    __m128 tapWeights[KAISER_TAP_COUNT];
+    for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+    {
+        tapWeights[tap] = _mm_set1_ps(weights[tap]);
+    }
+
+    ForEachRowRange(dstDimensions.y, dstDimensions.x, KAISER_MIN_ROWS_PER_CHUNK, options, [&](int const rowBegin, int const rowEnd)
+    {
+        int const firstSrcRow = 2 * rowBegin - TAP_OFFSET;
+        int const srcRowCount = 2 * (rowEnd - rowBegin) + KAISER_TAP_COUNT - 2;
+
+        std::vector<sFilterTexel> decodedRow(srcDimensions.x);
+        std::vector<sFilterTexel> filteredRows(static_cast<size_t>(srcRowCount) * dstDimensions.x);
+
+        // Horizontal pass
+        for (int row = 0; row < srcRowCount; ++row)
+        {
+            int const          srcY   = (std::clamp)(firstSrcRow + row, 0, srcDimensions.y - 1);
+            Rgba8 const* const srcRow = src + static_cast<size_t>(srcY) * srcDimensions.x;
+            for (int x = 0; x < srcDimensions.x; ++x)
+            {
+                _mm_store_ps(decodedRow[x].m_rgba, ToFilterSpace(srcRow[x], space));
+            }
+
+            sFilterTexel* const out = filteredRows.data() + static_cast<size_t>(row) * dstDimensions.x;
+            for (int x = 0; x < dstDimensions.x; ++x)
+            {
+                int const firstTap = 2 * x - TAP_OFFSET;
+                __m128    sum      = _mm_setzero_ps();
+
+                if (firstTap >= 0 && firstTap + KAISER_TAP_COUNT <= srcDimensions.x)
+                {
+                    sFilterTexel const* const taps = decodedRow.data() + firstTap;
+                    for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+                    {
+                        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(taps[tap].m_rgba), tapWeights[tap]));
+                    }
+                }
+                else
+                {
+                    for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+                    {
+                        int const srcX = (std::clamp)(firstTap + tap, 0, srcDimensions.x - 1);
+                        sum            = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(decodedRow[srcX].m_rgba), tapWeights[tap]));
+                    }
+                }
+                _mm_store_ps(out[x].m_rgba, sum);
+            }
+        }
+
+        // Vertical pass
+        for (int y = rowBegin; y < rowEnd; ++y)
+        {
+            sFilterTexel const* const taps = filteredRows.data() + static_cast<size_t>(2 * (y - rowBegin)) * dstDimensions.x;
+            Rgba8* const              out  = dst + static_cast<size_t>(y) * dstDimensions.x;
+
+            for (int x = 0; x < dstDimensions.x; ++x)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int tap = 0; tap < KAISER_TAP_COUNT; ++tap)
+                {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(taps[static_cast<size_t>(tap) * dstDimensions.x + x].m_rgba), tapWeights[tap]));
+                }
+                out[x] = FromFilterSpace(sum, space);
+            }
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Texel centers are aligned ((x + 0.5) * scale - 0.5); taps outside the image are clamped
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::ResizeBilinear(Rgba8 const*               src,
+                                     IntVec2 const&             srcDimensions,
+                                     Rgba8*                     dst,
+                                     IntVec2 const&             dstDimensions,
+                                     sImageFilterOptions const& options)
+{
+    if (srcDimensions.x <= 0 || srcDimensions.y <= 0 || dstDimensions.x <= 0 || dstDimensions.y <= 0)
+    {
+        return;
+    }
+
+    struct sAxisTap
+    {
+        int   m_index0  = 0;
+        int   m_index1  = 0;
+        float m_weight1 = 0.f;
+    };
+
+    auto const buildAxisTaps = [](int const srcSize, int const dstSize)
+    {
+        std::vector<sAxisTap> taps(dstSize);
+        float const           scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+        for (int i = 0; i < dstSize; ++i)
+        {
+            float const position = (std::max)((static_cast<float>(i) + 0.5f) * scale - 0.5f, 0.f);
+            int const   index0   = (std::min)(static_cast<int>(position), srcSize - 1);
+            taps[i].m_index0     = index0;
+            taps[i].m_index1     = (std::min)(index0 + 1, srcSize - 1);
+            taps[i].m_weight1    = position - static_cast<float>(index0);
+        }
+        return taps;
+    };
+
+    std::vector<sAxisTap> const columnTaps = buildAxisTaps(srcDimensions.x, dstDimensions.x);
+    std::vector<sAxisTap> const rowTaps    = buildAxisTaps(srcDimensions.y, dstDimensions.y);
+    sFilterSpace const          space      = MakeFilterSpace(options);
+
+    ForEachRowRange(dstDimensions.y, dstDimensions.x, 1, options, [&](int const rowBegin, int const rowEnd)
+    {
+        for (int y = rowBegin; y < rowEnd; ++y)
+        {
+            sAxisTap const&    rowTap = rowTaps[y];
+            Rgba8 const* const row0   = src + static_cast<size_t>(rowTap.m_index0) * srcDimensions.x;
+            Rgba8 const* const row1   = src + static_cast<size_t>(rowTap.m_index1) * srcDimensions.x;
+            __m128 const       fy     = _mm_set1_ps(rowTap.m_weight1);
+            Rgba8* const       out    = dst + static_cast<size_t>(y) * dstDimensions.x;
+
+            for (int x = 0; x < dstDimensions.x; ++x)
+            {
+                sAxisTap const& columnTap = columnTaps[x];
+                __m128 const    fx        = _mm_set1_ps(columnTap.m_weight1);
+
+                __m128 const c00 = ToFilterSpace(row0[columnTap.m_index0], space);
+                __m128 const c10 = ToFilterSpace(row0[columnTap.m_index1], space);
+                __m128 const c01 = ToFilterSpace(row1[columnTap.m_index0], space);
+                __m128 const c11 = ToFilterSpace(row1[columnTap.m_index1], space);
+
+                __m128 const top    = _mm_add_ps(c00, _mm_mul_ps(_mm_sub_ps(c10, c00), fx));
+                __m128 const bottom = _mm_add_ps(c01, _mm_mul_ps(_mm_sub_ps(c11, c01), fx));
+                out[x]              = FromFilterSpace(_mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), fy)), space);
+            }
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::PremultiplyAlpha(Rgba8* texels, size_t const texelCount, sImageFilterOptions const& options)
+{
+    ForEachTexelRange(texelCount, options, [texels](size_t const begin, size_t const end)
+    {
+        PremultiplyRangeSse2(texels, begin, end);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::UnpremultiplyAlpha(Rgba8* texels, size_t const texelCount, sImageFilterOptions const& options)
+{
+    ForEachTexelRange(texelCount, options, [texels](size_t const begin, size_t const end)
+    {
+        UnpremultiplyRange(texels, begin, end);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+Image ImageProcessing::Downsample(Image const& image, eImageDownsampleFilter const filter, sImageFilterOptions const& options)
+{
+    Image result(GetDownsampledDimensions(image.GetDimensions()), Rgba8());
+    Downsample(image.GetTexels(), image.GetDimensions(), result.GetTexels(), filter, options);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+Image ImageProcessing::ResizeBilinear(Image const& image, IntVec2 const& dstDimensions, sImageFilterOptions const& options)
+{
+    Image result(dstDimensions, Rgba8());
+    ResizeBilinear(image.GetTexels(), image.GetDimensions(), result.GetTexels(), dstDimensions, options);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ImageProcessing::PremultiplyAlpha(Image& image, sImageFilterOptions const& options)
+{
+    IntVec2 const dimensions = image.GetDimensions();
+    PremultiplyAlpha(image.GetTexels(), static_cast<size_t>(dimensions.x) * dimensions.y, options);
+}
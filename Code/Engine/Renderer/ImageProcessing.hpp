@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------
+// ImageProcessing.hpp
+//
+// Purpose:
+//   Whole-image kernels on tightly packed RGBA8 texels: 2x downsample (box or Kaiser-windowed
+//   sinc) for mip chains, bilinear resize, and premultiplied-alpha conversion.
+//
+// Design Rationale:
+//   - Filtering happens in linear light: sRGB texels are decoded through a 256-entry table and
+//     re-encoded through an 8192-entry table, so mips of sRGB content do not darken
+//   - Straight-alpha input is filtered alpha-weighted (color * (alpha + epsilon)), so transparent
+//     texels do not bleed their color into opaque neighbours; fully transparent areas keep
+//     their average color because of the epsilon
+//   - One texel is one __m128 (r, g, b, a) in the float paths (SSE2, always available on x64).
+//     The integer box path (linear, unweighted) runs 8 texels per step with AVX2 when the CPU has
+//     it, 4 with SSE2 otherwise
+//   - Rows are split across JobSystem workers with ParallelFor() (the calling thread helps);
+//     small images stay on the calling thread
+//   - Kernels write into caller-owned memory, so TextureCooker can fill its mip chain in place
+//
+// Thread Safety:
+//   - Stateless apart from lazily built, read-only lookup tables; safe from any thread
+//
+// Author: Image Processing Kernels
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/IntVec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Image;
+class JobSystem;
+
+//----------------------------------------------------------------------------------------------------
+enum class eImageColorSpace : uint8_t
+{
+    LINEAR,     // RGB stored as-is (normal maps, masks, data)
+    SRGB        // RGB is sRGB-encoded (albedo, UI); alpha is always linear
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eImageDownsampleFilter : uint8_t
+{
+    BOX,        // 2x2 average; fastest
+    KAISER      // 8x8 Kaiser-windowed sinc; sharper mips, less aliasing
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sImageFilterOptions
+{
+    eImageColorSpace m_colorSpace      = eImageColorSpace::SRGB;
+    bool             m_isAlphaWeighted = true;      // Weight color by alpha while filtering (straight-alpha input)
+    bool             m_isPremultiplied = false;     // Input is premultiplied; filters channels directly, ignores m_isAlphaWeighted
+    bool             m_runInParallel   = true;      // Split rows across JobSystem workers (large images only)
+    JobSystem*       m_jobSystem       = nullptr;   // nullptr = g_jobSystem
+};
+
+//----------------------------------------------------------------------------------------------------
+class ImageProcessing
+{
+public:
+    // Next mip size: half of each axis, at least 1
+    static IntVec2 GetDownsampledDimensions(IntVec2 const& dimensions);
+
+    // Number of levels in a full chain down to 1x1, base level included
+    static int GetMipCount(IntVec2 const& dimensions);
+
+    // dst has GetDownsampledDimensions(srcDimensions) texels; src and dst must not overlap
+    static void Downsample(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, eImageDownsampleFilter filter, sImageFilterOptions const& options = {});
+    static void DownsampleBox(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, sImageFilterOptions const& options = {});
+    static void DownsampleKaiser(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, sImageFilterOptions const& options = {});
+
+    // Any size to any size; aliases when shrinking by more than 2x (chain Downsample() first)
+    static void ResizeBilinear(Rgba8 const* src, IntVec2 const& srcDimensions, Rgba8* dst, IntVec2 const& dstDimensions, sImageFilterOptions const& options = {});
+
+    // In place, in encoded space: rgb = rgb * a / 255 (rounded) and the inverse
+    static void PremultiplyAlpha(Rgba8* texels, size_t texelCount, sImageFilterOptions const& options = {});
+    static void UnpremultiplyAlpha(Rgba8* texels, size_t texelCount, sImageFilterOptions const& options = {});
+
+    // Image conveniences
+    static Image Downsample(Image const& image, eImageDownsampleFilter filter, sImageFilterOptions const& options = {});
+    static Image ResizeBilinear(Image const& image, IntVec2 const& dstDimensions, sImageFilterOptions const& options = {});
+    static void  PremultiplyAlpha(Image& image, sImageFilterOptions const& options = {});
+};
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------------------------------
+// VertexTransform.hpp
+//
+// Purpose:
+//   Batched Mat44 transforms for interleaved vertex arrays (CPU skinning, CPU instancing, font and
+//   UI quads). Backs TransformVertexArray3D / TransformVertexArrayXY3D in VertexUtils.
+//
+// Design Rationale:
+//   - One pass over the array: position, tangent, bitangent and normal of a batch are transformed
+//     together instead of one stream (or one out-of-line Mat44 call) at a time
+//   - Batches are transposed to structure-of-arrays in registers: 4 vertices per step with SSE2,
+//     8 with AVX, scalar for the tail. GetSimdLevel() picks the path at runtime.
+//   - Every path multiplies and adds in the same order as Mat44::TransformPosition3D (no FMA),
+//     so SIMD, scalar and the old per-vertex results are bit-identical
+//   - Tangent/bitangent use the upper 3x3, normals its inverse transpose (correct under
+//     non-uniform scale); the frame is renormalized afterwards
+//   - Vec3 streams are read and written 12 bytes at a time, so neighbouring fields (color, UVs)
+//     and the memory past the last vertex are never touched
+//   - Arrays above MIN_PARALLEL_VERTICES are split across JobSystem workers with ParallelFor()
+//
+// Thread Safety:
+//   - Stateless; concurrent calls on different arrays are safe
+//
+// Author: Vertex Transform Kernels
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/CpuFeatures.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class JobSystem;
+struct Mat44;
+struct Vertex_PCU;
+struct Vertex_PCUTBN;
+
+//----------------------------------------------------------------------------------------------------
+// Byte offsets of the Vec3 streams inside one vertex; -1 = absent
+//----------------------------------------------------------------------------------------------------
+struct sVertexStreamLayout
+{
+    size_t m_stride          = 0;
+    int    m_positionOffset  = -1;
+    int    m_tangentOffset   = -1;
+    int    m_bitangentOffset = -1;
+    int    m_normalOffset    = -1;
+
+    static sVertexStreamLayout MakePCU();
+    static sVertexStreamLayout MakePCUTBN();
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sVertexTransformOptions
+{
+    bool       m_transformTangentFrame   = true;                // Tangent, bitangent and normal streams (when present)
+    bool       m_renormalizeTangentFrame = true;
+    eSimdLevel m_maxSimdLevel            = eSimdLevel::AVX2;    // Cap for benchmarks / A-B checks
+    bool       m_runInParallel           = true;
+    JobSystem* m_jobSystem               = nullptr;             // nullptr = g_jobSystem
+};
+
+//----------------------------------------------------------------------------------------------------
+class VertexTransform
+{
+public:
+    static void Transform(void* vertices, int vertexCount, sVertexStreamLayout const& layout, Mat44 const& transform, sVertexTransformOptions const& options = {});
+    static void Transform(Vertex_PCU* vertices, int vertexCount, Mat44 const& transform, sVertexTransformOptions const& options = {});
+    static void Transform(Vertex_PCUTBN* vertices, int vertexCount, Mat44 const& transform, sVertexTransformOptions const& options = {});
+
+    // Inverse transpose of the upper 3x3 (translation cleared); transforms normals
+    static Mat44 GetNormalMatrix(Mat44 const& transform);
+
+    static int constexpr MIN_PARALLEL_VERTICES = 16384;
+    static int constexpr VERTICES_PER_CHUNK    = 4096;
+};
@@ -7,6 +7,7 @@
 
 #include "Vertex_PCUTBN.hpp"
 #include "Engine/Renderer/Vertex_PCU.hpp"
+#include "Engine/Renderer/VertexTransform.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Math/Capsule2.hpp"
@@ -47,32 +48,32 @@ void TransformVertexArrayXY3D(int const   numVerts,
                               float const rotationDegreesAboutZ,
                               Vec2 const& translationXY)
 {
-    for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
-    {
-        Vec3& position = verts[vertIndex].m_position;
+    // Same scale -> rotate -> translate as TransformPositionXY3D, folded into one matrix for the batched kernels
+    float const scaledCos = uniformScaleXY * CosDegrees(rotationDegreesAboutZ);
+    float const scaledSin = uniformScaleXY * SinDegrees(rotationDegreesAboutZ);
 
-        TransformPositionXY3D(position, uniformScaleXY, rotationDegreesAboutZ, translationXY);
-    }
+    Mat44 const transform(Vec3(scaledCos, scaledSin, 0.f),
+                          Vec3(-scaledSin, scaledCos, 0.f),
+                          Vec3(0.f, 0.f, 1.f),
+                          Vec3(translationXY.x, translationXY.y, 0.f));
+
+    VertexTransform::Transform(verts, numVerts, transform);
 }
 
 //----------------------------------------------------------------------------------------------------
 void TransformVertexArray3D(VertexList_PCU& verts,
                             Mat44 const&    transform)
 {
-    for (Vertex_PCU& vert : verts)
-    {
-        vert.m_position = transform.TransformPosition3D(vert.m_position);
-    }
+    VertexTransform::Transform(verts.data(), static_cast<int>(verts.size()), transform);
 }
 
+//----------------------------------------------------------------------------------------------------
+// Transforms the tangent frame too: tangent/bitangent by the matrix, normal by its inverse transpose
 //----------------------------------------------------------------------------------------------------
 void TransformVertexArray3D(VertexList_PCUTBN& verts,
                             Mat44 const&       transform)
 {
-    for (Vertex_PCUTBN& vert : verts)
-    {
-        vert.m_position = transform.TransformPosition3D(vert.m_position);
-    }
+    VertexTransform::Transform(verts.data(), static_cast<int>(verts.size()), transform);
 }
 
 //----------------------------------------------------------------------------------------------------
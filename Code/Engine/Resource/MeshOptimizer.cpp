@@ -0,0 +1,455 @@
+//----------------------------------------------------------------------------------------------------
+// MeshOptimizer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Resource/MeshOptimizer.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Time.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Renderer/Vertex_PCUTBN.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint32_t constexpr NO_VERTEX = 0xFFFFFFFFu;
+
+    //------------------------------------------------------------------------------------------------
+    bool AreIndexesInRange(IndexList const& indexes, size_t const vertexCount)
+    {
+        return std::all_of(indexes.begin(), indexes.end(), [vertexCount](unsigned int const index) { return index < vertexCount; });
+    }
+
+    // Angle between two edges leaving a corner (MikkTSpace weights each corner's contribution by it)
+    float GetCornerAngleRadians(Vec3 const& edgeA, Vec3 const& edgeB)
+    {
+        float const cosine = DotProduct3D(edgeA.GetNormalized(), edgeB.GetNormalized());
+        return std::acos((std::max)(-1.f, (std::min)(1.f, cosine)));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float QuantizeInRange(float const value, float const rangeMin, float const rangeMax, float const steps)
+    {
+        if (rangeMax <= rangeMin)
+        {
+            return value;
+        }
+        float const scale = (rangeMax - rangeMin) / steps;
+        return rangeMin + std::round((value - rangeMin) / scale) * scale;
+    }
+
+    float QuantizeSnorm(float const value, float const steps)
+    {
+        return std::round((std::max)(-1.f, (std::min)(1.f, value)) * steps) / steps;
+    }
+
+    Vec3 QuantizeUnitVector(Vec3 const& vector, float const steps)
+    {
+        return Vec3(QuantizeSnorm(vector.x, steps), QuantizeSnorm(vector.y, steps), QuantizeSnorm(vector.z, steps));
+    }
+
+    float GetQuantizeSteps(int const bits)
+    {
+        return static_cast<float>((1u << std::clamp(bits, 2, 24)) - 1u);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Bitwise vertex identity for welding (Vertex_PCUTBN is tightly packed floats + Rgba8)
+    struct sVertexBytesHasher
+    {
+        VertexList_PCUTBN const* m_vertexes = nullptr;
+
+        size_t operator()(uint32_t const vertexIndex) const
+        {
+            uint8_t const* bytes = reinterpret_cast<uint8_t const*>(&(*m_vertexes)[vertexIndex]);
+            uint64_t       hash  = 14695981039346656037ull;     // FNV-1a
+            for (size_t byteIndex = 0; byteIndex < sizeof(Vertex_PCUTBN); ++byteIndex)
+            {
+                hash = (hash ^ bytes[byteIndex]) * 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    struct sVertexBytesEqual
+    {
+        VertexList_PCUTBN const* m_vertexes = nullptr;
+
+        bool operator()(uint32_t const a, uint32_t const b) const
+        {
+            return std::memcmp(&(*m_vertexes)[a], &(*m_vertexes)[b], sizeof(Vertex_PCUTBN)) == 0;
+        }
+    };
+}
+
+//----------------------------------------------------------------------------------------------------
+sMeshOptimizeReport MeshOptimizer::Optimize(VertexList_PCUTBN&          vertexes,
+                                            IndexList&                  indexes,
+                                            bool const                  hasUVs,
+                                            sMeshOptimizeOptions const& options)
+{
+    double const startTime = GetCurrentTimeSeconds();
+
+    sMeshOptimizeReport report;
+    report.m_before = AnalyzeVertexCache(indexes, vertexes.size(), options.m_cacheSize);
+
+    if (!indexes.empty() && AreIndexesInRange(indexes, vertexes.size()))
+    {
+        if (options.m_generateTangents)
+        {
+            GenerateTangents(vertexes, indexes, hasUVs);
+        }
+        if (options.m_quantize)
+        {
+            report.m_weldedVertices = QuantizeVertices(vertexes, indexes, options.m_quantizeOptions);
+        }
+        if (options.m_optimizeVertexCache)
+        {
+            OptimizeVertexCache(indexes, vertexes.size(), options.m_cacheSize);
+        }
+        if (options.m_optimizeVertexFetch)
+        {
+            OptimizeVertexFetch(vertexes, indexes);
+        }
+    }
+
+    report.m_after   = AnalyzeVertexCache(indexes, vertexes.size(), options.m_cacheSize);
+    report.m_seconds = GetCurrentTimeSeconds() - startTime;
+    return report;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MeshOptimizer::GenerateTangents(VertexList_PCUTBN& vertexes, IndexList const& indexes, bool const hasUVs)
+{
+    std::vector<Vec3> tangentSums(hasUVs ? vertexes.size() : 0);
+    std::vector<Vec3> bitangentSums(hasUVs ? vertexes.size() : 0);
+
+    for (size_t triangleStart = 0; hasUVs && triangleStart + 2 < indexes.size(); triangleStart += 3)
+    {
+        unsigned int const   corners[3] = {indexes[triangleStart], indexes[triangleStart + 1], indexes[triangleStart + 2]};
+        Vertex_PCUTBN const& vertex0    = vertexes[corners[0]];
+        Vertex_PCUTBN const& vertex1    = vertexes[corners[1]];
+        Vertex_PCUTBN const& vertex2    = vertexes[corners[2]];
+
+        Vec3 const  edge1        = vertex1.m_position - vertex0.m_position;
+        Vec3 const  edge2        = vertex2.m_position - vertex0.m_position;
+        Vec2 const  deltaUV1     = vertex1.m_uvTexCoords - vertex0.m_uvTexCoords;
+        Vec2 const  deltaUV2     = vertex2.m_uvTexCoords - vertex0.m_uvTexCoords;
+        float const determinant  = deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y;
+
+        // Degenerate UV mapping: no usable direction, the vertex falls back to an arbitrary frame
+        if (std::fabs(determinant) < 1e-20f)
+        {
+            continue;
+        }
+
+        float const inverseDeterminant = 1.f / determinant;
+        Vec3 const  triangleTangent    = ((edge1 * deltaUV2.y - edge2 * deltaUV1.y) * inverseDeterminant).GetNormalized();
+        Vec3 const  triangleBitangent  = ((edge2 * deltaUV1.x - edge1 * deltaUV2.x) * inverseDeterminant).GetNormalized();
+
+        Vec3 const positions[3] = {vertex0.m_position, vertex1.m_position, vertex2.m_position};
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            Vec3 const& here   = positions[corner];
+            float const weight = GetCornerAngleRadians(positions[(corner + 1) % 3] - here, positions[(corner + 2) % 3] - here);
+
+            tangentSums[corners[corner]] += triangleTangent * weight;
+            bitangentSums[corners[corner]] += triangleBitangent * weight;
+        }
+    }
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        Vertex_PCUTBN& vertex = vertexes[vertexIndex];
+        Vec3 const     normal = vertex.m_normal.GetNormalized();
+        if (normal == Vec3::ZERO)
+        {
+            continue;
+        }
+
+        // Gram-Schmidt: remove the normal component, keep the handedness of the UV bitangent
+        Vec3 tangent   = hasUVs ? tangentSums[vertexIndex] : Vec3::ZERO;
+        tangent        = (tangent - normal * DotProduct3D(normal, tangent)).GetNormalized();
+        float handedness = 1.f;
+
+        if (tangent == Vec3::ZERO)
+        {
+            Vec3 unusedBasis;
+            normal.GetOrthonormalBasis(normal, &tangent, &unusedBasis);
+        }
+        else if (DotProduct3D(CrossProduct3D(normal, tangent), bitangentSums[vertexIndex]) < 0.f)
+        {
+            handedness = -1.f;
+        }
+
+        vertex.m_tangent   = tangent;
+        vertex.m_bitangent = CrossProduct3D(normal, tangent) * handedness;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Tipsify: fan around a "fanning" vertex, emitting all of its remaining triangles, then move to the
+// neighbour that will still be in the FIFO after its own remaining triangles are emitted (highest
+// age that fits); when none qualifies, pop recently used vertices (dead-end stack), then scan.
+//----------------------------------------------------------------------------------------------------
+void MeshOptimizer::OptimizeVertexCache(IndexList& indexes, size_t const vertexCount, uint32_t const cacheSize)
+{
+    size_t const triangleCount = indexes.size() / 3;
+    if (triangleCount == 0 || cacheSize == 0 || !AreIndexesInRange(indexes, vertexCount))
+    {
+        return;
+    }
+
+    // Vertex -> triangle adjacency (compressed rows)
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t corner = 0; corner < triangleCount * 3; ++corner)
+    {
+        ++adjacencyOffsets[indexes[corner] + 1];
+    }
+    for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+    {
+        adjacencyOffsets[vertexIndex + 1] += adjacencyOffsets[vertexIndex];
+    }
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    std::vector<uint32_t> liveTriangles(vertexCount);
+    {
+        std::vector<uint32_t> fillCursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t corner = 0; corner < triangleCount * 3; ++corner)
+        {
+            adjacency[fillCursor[indexes[corner]]++] = static_cast<uint32_t>(corner / 3);
+        }
+        for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+        {
+            liveTriangles[vertexIndex] = adjacencyOffsets[vertexIndex + 1] - adjacencyOffsets[vertexIndex];
+        }
+    }
+
+    std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+    std::vector<uint8_t>  isTriangleEmitted(triangleCount, 0);
+    std::vector<uint32_t> deadEndStack;
+    std::vector<uint32_t> candidates;
+    IndexList             optimized;
+    deadEndStack.reserve(triangleCount * 3);
+    optimized.reserve(triangleCount * 3);
+
+    uint32_t timestamp     = cacheSize + 1;
+    size_t   scanCursor    = 0;
+    uint32_t fanningVertex = indexes[0];
+
+    while (fanningVertex != NO_VERTEX)
+    {
+        candidates.clear();
+
+        for (uint32_t adjacencyIndex = adjacencyOffsets[fanningVertex]; adjacencyIndex < adjacencyOffsets[fanningVertex + 1]; ++adjacencyIndex)
+        {
+            uint32_t const triangle = adjacency[adjacencyIndex];
+            if (isTriangleEmitted[triangle])
+            {
+                continue;
+            }
+            isTriangleEmitted[triangle] = 1;
+
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                uint32_t const vertex = indexes[triangle * 3 + corner];
+                optimized.push_back(vertex);
+                deadEndStack.push_back(vertex);
+                candidates.push_back(vertex);
+                --liveTriangles[vertex];
+
+                if (timestamp - cacheTimestamps[vertex] > cacheSize)
+                {
+                    cacheTimestamps[vertex] = timestamp++;
+                }
+            }
+        }
+
+        // Next fanning vertex: the oldest candidate that stays cached through its own fan
+        uint32_t nextVertex   = NO_VERTEX;
+        int64_t  bestPriority = -1;
+        for (uint32_t const candidate : candidates)
+        {
+            if (liveTriangles[candidate] == 0)
+            {
+                continue;
+            }
+
+            int64_t      priority = 0;
+            int64_t const age     = static_cast<int64_t>(timestamp) - cacheTimestamps[candidate];
+            if (age + 2 * static_cast<int64_t>(liveTriangles[candidate]) <= static_cast<int64_t>(cacheSize))
+            {
+                priority = age;
+            }
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                nextVertex   = candidate;
+            }
+        }
+
+        // Dead end: most recently referenced vertex with work left, else the next one in input order
+        while (nextVertex == NO_VERTEX && !deadEndStack.empty())
+        {
+            uint32_t const recent = deadEndStack.back();
+            deadEndStack.pop_back();
+            if (liveTriangles[recent] > 0)
+            {
+                nextVertex = recent;
+            }
+        }
+        while (nextVertex == NO_VERTEX && scanCursor < vertexCount)
+        {
+            if (liveTriangles[scanCursor] > 0)
+            {
+                nextVertex = static_cast<uint32_t>(scanCursor);
+            }
+            ++scanCursor;
+        }
+
+        fanningVertex = nextVertex;
+    }
+
+    // Trailing indices that do not form a triangle are kept as-is
+    optimized.insert(optimized.end(), indexes.begin() + static_cast<std::ptrdiff_t>(triangleCount * 3), indexes.end());
+    indexes.swap(optimized);
+}
+
+//----------------------------------------------------------------------------------------------------
+void MeshOptimizer::OptimizeVertexFetch(VertexList_PCUTBN& vertexes, IndexList& indexes)
+{
+    if (!AreIndexesInRange(indexes, vertexes.size()))
+    {
+        return;
+    }
+
+    std::vector<uint32_t> remap(vertexes.size(), NO_VERTEX);
+    VertexList_PCUTBN     reordered;
+    reordered.reserve(vertexes.size());
+
+    for (unsigned int& index : indexes)
+    {
+        if (remap[index] == NO_VERTEX)
+        {
+            remap[index] = static_cast<uint32_t>(reordered.size());
+            reordered.push_back(vertexes[index]);
+        }
+        index = remap[index];
+    }
+
+    vertexes.swap(reordered);
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t MeshOptimizer::QuantizeVertices(VertexList_PCUTBN& vertexes, IndexList& indexes, sMeshQuantizeOptions const& options)
+{
+    if (vertexes.empty() || !AreIndexesInRange(indexes, vertexes.size()))
+    {
+        return 0;
+    }
+
+    Vec3 positionMin = vertexes[0].m_position;
+    Vec3 positionMax = vertexes[0].m_position;
+    Vec2 uvMin       = vertexes[0].m_uvTexCoords;
+    Vec2 uvMax       = vertexes[0].m_uvTexCoords;
+    for (Vertex_PCUTBN const& vertex : vertexes)
+    {
+        positionMin = Vec3((std::min)(positionMin.x, vertex.m_position.x), (std::min)(positionMin.y, vertex.m_position.y), (std::min)(positionMin.z, vertex.m_position.z));
+        positionMax = Vec3((std::max)(positionMax.x, vertex.m_position.x), (std::max)(positionMax.y, vertex.m_position.y), (std::max)(positionMax.z, vertex.m_position.z));
+        uvMin       = Vec2((std::min)(uvMin.x, vertex.m_uvTexCoords.x), (std::min)(uvMin.y, vertex.m_uvTexCoords.y));
+        uvMax       = Vec2((std::max)(uvMax.x, vertex.m_uvTexCoords.x), (std::max)(uvMax.y, vertex.m_uvTexCoords.y));
+    }
+
+    float const positionSteps = GetQuantizeSteps(options.m_positionBits);
+    float const uvSteps       = GetQuantizeSteps(options.m_uvBits);
+    float const vectorSteps   = static_cast<float>((1u << (std::clamp(options.m_vectorBits, 2, 24) - 1)) - 1u);
+
+    for (Vertex_PCUTBN& vertex : vertexes)
+    {
+        vertex.m_position.x    = QuantizeInRange(vertex.m_position.x, positionMin.x, positionMax.x, positionSteps);
+        vertex.m_position.y    = QuantizeInRange(vertex.m_position.y, positionMin.y, positionMax.y, positionSteps);
+        vertex.m_position.z    = QuantizeInRange(vertex.m_position.z, positionMin.z, positionMax.z, positionSteps);
+        vertex.m_uvTexCoords.x = QuantizeInRange(vertex.m_uvTexCoords.x, uvMin.x, uvMax.x, uvSteps);
+        vertex.m_uvTexCoords.y = QuantizeInRange(vertex.m_uvTexCoords.y, uvMin.y, uvMax.y, uvSteps);
+        vertex.m_normal        = QuantizeUnitVector(vertex.m_normal, vectorSteps);
+        vertex.m_tangent       = QuantizeUnitVector(vertex.m_tangent, vectorSteps);
+        vertex.m_bitangent     = QuantizeUnitVector(vertex.m_bitangent, vectorSteps);
+    }
+
+    // Weld: first occurrence of each distinct vertex survives, in original order
+    std::unordered_set<uint32_t, sVertexBytesHasher, sVertexBytesEqual> uniqueVertexes(vertexes.size(), sVertexBytesHasher{&vertexes}, sVertexBytesEqual{&vertexes});
+    std::vector<uint32_t> remap(vertexes.size());
+    std::vector<uint32_t> survivors;
+    survivors.reserve(vertexes.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        auto const [it, isInserted] = uniqueVertexes.insert(static_cast<uint32_t>(vertexIndex));
+        if (isInserted)
+        {
+            remap[vertexIndex] = static_cast<uint32_t>(survivors.size());
+            survivors.push_back(static_cast<uint32_t>(vertexIndex));
+        }
+        else
+        {
+            remap[vertexIndex] = remap[*it];
+        }
+    }
+
+    size_t const weldedCount = vertexes.size() - survivors.size();
+    if (weldedCount == 0)
+    {
+        return 0;
+    }
+
+    for (unsigned int& index : indexes)
+    {
+        index = remap[index];
+    }
+
+    // survivors[k] >= k and increasing, so compaction in place never overwrites a pending survivor
+    for (size_t keptIndex = 0; keptIndex < survivors.size(); ++keptIndex)
+    {
+        vertexes[keptIndex] = vertexes[survivors[keptIndex]];
+    }
+    vertexes.resize(survivors.size());
+
+    return weldedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+sVertexCacheStats MeshOptimizer::AnalyzeVertexCache(IndexList const& indexes, size_t const vertexCount, uint32_t const cacheSize)
+{
+    sVertexCacheStats stats;
+    stats.m_triangleCount = indexes.size() / 3;
+    if (stats.m_triangleCount == 0 || cacheSize == 0 || !AreIndexesInRange(indexes, vertexCount))
+    {
+        return stats;
+    }
+
+    // FIFO: an entry is evicted cacheSize insertions after its own; hits do not refresh it
+    std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+    std::vector<uint8_t>  isReferenced(vertexCount, 0);
+    uint32_t              timestamp = cacheSize + 1;
+
+    for (size_t corner = 0; corner < stats.m_triangleCount * 3; ++corner)
+    {
+        unsigned int const vertex = indexes[corner];
+        if (timestamp - cacheTimestamps[vertex] > cacheSize)
+        {
+            cacheTimestamps[vertex] = timestamp++;
+            ++stats.m_cacheMisses;
+        }
+        stats.m_vertexCount += isReferenced[vertex] ? 0 : 1;
+        isReferenced[vertex] = 1;
+    }
+
+    stats.m_acmr = static_cast<float>(stats.m_cacheMisses) / static_cast<float>(stats.m_triangleCount);
+    stats.m_atvr = stats.m_vertexCount > 0 ? static_cast<float>(stats.m_cacheMisses) / static_cast<float>(stats.m_vertexCount) : 0.f;
+    return stats;
+}
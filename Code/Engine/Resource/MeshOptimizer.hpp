@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// MeshOptimizer.hpp
+//
+// Purpose:
+//   Post-load processing for indexed Vertex_PCUTBN meshes: tangent frames, post-transform
+//   vertex-cache ordering, vertex-fetch ordering and optional attribute quantization, plus a FIFO
+//   cache simulation (ACMR / ATVR) to measure the effect on the CPU.
+//
+// Design Rationale:
+//   - Tangents follow MikkTSpace's construction: per-triangle UV-derived tangent/bitangent, corner
+//     angle weighting, Gram-Schmidt against the vertex normal, handedness folded into the bitangent.
+//     Vertices are not split on mirrored UVs (the loader already splits on UV seams).
+//   - Vertex cache: Tipsify (Sander, Nehab, Barczak 2007). Linear time, one adjacency build, tuned
+//     for a FIFO cache of m_cacheSize entries
+//   - Vertex fetch: vertices renumbered in first-use order of the optimized index stream, so the
+//     vertex buffer is walked front to back; unreferenced vertices are dropped
+//   - Quantization snaps attributes to the precision of a packed format (positions in the mesh
+//     bounds, UVs in their range, unit vectors as snorm) and welds the vertices that become equal
+//   - AnalyzeVertexCache() simulates the same FIFO; ACMR = misses / triangle (ideal ~0.5-0.7),
+//     ATVR = misses / unique vertex (ideal 1.0)
+//
+// Thread Safety:
+//   - Stateless; concurrent calls on different meshes are safe
+//
+// Author: Mesh Optimization Pass
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/VertexUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct sVertexCacheStats
+{
+    size_t m_triangleCount = 0;
+    size_t m_vertexCount   = 0;     // Unique vertices referenced by the index buffer
+    size_t m_cacheMisses   = 0;     // Vertex shader invocations under the simulated FIFO
+    float  m_acmr          = 0.f;   // Average cache miss ratio: misses / triangle
+    float  m_atvr          = 0.f;   // Average transformed vertex ratio: misses / unique vertex
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMeshQuantizeOptions
+{
+    int m_positionBits = 16;    // Per axis, over the mesh bounds
+    int m_uvBits       = 16;    // Per axis, over the UV range
+    int m_vectorBits   = 10;    // Normal / tangent / bitangent components, snorm
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMeshOptimizeOptions
+{
+    bool                 m_generateTangents    = true;
+    bool                 m_optimizeVertexCache = true;
+    bool                 m_optimizeVertexFetch = true;
+    bool                 m_quantize            = false;
+    sMeshQuantizeOptions m_quantizeOptions;
+    uint32_t             m_cacheSize           = 16;    // FIFO entries targeted by Tipsify and the metric
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMeshOptimizeReport
+{
+    sVertexCacheStats m_before;
+    sVertexCacheStats m_after;
+    size_t            m_weldedVertices = 0;     // Vertices merged after quantization
+    double            m_seconds        = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+class MeshOptimizer
+{
+public:
+    // Runs the enabled stages in order: tangents, quantize + weld, vertex cache, vertex fetch
+    static sMeshOptimizeReport Optimize(VertexList_PCUTBN& vertexes, IndexList& indexes, bool hasUVs, sMeshOptimizeOptions const& options = sMeshOptimizeOptions());
+
+    // Fills m_tangent / m_bitangent (orthonormal to m_normal). Without UVs an arbitrary frame is built.
+    static void GenerateTangents(VertexList_PCUTBN& vertexes, IndexList const& indexes, bool hasUVs);
+
+    // Reorders triangles in place (Tipsify)
+    static void OptimizeVertexCache(IndexList& indexes, size_t vertexCount, uint32_t cacheSize = 16);
+
+    // Renumbers vertices in first-use order and drops unreferenced ones
+    static void OptimizeVertexFetch(VertexList_PCUTBN& vertexes, IndexList& indexes);
+
+    // Snaps attributes to packed precision and welds identical vertices; returns the number removed
+    static size_t QuantizeVertices(VertexList_PCUTBN& vertexes, IndexList& indexes, sMeshQuantizeOptions const& options = sMeshQuantizeOptions());
+
+    static sVertexCacheStats AnalyzeVertexCache(IndexList const& indexes, size_t vertexCount, uint32_t cacheSize = 16);
+};
@@ -0,0 +1,319 @@
+//----------------------------------------------------------------------------------------------------
+// ModelCooker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Resource/ModelCooker.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/BufferParser.hpp"
+#include "Engine/Core/BufferWriter.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/MemoryMappedFile.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Resource/ModelResource.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <filesystem>
+#include <limits>
+#include <system_error>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t constexpr   COOKED_MESH_ARRAY_ALIGNMENT = 16;
+    uint32_t constexpr COOKED_MESH_HAS_NORMALS     = 1u << 0;
+    uint32_t constexpr COOKED_MESH_HAS_UVS         = 1u << 1;
+
+    //------------------------------------------------------------------------------------------------
+    // Fixed-size header, written/read field by field
+    struct sCookedMeshHeader
+    {
+        uint32_t m_magic            = COOKED_MESH_MAGIC;
+        uint32_t m_version          = COOKED_MESH_VERSION;
+        uint32_t m_vertexStride     = sizeof(Vertex_PCUTBN);
+        uint32_t m_flags            = 0;
+        uint64_t m_sourceFileSize   = 0;
+        uint32_t m_subMeshCount     = 0;
+        uint32_t m_materialCount    = 0;
+        uint32_t m_vertexCount      = 0;
+        uint32_t m_indexCount       = 0;
+        uint32_t m_vertexDataOffset = 0;
+        uint32_t m_indexDataOffset  = 0;
+    };
+
+    size_t constexpr COOKED_MESH_HEADER_SIZE = 48;
+    size_t constexpr VERTEX_DATA_OFFSET_POS  = 40;    // Byte position of m_vertexDataOffset (patched after metadata)
+    size_t constexpr INDEX_DATA_OFFSET_POS   = 44;
+
+    // Smallest possible metadata records (empty strings): two string lengths + five uint32s, and one
+    // string length + Rgba8. Bound the header counts with these before allocating anything.
+    size_t constexpr COOKED_SUBMESH_MIN_SIZE  = 2 * sizeof(uint32_t) + 5 * sizeof(uint32_t);
+    size_t constexpr COOKED_MATERIAL_MIN_SIZE = sizeof(uint32_t) + 4;
+
+    //------------------------------------------------------------------------------------------------
+    uint64_t GetSourceFileSize(String const& sourcePath)
+    {
+        std::error_code errorCode;
+        uintmax_t const size = std::filesystem::file_size(sourcePath, errorCode);
+        return errorCode ? 0 : static_cast<uint64_t>(size);
+    }
+
+    void AppendPadding(BufferWriter& writer, size_t const alignment)
+    {
+        while (writer.GetTotalSize() % alignment != 0)
+        {
+            writer.AppendByte(0);
+        }
+    }
+
+    // BufferParser only reports overruns, so every variable-length read is bounds-checked first
+    bool ParseCookedString(BufferParser& parser, size_t const limit, String& out_string)
+    {
+        size_t const position = parser.GetCurrentPosition();
+        if (position + sizeof(uint32_t) > limit)
+        {
+            return false;
+        }
+
+        uint32_t const length = parser.ParseUint32();
+        if (position + sizeof(uint32_t) + length > limit)
+        {
+            return false;
+        }
+
+        parser.SetCurrentPosition(position);
+        parser.ParseLengthPrecededString(out_string);
+        return true;
+    }
+
+    bool IsRangeInside(uint64_t const first, uint64_t const count, uint64_t const total)
+    {
+        return first <= total && count <= total - first;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+String ModelCooker::GetCookedPath(String const& sourcePath)
+{
+    return sourcePath + ".cmesh";
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ModelCooker::IsCookedFileCurrent(String const& sourcePath, String const& cookedPath)
+{
+    std::error_code                       errorCode;
+    std::filesystem::file_time_type const cookedTime = std::filesystem::last_write_time(cookedPath, errorCode);
+    if (errorCode)
+    {
+        return false;
+    }
+
+    std::filesystem::file_time_type const sourceTime = std::filesystem::last_write_time(sourcePath, errorCode);
+    if (errorCode)
+    {
+        return true;    // Cooked-only distribution
+    }
+
+    return cookedTime >= sourceTime;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ModelCooker::Cook(ModelResource const& model, String const& cookedPath)
+{
+    // Raw arrays are stored in host byte order and read back as little-endian
+    if (GetPlatformLocalEndian() != eEndianMode::LITTLE || model.m_subMeshes.empty())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(COOKED_MESH_HEADER_SIZE + model.m_vertexView.size_bytes() + model.m_indexView.size_bytes() + 4096);
+
+    BufferWriter writer(buffer);
+    writer.SetEndianMode(eEndianMode::LITTLE);
+
+    sCookedMeshHeader header;
+    header.m_flags          = (model.m_hasNormals ? COOKED_MESH_HAS_NORMALS : 0u) | (model.m_hasUVs ? COOKED_MESH_HAS_UVS : 0u);
+    header.m_sourceFileSize = GetSourceFileSize(model.m_path);
+    header.m_subMeshCount   = static_cast<uint32_t>(model.m_subMeshes.size());
+    header.m_materialCount  = static_cast<uint32_t>(model.m_materials.size());
+    header.m_vertexCount    = static_cast<uint32_t>(model.m_vertexView.size());
+    header.m_indexCount     = static_cast<uint32_t>(model.m_indexView.size());
+
+    writer.AppendUint32(header.m_magic);
+    writer.AppendUint32(header.m_version);
+    writer.AppendUint32(header.m_vertexStride);
+    writer.AppendUint32(header.m_flags);
+    writer.AppendUint64(header.m_sourceFileSize);
+    writer.AppendUint32(header.m_subMeshCount);
+    writer.AppendUint32(header.m_materialCount);
+    writer.AppendUint32(header.m_vertexCount);
+    writer.AppendUint32(header.m_indexCount);
+    writer.AppendUint32(0);     // m_vertexDataOffset
+    writer.AppendUint32(0);     // m_indexDataOffset
+
+    // Submesh ranges are recovered from the views' positions inside the model arrays
+    for (ModelResource::SubMesh const& subMesh : model.m_subMeshes)
+    {
+        writer.AppendLengthPrecededString(subMesh.name);
+        writer.AppendLengthPrecededString(subMesh.materialName);
+        writer.AppendUint32(static_cast<uint32_t>(subMesh.vertices.data() - model.m_vertexView.data()));
+        writer.AppendUint32(static_cast<uint32_t>(subMesh.vertices.size()));
+        writer.AppendUint32(static_cast<uint32_t>(subMesh.indices.data() - model.m_indexView.data()));
+        writer.AppendUint32(static_cast<uint32_t>(subMesh.indices.size()));
+        writer.AppendUint32((subMesh.hasNormals ? COOKED_MESH_HAS_NORMALS : 0u) | (subMesh.hasUVs ? COOKED_MESH_HAS_UVS : 0u));
+    }
+
+    for (auto const& [materialName, color] : model.m_materials)
+    {
+        writer.AppendLengthPrecededString(materialName);
+        writer.AppendRgba8(color);
+    }
+
+    AppendPadding(writer, COOKED_MESH_ARRAY_ALIGNMENT);
+    size_t const vertexDataOffset = writer.GetTotalSize();
+    writer.AppendBytes(model.m_vertexView.data(), model.m_vertexView.size_bytes());
+
+    AppendPadding(writer, COOKED_MESH_ARRAY_ALIGNMENT);
+    size_t const indexDataOffset = writer.GetTotalSize();
+    writer.AppendBytes(model.m_indexView.data(), model.m_indexView.size_bytes());
+
+    if (writer.GetTotalSize() > (std::numeric_limits<uint32_t>::max)())
+    {
+        return false;
+    }
+
+    writer.OverwriteUint32(VERTEX_DATA_OFFSET_POS, static_cast<uint32_t>(vertexDataOffset));
+    writer.OverwriteUint32(INDEX_DATA_OFFSET_POS, static_cast<uint32_t>(indexDataOffset));
+
+    // Write-then-rename so a concurrent LoadCooked() never maps a partial file
+    String const tempPath = cookedPath + ".tmp";
+    if (!FileWriteFromBuffer(buffer, tempPath))
+    {
+        return false;
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(tempPath, cookedPath, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(tempPath, errorCode);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ModelCooker::LoadCooked(String const& cookedPath, ModelResource& out_model)
+{
+    if (GetPlatformLocalEndian() != eEndianMode::LITTLE)
+    {
+        return false;
+    }
+
+    MemoryMappedFile cookedFile;
+    if (!cookedFile.Open(cookedPath) || cookedFile.GetSize() < COOKED_MESH_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    uint8_t const* const data = cookedFile.GetData();
+    size_t const         size = cookedFile.GetSize();
+
+    BufferParser parser(data, size);
+    parser.SetEndianMode(eEndianMode::LITTLE);
+
+    sCookedMeshHeader header;
+    header.m_magic            = parser.ParseUint32();
+    header.m_version          = parser.ParseUint32();
+    header.m_vertexStride     = parser.ParseUint32();
+    header.m_flags            = parser.ParseUint32();
+    header.m_sourceFileSize   = parser.ParseUint64();
+    header.m_subMeshCount     = parser.ParseUint32();
+    header.m_materialCount    = parser.ParseUint32();
+    header.m_vertexCount      = parser.ParseUint32();
+    header.m_indexCount       = parser.ParseUint32();
+    header.m_vertexDataOffset = parser.ParseUint32();
+    header.m_indexDataOffset  = parser.ParseUint32();
+
+    if (header.m_magic != COOKED_MESH_MAGIC || header.m_version != COOKED_MESH_VERSION || header.m_vertexStride != sizeof(Vertex_PCUTBN))
+    {
+        DAEMON_LOG(LogResource, eLogVerbosity::Log, Stringf("ModelCooker: '%s' has an outdated format, recooking", cookedPath.c_str()));
+        return false;
+    }
+
+    // Timestamps survive copies and restores; a source size change still invalidates the cooked file
+    uint64_t const sourceFileSize = GetSourceFileSize(out_model.m_path);
+    bool const     isCorrupt      = header.m_vertexDataOffset % COOKED_MESH_ARRAY_ALIGNMENT != 0 || header.m_indexDataOffset % COOKED_MESH_ARRAY_ALIGNMENT != 0
+                               || header.m_vertexDataOffset < COOKED_MESH_HEADER_SIZE
+                               || !IsRangeInside(header.m_vertexDataOffset, static_cast<uint64_t>(header.m_vertexCount) * sizeof(Vertex_PCUTBN), size)
+                               || !IsRangeInside(header.m_indexDataOffset, static_cast<uint64_t>(header.m_indexCount) * sizeof(uint32_t), size);
+    if (isCorrupt || (sourceFileSize != 0 && sourceFileSize != header.m_sourceFileSize))
+    {
+        return false;
+    }
+
+    Vertex_PCUTBN const* const vertexData = reinterpret_cast<Vertex_PCUTBN const*>(data + header.m_vertexDataOffset);
+    unsigned int const* const  indexData  = reinterpret_cast<unsigned int const*>(data + header.m_indexDataOffset);
+
+    // Metadata lives between the header and the vertex array. The counts are untrusted: a forged
+    // header could otherwise request gigabytes of submeshes and material buckets up front.
+    size_t const metadataEnd   = header.m_vertexDataOffset;
+    size_t const metadataBytes = metadataEnd - parser.GetCurrentPosition();
+    if (header.m_subMeshCount > metadataBytes / COOKED_SUBMESH_MIN_SIZE
+        || header.m_materialCount > (metadataBytes - header.m_subMeshCount * COOKED_SUBMESH_MIN_SIZE) / COOKED_MATERIAL_MIN_SIZE)
+    {
+        return false;
+    }
+
+    std::vector<ModelResource::SubMesh>    subMeshes(header.m_subMeshCount);
+    std::unordered_map<std::string, Rgba8> materials;
+
+    for (ModelResource::SubMesh& subMesh : subMeshes)
+    {
+        if (!ParseCookedString(parser, metadataEnd, subMesh.name) || !ParseCookedString(parser, metadataEnd, subMesh.materialName)
+            || parser.GetCurrentPosition() + 5 * sizeof(uint32_t) > metadataEnd)
+        {
+            return false;
+        }
+
+        uint32_t const firstVertex = parser.ParseUint32();
+        uint32_t const vertexCount = parser.ParseUint32();
+        uint32_t const firstIndex  = parser.ParseUint32();
+        uint32_t const indexCount  = parser.ParseUint32();
+        uint32_t const flags       = parser.ParseUint32();
+
+        if (!IsRangeInside(firstVertex, vertexCount, header.m_vertexCount) || !IsRangeInside(firstIndex, indexCount, header.m_indexCount))
+        {
+            return false;
+        }
+
+        subMesh.vertices   = std::span<Vertex_PCUTBN const>(vertexData + firstVertex, vertexCount);
+        subMesh.indices    = std::span<unsigned int const>(indexData + firstIndex, indexCount);
+        subMesh.hasNormals = (flags & COOKED_MESH_HAS_NORMALS) != 0;
+        subMesh.hasUVs     = (flags & COOKED_MESH_HAS_UVS) != 0;
+    }
+
+    materials.reserve(header.m_materialCount);
+    for (uint32_t materialIndex = 0; materialIndex < header.m_materialCount; ++materialIndex)
+    {
+        String materialName;
+        if (!ParseCookedString(parser, metadataEnd, materialName) || parser.GetCurrentPosition() + 4 > metadataEnd)
+        {
+            return false;
+        }
+        materials[materialName] = parser.ParseRgba8();
+    }
+
+    out_model.Unload();
+    out_model.m_subMeshes  = std::move(subMeshes);
+    out_model.m_materials  = std::move(materials);
+    out_model.m_vertexView = std::span<Vertex_PCUTBN const>(vertexData, header.m_vertexCount);
+    out_model.m_indexView  = std::span<unsigned int const>(indexData, header.m_indexCount);
+    out_model.m_hasNormals = (header.m_flags & COOKED_MESH_HAS_NORMALS) != 0;
+    out_model.m_hasUVs     = (header.m_flags & COOKED_MESH_HAS_UVS) != 0;
+    out_model.m_cookedFile = std::move(cookedFile);    // The view moves, its address does not
+    return true;
+}
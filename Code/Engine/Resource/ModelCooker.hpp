@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// ModelCooker.hpp
+//
+// Purpose:
+//   Binary "cooked" form of a ModelResource (submeshes, materials, vertices, indices), written next
+//   to the source model as <source>.cmesh and memory-mapped on later loads.
+//
+// Design Rationale:
+//   - Header and metadata are written with BufferWriter (little-endian) and read with BufferParser;
+//     vertex and index arrays are stored raw, 16-byte aligned, so a load maps the file and points
+//     ModelResource at them in place: no per-vertex parsing, no copy
+//   - The header records a format version and sizeof(Vertex_PCUTBN); any mismatch (or a truncated
+//     file) rejects the cooked file and the caller falls back to the source
+//   - A cooked file is current when it is at least as new as the source and was cooked from a source
+//     of the same size. Without a source (shipping builds) the cooked file is used as-is.
+//   - Cook() writes <cooked>.tmp and renames it, so a reader never maps a half-written file
+//
+// Layout (little-endian):
+//   sCookedMeshHeader
+//   subMeshCount x { name, materialName (length-preceded), firstVertex, vertexCount, firstIndex, indexCount, flags }
+//   materialCount x { name (length-preceded), Rgba8 }
+//   pad to 16, Vertex_PCUTBN[vertexCount]
+//   pad to 16, uint32_t[indexCount]            (submesh indices are relative to the submesh's first vertex)
+//
+// Thread Safety:
+//   - Stateless; safe from any thread for different paths
+//
+// Author: Cooked Mesh Format
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class ModelResource;
+
+//----------------------------------------------------------------------------------------------------
+uint32_t constexpr COOKED_MESH_MAGIC   = 0x48534D43;    // "CMSH"
+uint32_t constexpr COOKED_MESH_VERSION = 2;     // 2: meshes pass through MeshOptimizer (tangents, cache order)
+
+//----------------------------------------------------------------------------------------------------
+class ModelCooker
+{
+public:
+    // Data/Models/Woman/Woman.obj -> Data/Models/Woman/Woman.obj.cmesh
+    static String GetCookedPath(String const& sourcePath);
+
+    // True if cookedPath exists and is not older than sourcePath (or sourcePath does not exist)
+    static bool IsCookedFileCurrent(String const& sourcePath, String const& cookedPath);
+
+    // Serialize a loaded model. Returns false if the model is empty/too large or the write failed.
+    static bool Cook(ModelResource const& model, String const& cookedPath);
+
+    // Map cookedPath and point the model's vertex/index views at it. Returns false (model untouched)
+    // for missing, stale-format or corrupt files.
+    static bool LoadCooked(String const& cookedPath, ModelResource& out_model);
+};
@@ -4,8 +4,12 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Resource/ModelResource.hpp"
+#include "Engine/Resource/MeshOptimizer.hpp"
+#include "Engine/Resource/ModelCooker.hpp"
 #include "Engine/Resource/ObjModelLoader.hpp"
+#include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
 
 ModelResource::ModelResource(String const& path)
     : IResource(path, eResourceType::Model)
@@ -19,20 +23,22 @@ bool ModelResource::Load()
 
     m_state = eResourceState::Loading;
 
-    // 使用 ObjModelLoader 載入
-    bool success = ObjModelLoader::Load(m_path, m_vertices, m_indices, m_hasNormals, m_hasUVs);
+    // 優先使用已烘焙的二進位檔（記憶體映射，不需逐頂點解析）
+    String const cookedPath = ModelCooker::GetCookedPath(m_path);
+    bool         success    = ModelCooker::IsCookedFileCurrent(m_path, cookedPath) && ModelCooker::LoadCooked(cookedPath, *this);
 
-    if (success)
+    if (!success)
     {
-        // 創建單一 SubMesh（為了未來擴展性）
-        SubMesh mainMesh;
-        mainMesh.name       = "main";
-        mainMesh.vertices   = m_vertices;
-        mainMesh.indices    = m_indices;
-        mainMesh.hasNormals = m_hasNormals;
-        mainMesh.hasUVs     = m_hasUVs;
-        m_subMeshes.push_back(mainMesh);
+        success = LoadFromSource();
+
+        if (success && !ModelCooker::Cook(*this, cookedPath))
+        {
+            DAEMON_LOG(LogResource, eLogVerbosity::Warning, Stringf("ModelResource: Failed to write cooked model '%s'", cookedPath.c_str()));
+        }
+    }
 
+    if (success)
+    {
         m_memorySize = CalculateMemorySize();
         m_state      = eResourceState::Loaded;
     }
@@ -44,26 +50,52 @@ bool ModelResource::Load()
     return success;
 }
 
+//----------------------------------------------------------------------------------------------------
+bool ModelResource::LoadFromSource()
+{
+    // 使用 ObjModelLoader 載入
+    if (!ObjModelLoader::Load(m_path, m_vertices, m_indices, m_hasNormals, m_hasUVs))
+    {
+        return false;
+    }
+
+    // 後處理：切線、頂點快取與讀取順序（結果會一併烘焙）
+    sMeshOptimizeReport const report = MeshOptimizer::Optimize(m_vertices, m_indices, m_hasUVs);
+    DAEMON_LOG(LogResource, eLogVerbosity::Log,
+               Stringf("ModelResource: Optimized '%s' in %.1f ms, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+                   m_path.c_str(), report.m_seconds * 1000.0, report.m_before.m_acmr, report.m_after.m_acmr, report.m_before.m_atvr, report.m_after.m_atvr));
+
+    m_vertexView = m_vertices;
+    m_indexView  = m_indices;
+
+    // 創建單一 SubMesh（為了未來擴展性），直接引用整體的頂點和索引
+    SubMesh mainMesh;
+    mainMesh.name       = "main";
+    mainMesh.vertices   = m_vertexView;
+    mainMesh.indices    = m_indexView;
+    mainMesh.hasNormals = m_hasNormals;
+    mainMesh.hasUVs     = m_hasUVs;
+    m_subMeshes.push_back(mainMesh);
+
+    return true;
+}
+
 void ModelResource::Unload()
 {
-    m_vertices.clear();
-    m_indices.clear();
     m_subMeshes.clear();
     m_materials.clear();
+    m_vertexView = {};
+    m_indexView  = {};
+    m_vertices.clear();
+    m_indices.clear();
+    m_cookedFile.Close();
     m_memorySize = 0;
 }
 
 size_t ModelResource::CalculateMemorySize() const
 {
-    size_t totalSize = 0;
-
-    for (const auto& subMesh : m_subMeshes)
-    {
-        totalSize += subMesh.vertices.size() * sizeof(Vertex_PCUTBN);
-        totalSize += subMesh.indices.size() * sizeof(unsigned int);
-    }
-
-    return totalSize;
+    // Submeshes are views into these arrays, so the whole model is counted once
+    return m_vertexView.size_bytes() + m_indexView.size_bytes();
 }
 
 const ModelResource::SubMesh* ModelResource::GetSubMesh(const std::string& name) const
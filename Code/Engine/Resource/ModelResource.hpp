@@ -4,20 +4,24 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include "Engine/Core/MemoryMappedFile.hpp"
 #include "Engine/Resource/IResource.hpp"
 #include "Engine/Renderer/Vertex_PCUTBN.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
+#include <span>
 #include <vector>
 #include <unordered_map>
 
 class ModelResource : public IResource
 {
 public:
+    // Views into the model's vertex / index storage (heap after a source parse, the mapped cooked
+    // file otherwise); valid until Unload(). Indices are relative to the submesh's vertices.
     struct SubMesh
     {
         std::string name;
-        VertexList_PCUTBN vertices;
-        IndexList indices;
+        std::span<Vertex_PCUTBN const> vertices;
+        std::span<unsigned int const> indices;
         std::string materialName;
         bool hasNormals = false;
         bool hasUVs = false;
@@ -30,6 +34,7 @@ public:
         Unload();
     }
 
+    // Uses <path>.cmesh when it is current (see ModelCooker), otherwise parses the source and cooks it
     bool Load() override;
     void Unload() override;
     size_t CalculateMemorySize() const override;
@@ -39,23 +44,32 @@ public:
      SubMesh const* GetSubMesh( String const& name) const;
 
     // 直接取得頂點和索引（為了兼容你現有的程式碼）
-     VertexList_PCUTBN const& GetVertices() const { return m_vertices; }
-     IndexList const& GetIndices() const { return m_indices; }
+     std::span<Vertex_PCUTBN const> GetVertices() const { return m_vertexView; }
+     std::span<unsigned int const> GetIndices() const { return m_indexView; }
     bool HasNormals() const { return m_hasNormals; }
     bool HasUVs() const { return m_hasUVs; }
+    bool IsLoadedFromCookedFile() const { return m_cookedFile.IsOpen(); }
 
     // 材質資訊
      std::unordered_map<std::string, Rgba8> const& GetMaterials() const { return m_materials; }
 
 private:
     friend class ObjModelLoader;
+    friend class ModelCooker;
+
+    bool LoadFromSource();
 
     std::vector<SubMesh> m_subMeshes;
     std::unordered_map<std::string, Rgba8> m_materials;
 
     // 為了兼容性，保留整體的頂點和索引列表
-    VertexList_PCUTBN m_vertices;
-    IndexList m_indices;
+    std::span<Vertex_PCUTBN const> m_vertexView;
+    std::span<unsigned int const> m_indexView;
     bool m_hasNormals = false;
     bool m_hasUVs = false;
-};
\ No newline at end of file
+
+    // Backing storage for the views: exactly one is in use
+    VertexList_PCUTBN m_vertices;       // Parsed from source
+    IndexList m_indices;
+    MemoryMappedFile m_cookedFile;      // Cooked file, used in place
+};
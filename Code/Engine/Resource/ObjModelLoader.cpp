@@ -4,11 +4,17 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Resource/ObjModelLoader.hpp"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
 #include <filesystem>
-#include <sstream>
 
+#include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/ParallelFor.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/Time.hpp"
 #include "Engine/Renderer/Vertex_PCUTBN.hpp"
@@ -17,213 +23,680 @@
 #include "Engine/Resource/ModelResource.hpp"
 
 //----------------------------------------------------------------------------------------------------
-bool ObjModelLoader::Load(String const&      fileName,
-                          VertexList_PCUTBN& out_vertexes,
-                          IndexList&         out_indexes,
-                          bool&              out_hasNormals,
-                          bool&              out_hasUVs,
-                          Mat44 const&       transform /*= Mat44() */) noexcept
+namespace
 {
-    double loadStartTime = GetCurrentTimeSeconds();
+    int32_t constexpr  OBJ_NO_INDEX      = -1;
+    uint32_t constexpr OBJ_NO_VERTEX     = 0xFFFFFFFFu;
+    size_t constexpr   OBJ_MAX_CHUNKS    = 256;
 
-    out_vertexes.clear();
-    out_indexes.clear();
-    out_hasNormals = false;
-    out_hasUVs     = false;
+    //------------------------------------------------------------------------------------------------
+    // Face corner with attribute indices already resolved to 0-based global indices (OBJ_NO_INDEX = absent)
+    struct sObjCorner
+    {
+        int32_t m_position = OBJ_NO_INDEX;
+        int32_t m_uv       = OBJ_NO_INDEX;
+        int32_t m_normal   = OBJ_NO_INDEX;
+    };
 
-    std::string rawObjFile;
-    FileReadToString(rawObjFile, fileName);
+    struct sObjFace
+    {
+        uint32_t m_firstCorner  = 0;
+        uint32_t m_cornerCount  = 0;
+        int32_t  m_materialSlot = -1;   // Index into sObjChunk::m_materialNames, -1 = material active at chunk start
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // One newline-aligned slice of the file. Counts come from the counting pass, offsets are the
+    // prefix sums over earlier chunks (global index of this chunk's first v / vt / vn).
+    struct sObjChunk
+    {
+        char const* m_begin = nullptr;
+        char const* m_end   = nullptr;
+
+        uint32_t m_positionCount  = 0;
+        uint32_t m_uvCount        = 0;
+        uint32_t m_normalCount    = 0;
+        uint32_t m_positionOffset = 0;
+        uint32_t m_uvOffset       = 0;
+        uint32_t m_normalOffset   = 0;
+
+        std::vector<sObjCorner>       m_corners;
+        std::vector<sObjFace>         m_faces;
+        std::vector<std::string_view> m_materialNames;   // usemtl, in file order
+        std::vector<std::string_view> m_materialLibs;    // mtllib, in file order
+        size_t                        m_skippedFaces = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    enum class eObjKeyword : uint8_t
+    {
+        None,
+        Position,
+        UV,
+        Normal,
+        Face,
+        MaterialLib,
+        UseMaterial
+    };
+
+    //------------------------------------------------------------------------------------------------
+    inline bool IsObjSpace(char const c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
 
-    // 預先分配記憶體空間以減少重新分配
-    out_vertexes.reserve(10000);
-    out_indexes.reserve(30000);
+    inline void SkipObjSpaces(char const*& cursor, char const* end)
+    {
+        while (cursor < end && IsObjSpace(*cursor))
+        {
+            ++cursor;
+        }
+    }
 
-    std::vector<Vec3>                 vertPositions;
-    std::vector<Vec3>                 normals;
-    std::vector<Vec2>                 textureCoords;
-    std::unordered_map<String, Rgba8> materialMap;
+    // Next whitespace-delimited token on the line (empty at end of line)
+    std::string_view ReadObjToken(char const*& cursor, char const* end)
+    {
+        SkipObjSpaces(cursor, end);
+        char const* const tokenBegin = cursor;
+        while (cursor < end && !IsObjSpace(*cursor))
+        {
+            ++cursor;
+        }
+        return std::string_view(tokenBegin, static_cast<size_t>(cursor - tokenBegin));
+    }
 
-    // 預先分配空間
-    vertPositions.reserve(5000);
-    normals.reserve(5000);
-    textureCoords.reserve(5000);
-    materialMap.reserve(50);
+    // [lineBegin, lineEnd) excludes the '\n'; returns the start of the next line
+    char const* NextObjLine(char const* cursor, char const* end, char const*& out_lineEnd)
+    {
+        char const* const newline = static_cast<char const*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        out_lineEnd               = newline ? newline : end;
+        return newline ? newline + 1 : end;
+    }
 
-    Rgba8* curRgba8   = nullptr;
-    int    numOfFaces = 0;
+    // Reads the keyword of a line and leaves cursor after it. Shared by the counting and parsing
+    // passes, so both classify every line identically.
+    eObjKeyword ReadObjKeyword(char const*& cursor, char const* lineEnd)
+    {
+        std::string_view const keyword = ReadObjToken(cursor, lineEnd);
+
+        if (keyword == "v") return eObjKeyword::Position;
+        if (keyword == "vt") return eObjKeyword::UV;
+        if (keyword == "vn") return eObjKeyword::Normal;
+        if (keyword == "f") return eObjKeyword::Face;
+        if (keyword == "mtllib") return eObjKeyword::MaterialLib;
+        if (keyword == "usemtl") return eObjKeyword::UseMaterial;
+        return eObjKeyword::None;   // Comments, blank lines, o / g / s / l, unknown statements
+    }
 
-    DebuggerPrintf("-------------------------------------\n");
-    DebuggerPrintf("Loaded .obj file %s\n", fileName.c_str());
-    double startTime = GetCurrentTimeSeconds();
+    // Missing or malformed components leave out_value unchanged
+    bool ParseObjFloat(char const*& cursor, char const* end, float& out_value)
+    {
+        SkipObjSpaces(cursor, end);
+        if (cursor < end && *cursor == '+')
+        {
+            ++cursor;   // from_chars rejects a leading '+'
+        }
 
-    // 使用string_view來避免不必要的字串複製
-    std::istringstream stream(rawObjFile);
-    std::string        line;
+        auto const [next, errorCode] = std::from_chars(cursor, end, out_value);
+        if (errorCode != std::errc())
+        {
+            return false;
+        }
+        cursor = next;
+        return true;
+    }
 
-    while (std::getline(stream, line))
+    bool ParseObjInt(char const*& cursor, char const* end, int& out_value)
     {
-        if (line.empty() || line[0] == '#') continue;
-
-        std::istringstream lineStream(line);
-        std::string        prefix;
-        lineStream >> prefix;
+        if (cursor < end && *cursor == '+')
+        {
+            ++cursor;
+        }
 
-        if (prefix == "v")
+        auto const [next, errorCode] = std::from_chars(cursor, end, out_value);
+        if (errorCode != std::errc())
         {
-            float x, y, z;
-            lineStream >> x >> y >> z;
-            vertPositions.emplace_back(x, y, z);
+            return false;
         }
-        else if (prefix == "vn")
+        cursor = next;
+        return true;
+    }
+
+    // OBJ indices are 1-based; negative indices count back from the last element defined so far
+    bool ResolveObjIndex(int const rawIndex, uint32_t const definedBefore, uint32_t const totalCount, int32_t& out_index)
+    {
+        int64_t const index = rawIndex > 0 ? static_cast<int64_t>(rawIndex) - 1
+                                           : static_cast<int64_t>(definedBefore) + rawIndex;
+        if (rawIndex == 0 || index < 0 || index >= static_cast<int64_t>(totalCount))
         {
-            float x, y, z;
-            lineStream >> x >> y >> z;
-            normals.emplace_back(x, y, z);
+            return false;
         }
-        else if (prefix == "vt")
+        out_index = static_cast<int32_t>(index);
+        return true;
+    }
+
+    Vec3 ParseObjVec3(char const* cursor, char const* lineEnd)
+    {
+        Vec3 value;
+        ParseObjFloat(cursor, lineEnd, value.x);
+        ParseObjFloat(cursor, lineEnd, value.y);
+        ParseObjFloat(cursor, lineEnd, value.z);
+        return value;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Pass 1: count v / vt / vn lines so every chunk knows its global attribute offsets
+    void CountObjChunk(sObjChunk& chunk)
+    {
+        char const* cursor = chunk.m_begin;
+        while (cursor < chunk.m_end)
         {
-            float u, v;
-            lineStream >> u >> v;
-            textureCoords.emplace_back(u, v);
+            char const*       lineEnd   = nullptr;
+            char const* const nextLine  = NextObjLine(cursor, chunk.m_end, lineEnd);
+            eObjKeyword const keyword   = ReadObjKeyword(cursor, lineEnd);
+
+            chunk.m_positionCount += keyword == eObjKeyword::Position ? 1u : 0u;
+            chunk.m_uvCount += keyword == eObjKeyword::UV ? 1u : 0u;
+            chunk.m_normalCount += keyword == eObjKeyword::Normal ? 1u : 0u;
+
+            cursor = nextLine;
         }
-        else if (prefix == "f")
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Pass 2: tokenize the chunk. Attributes are written in place into the shared arrays at the
+    // chunk's offsets; faces are stored as resolved corners for the serial merge.
+    void ParseObjChunk(sObjChunk&         chunk,
+                       std::vector<Vec3>& positions,
+                       std::vector<Vec2>& uvs,
+                       std::vector<Vec3>& normals)
+    {
+        uint32_t positionIndex = chunk.m_positionOffset;
+        uint32_t uvIndex       = chunk.m_uvOffset;
+        uint32_t normalIndex   = chunk.m_normalOffset;
+
+        uint32_t const positionTotal = static_cast<uint32_t>(positions.size());
+        uint32_t const uvTotal       = static_cast<uint32_t>(uvs.size());
+        uint32_t const normalTotal   = static_cast<uint32_t>(normals.size());
+
+        char const* cursor = chunk.m_begin;
+        while (cursor < chunk.m_end)
         {
-            numOfFaces++;
-            std::vector<std::string> faceVertices;
-            std::string              vertex;
+            char const*       lineEnd  = nullptr;
+            char const* const nextLine = NextObjLine(cursor, chunk.m_end, lineEnd);
 
-            while (lineStream >> vertex)
+            switch (ReadObjKeyword(cursor, lineEnd))
             {
-                faceVertices.push_back(vertex);
-            }
+            case eObjKeyword::Position:
+                positions[positionIndex++] = ParseObjVec3(cursor, lineEnd);
+                break;
 
-            if (faceVertices.size() < 3) continue;
+            case eObjKeyword::Normal:
+                normals[normalIndex++] = ParseObjVec3(cursor, lineEnd);
+                break;
 
-            // 解析頂點的 lambda 函數
-            auto parseVertex = [&](const std::string& vertexStr) -> Vertex_PCUTBN {
-                Vertex_PCUTBN      vert;
-                std::istringstream vertStream(vertexStr);
-                std::string        posIdx, uvIdx, normalIdx;
+            case eObjKeyword::UV:
+            {
+                Vec2 uv;
+                ParseObjFloat(cursor, lineEnd, uv.x);
+                ParseObjFloat(cursor, lineEnd, uv.y);
+                uvs[uvIndex++] = uv;
+                break;
+            }
 
-                std::getline(vertStream, posIdx, '/');
-                std::getline(vertStream, uvIdx, '/');
-                std::getline(vertStream, normalIdx);
+            case eObjKeyword::Face:
+            {
+                sObjFace face;
+                face.m_firstCorner  = static_cast<uint32_t>(chunk.m_corners.size());
+                face.m_materialSlot = static_cast<int32_t>(chunk.m_materialNames.size()) - 1;
 
-                // 位置索引
-                int pos         = std::stoi(posIdx) - 1;
-                vert.m_position = vertPositions[pos];
+                bool isValid = true;
+                for (std::string_view token = ReadObjToken(cursor, lineEnd); !token.empty(); token = ReadObjToken(cursor, lineEnd))
+                {
+                    // v, v/vt, v//vn, v/vt/vn
+                    char const* tokenCursor = token.data();
+                    char const* tokenEnd    = token.data() + token.size();
+                    sObjCorner  corner;
+                    int         rawIndex    = 0;
+
+                    isValid = ParseObjInt(tokenCursor, tokenEnd, rawIndex) && ResolveObjIndex(rawIndex, positionIndex, positionTotal, corner.m_position);
+
+                    if (isValid && tokenCursor < tokenEnd && *tokenCursor == '/')
+                    {
+                        ++tokenCursor;
+                        if (tokenCursor < tokenEnd && *tokenCursor != '/')
+                        {
+                            isValid = ParseObjInt(tokenCursor, tokenEnd, rawIndex) && ResolveObjIndex(rawIndex, uvIndex, uvTotal, corner.m_uv);
+                        }
+                        if (isValid && tokenCursor < tokenEnd && *tokenCursor == '/')
+                        {
+                            ++tokenCursor;
+                            isValid = ParseObjInt(tokenCursor, tokenEnd, rawIndex) && ResolveObjIndex(rawIndex, normalIndex, normalTotal, corner.m_normal);
+                        }
+                    }
+
+                    if (!isValid)
+                    {
+                        break;
+                    }
+                    chunk.m_corners.push_back(corner);
+                }
 
-                // UV座標
-                if (!uvIdx.empty())
+                face.m_cornerCount = static_cast<uint32_t>(chunk.m_corners.size()) - face.m_firstCorner;
+                if (!isValid || face.m_cornerCount < 3)
                 {
-                    out_hasUVs         = true;
-                    int uv             = std::stoi(uvIdx) - 1;
-                    vert.m_uvTexCoords = textureCoords[uv];
+                    chunk.m_skippedFaces += isValid ? 0 : 1;
+                    chunk.m_corners.resize(face.m_firstCorner);
+                    break;
                 }
+                chunk.m_faces.push_back(face);
+                break;
+            }
 
-                // 法線處理
-                if (!normalIdx.empty() && !normals.empty())
+            case eObjKeyword::MaterialLib:
+                for (std::string_view libName = ReadObjToken(cursor, lineEnd); !libName.empty(); libName = ReadObjToken(cursor, lineEnd))
                 {
-                    // OBJ 檔案提供了法線，直接使用
-                    out_hasNormals = true;
-                    int normal     = std::stoi(normalIdx) - 1;
-                    vert.m_normal  = normals[normal];
+                    chunk.m_materialLibs.push_back(libName);
                 }
-                // 如果沒有法線，會在後面計算三角形法線
+                break;
 
-                // 顏色
-                vert.m_color = curRgba8 ? *curRgba8 : Rgba8::WHITE;
+            case eObjKeyword::UseMaterial:
+                chunk.m_materialNames.push_back(ReadObjToken(cursor, lineEnd));
+                break;
 
-                return vert;
-            };
+            case eObjKeyword::None:
+                break;
+            }
 
-            // 三角化多邊形（扇形三角化）
-            Vertex_PCUTBN firstVert = parseVertex(faceVertices[0]);
+            cursor = nextLine;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Identity of an output vertex. Corners with equal keys share one vertex.
+    struct sObjVertexKey
+    {
+        int32_t  m_position = OBJ_NO_INDEX;
+        int32_t  m_uv       = OBJ_NO_INDEX;
+        int32_t  m_normal   = OBJ_NO_INDEX;
+        uint32_t m_color    = 0;
+    };
+
+    uint32_t PackObjColor(Rgba8 const& color)
+    {
+        return static_cast<uint32_t>(color.r) | (static_cast<uint32_t>(color.g) << 8) | (static_cast<uint32_t>(color.b) << 16) | (static_cast<uint32_t>(color.a) << 24);
+    }
 
-            for (size_t i = 1; i < faceVertices.size() - 1; ++i)
+    //------------------------------------------------------------------------------------------------
+    // Vertex deduplication. Candidates are chained per position index (head per position, next per
+    // vertex), so a lookup compares only the handful of vertices that share the corner's position;
+    // no hashing and no per-entry allocation.
+    class ObjVertexBuilder
+    {
+    public:
+        ObjVertexBuilder(std::vector<Vec3> const& positions,
+                         std::vector<Vec2> const& uvs,
+                         std::vector<Vec3> const& normals,
+                         VertexList_PCUTBN&       out_vertexes,
+                         bool const               isDeduplicating)
+            : m_positions(positions)
+            , m_uvs(uvs)
+            , m_normals(normals)
+            , m_vertexes(out_vertexes)
+            , m_isDeduplicating(isDeduplicating)
+        {
+            if (m_isDeduplicating)
             {
-                Vertex_PCUTBN vert1 = parseVertex(faceVertices[i]);
-                Vertex_PCUTBN vert2 = parseVertex(faceVertices[i + 1]);
+                m_chainHeads.assign(positions.size(), OBJ_NO_VERTEX);
+            }
+        }
 
-                // **重要：如果沒有法線資料，計算三角形法線**
-                if (normals.empty())
+        unsigned int GetOrAddVertex(sObjCorner const& corner, Rgba8 const& color)
+        {
+            sObjVertexKey const key = {corner.m_position, corner.m_uv, corner.m_normal, PackObjColor(color)};
+
+            if (m_isDeduplicating)
+            {
+                for (uint32_t candidate = m_chainHeads[key.m_position]; candidate != OBJ_NO_VERTEX; candidate = m_chainNext[candidate])
                 {
-                    // 計算三角形的兩個邊向量
-                    Vec3 edge1 = vert1.m_position - firstVert.m_position;
-                    Vec3 edge2 = vert2.m_position - firstVert.m_position;
+                    sObjVertexKey const& candidateKey = m_keys[candidate];
+                    if (candidateKey.m_uv == key.m_uv && candidateKey.m_normal == key.m_normal && candidateKey.m_color == key.m_color)
+                    {
+                        return candidate;
+                    }
+                }
+            }
 
-                    // 使用叉積計算法線（右手座標系）
-                    Vec3 triangleNormal = CrossProduct3D(edge1, edge2).GetNormalized();
+            uint32_t const vertexIndex = static_cast<uint32_t>(m_vertexes.size());
 
-                    // 將計算出的法線指派給三個頂點
-                    firstVert.m_normal = triangleNormal;
-                    vert1.m_normal     = triangleNormal;
-                    vert2.m_normal     = triangleNormal;
+            Vertex_PCUTBN vertex;
+            vertex.m_position = m_positions[key.m_position];
+            vertex.m_color    = color;
+            if (key.m_uv != OBJ_NO_INDEX)
+            {
+                vertex.m_uvTexCoords = m_uvs[key.m_uv];
+            }
+            if (key.m_normal != OBJ_NO_INDEX)
+            {
+                vertex.m_normal = m_normals[key.m_normal];
+            }
+            m_vertexes.push_back(vertex);
+            m_keys.push_back(key);
 
-                    out_hasNormals = true;
-                }
+            if (m_isDeduplicating)
+            {
+                m_chainNext.push_back(m_chainHeads[key.m_position]);
+                m_chainHeads[key.m_position] = vertexIndex;
+            }
 
-                // 添加三角形
-                out_indexes.push_back(static_cast<unsigned int>(out_vertexes.size()));
-                out_vertexes.push_back(firstVert);
-                out_indexes.push_back(static_cast<unsigned int>(out_vertexes.size()));
-                out_vertexes.push_back(vert1);
-                out_indexes.push_back(static_cast<unsigned int>(out_vertexes.size()));
-                out_vertexes.push_back(vert2);
+            return vertexIndex;
+        }
+
+        // Key of every emitted vertex, in vertex order (per-position normal smoothing reads m_position)
+        std::vector<sObjVertexKey> const& GetKeys() const { return m_keys; }
+
+    private:
+        std::vector<Vec3> const&   m_positions;
+        std::vector<Vec2> const&   m_uvs;
+        std::vector<Vec3> const&   m_normals;
+        VertexList_PCUTBN&         m_vertexes;
+        bool                       m_isDeduplicating = true;
+        std::vector<uint32_t>      m_chainHeads;   // Per position: most recent vertex using it
+        std::vector<uint32_t>      m_chainNext;    // Per vertex: previous vertex with the same position
+        std::vector<sObjVertexKey> m_keys;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Split at newlines into roughly chunkBytes-sized slices
+    std::vector<sObjChunk> SplitObjChunks(std::string_view const text, size_t const chunkCount)
+    {
+        std::vector<sObjChunk> chunks(chunkCount);
+        char const* const      begin  = text.data();
+        char const* const      end    = text.data() + text.size();
+        char const*            cursor = begin;
+
+        for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            char const* chunkEnd = end;
+            if (chunkIndex + 1 < chunkCount)
+            {
+                char const* const nominalEnd = (std::max)(cursor, begin + text.size() * (chunkIndex + 1) / chunkCount);
+                char const*       lineEnd    = nullptr;
+                chunkEnd                     = nominalEnd < end ? NextObjLine(nominalEnd, end, lineEnd) : end;
             }
+            chunks[chunkIndex].m_begin = cursor;
+            chunks[chunkIndex].m_end   = chunkEnd;
+            cursor                     = chunkEnd;
+        }
+        return chunks;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // For each position, the index of the first position with the same value, so smoothing welds
+    // duplicated "v" lines like the old Vec3Hasher map did (+0 and -0 are the same value).
+    // Open addressing over position indices: no per-entry allocation, one probe in the common case.
+    std::vector<uint32_t> BuildObjPositionWelds(std::vector<Vec3> const& positions)
+    {
+        auto const hashComponent = [](float const value)
+        {
+            return std::bit_cast<uint32_t>(value + 0.0f);   // -0 + 0 = +0
+        };
+
+        size_t tableSize = 16;
+        while (tableSize < positions.size() * 2)
+        {
+            tableSize *= 2;
         }
-        else if (prefix == "mtllib")
+        size_t const          tableMask = tableSize - 1;
+        std::vector<uint32_t> table(tableSize, OBJ_NO_VERTEX);
+        std::vector<uint32_t> welds(positions.size());
+
+        for (uint32_t positionIndex = 0; positionIndex < positions.size(); ++positionIndex)
         {
-            std::string mtlFile;
-            lineStream >> mtlFile;
+            Vec3 const& position = positions[positionIndex];
+            uint64_t    hash     = hashComponent(position.x) * 0x9E3779B97F4A7C15ull;
+            hash                 = (hash ^ hashComponent(position.y)) * 0x9E3779B97F4A7C15ull;
+            hash                 = (hash ^ hashComponent(position.z)) * 0x9E3779B97F4A7C15ull;
+
+            for (size_t slot = static_cast<size_t>(hash >> 32) & tableMask;; slot = (slot + 1) & tableMask)
+            {
+                uint32_t const candidate = table[slot];
+                if (candidate == OBJ_NO_VERTEX)
+                {
+                    table[slot]          = positionIndex;
+                    welds[positionIndex] = positionIndex;
+                    break;
+                }
+
+                Vec3 const& candidatePosition = positions[candidate];
+                if (candidatePosition.x == position.x && candidatePosition.y == position.y && candidatePosition.z == position.z)
+                {
+                    welds[positionIndex] = candidate;
+                    break;
+                }
+            }
+        }
 
-            char drive[300], dir[300], fname[300], ext[300];
-            _splitpath_s(fileName.c_str(), drive, 300, dir, 300, fname, 300, ext, 300);
-            std::string materialPath = std::string(drive) + dir + mtlFile;
+        return welds;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Loads every mtllib (in file order) into one name -> color map
+    void LoadObjMaterialLibs(std::vector<sObjChunk> const& chunks, String const& fileName, std::unordered_map<String, Rgba8>& out_materialMap)
+    {
+        std::filesystem::path const objDirectory = std::filesystem::path(fileName).parent_path();
 
-            if (!ObjModelLoader::LoadMaterial(materialPath, materialMap))
+        for (sObjChunk const& chunk : chunks)
+        {
+            for (std::string_view const libName : chunk.m_materialLibs)
             {
-                return false;
+                std::unordered_map<String, Rgba8> libMaterials;
+                String const                      materialPath = (objDirectory / std::filesystem::path(libName)).string();
+                ObjModelLoader::LoadMaterial(materialPath, libMaterials);
+
+                for (auto const& [name, color] : libMaterials)
+                {
+                    out_materialMap[name] = color;
+                }
             }
         }
-        else if (prefix == "usemtl")
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ObjModelLoader::Load(String const&          fileName,
+                          VertexList_PCUTBN&     out_vertexes,
+                          IndexList&             out_indexes,
+                          bool&                  out_hasNormals,
+                          bool&                  out_hasUVs,
+                          Mat44 const&           transform /*= Mat44() */,
+                          sObjLoadOptions const& options /*= sObjLoadOptions() */,
+                          sObjLoadStats*         out_stats /*= nullptr */) noexcept
+{
+    double const loadStartTime = GetCurrentTimeSeconds();
+
+    std::vector<uint8_t> rawObjFile;
+    if (!FileReadToBuffer(rawObjFile, fileName))
+    {
+        out_vertexes.clear();
+        out_indexes.clear();
+        out_hasNormals = false;
+        out_hasUVs     = false;
+        DAEMON_LOG(LogResource, eLogVerbosity::Warning, Stringf("ObjModelLoader: Failed to read '%s'", fileName.c_str()));
+        return false;
+    }
+
+    DebuggerPrintf("-------------------------------------\n");
+    DebuggerPrintf("Loaded .obj file %s (read time: %fs)\n", fileName.c_str(), GetCurrentTimeSeconds() - loadStartTime);
+
+    std::string_view const objText(reinterpret_cast<char const*>(rawObjFile.data()), rawObjFile.size());
+    return LoadFromBuffer(objText, fileName, out_vertexes, out_indexes, out_hasNormals, out_hasUVs, transform, options, out_stats);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ObjModelLoader::LoadFromBuffer(std::string_view const objText,
+                                    String const&          fileName,
+                                    VertexList_PCUTBN&     out_vertexes,
+                                    IndexList&             out_indexes,
+                                    bool&                  out_hasNormals,
+                                    bool&                  out_hasUVs,
+                                    Mat44 const&           transform /*= Mat44() */,
+                                    sObjLoadOptions const& options /*= sObjLoadOptions() */,
+                                    sObjLoadStats*         out_stats /*= nullptr */) noexcept
+{
+    double const startTime = GetCurrentTimeSeconds();
+
+    out_vertexes.clear();
+    out_indexes.clear();
+    out_hasNormals = false;
+    out_hasUVs     = false;
+
+    sObjLoadStats stats;
+    stats.m_fileBytes = objText.size();
+
+    //------------------------------------------------------------------------------------------------
+    // 1. Chunk, count, prefix-sum, parse
+    size_t chunkCount = 1;
+    if (options.m_parseInParallel && options.m_parallelChunkBytes > 0)
+    {
+        chunkCount = std::clamp<size_t>(objText.size() / options.m_parallelChunkBytes, 1, OBJ_MAX_CHUNKS);
+    }
+    std::vector<sObjChunk> chunks = SplitObjChunks(objText, chunkCount);
+    int const              chunkTotal = static_cast<int>(chunks.size());
+
+    ParallelFor(0, chunkTotal, 1, [&](int const chunkBegin, int const chunkEnd)
+    {
+        for (int chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
+        {
+            CountObjChunk(chunks[chunkIndex]);
+        }
+    }, options.m_jobSystem);
+
+    uint32_t positionCount = 0;
+    uint32_t uvCount       = 0;
+    uint32_t normalCount   = 0;
+    for (sObjChunk& chunk : chunks)
+    {
+        chunk.m_positionOffset = positionCount;
+        chunk.m_uvOffset       = uvCount;
+        chunk.m_normalOffset   = normalCount;
+        positionCount += chunk.m_positionCount;
+        uvCount += chunk.m_uvCount;
+        normalCount += chunk.m_normalCount;
+    }
+
+    std::vector<Vec3> vertPositions(positionCount);
+    std::vector<Vec2> textureCoords(uvCount);
+    std::vector<Vec3> normals(normalCount);
+
+    ParallelFor(0, chunkTotal, 1, [&](int const chunkBegin, int const chunkEnd)
+    {
+        for (int chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
         {
-            std::string materialName;
-            lineStream >> materialName;
+            ParseObjChunk(chunks[chunkIndex], vertPositions, textureCoords, normals);
+        }
+    }, options.m_jobSystem);
+
+    double const mergeStartTime = GetCurrentTimeSeconds();
+
+    //------------------------------------------------------------------------------------------------
+    // 2. Merge in file order: resolve materials, fan-triangulate, deduplicate
+    std::unordered_map<String, Rgba8> materialMap;
+    LoadObjMaterialLibs(chunks, fileName, materialMap);
 
-            auto iter = materialMap.find(materialName);
-            curRgba8  = (iter != materialMap.end()) ? &iter->second : nullptr;
+    size_t indexCount = 0;
+    for (sObjChunk const& chunk : chunks)
+    {
+        for (sObjFace const& face : chunk.m_faces)
+        {
+            indexCount += (face.m_cornerCount - 2) * 3;
         }
+        stats.m_faceCount += chunk.m_faces.size();
+        stats.m_skippedFaces += chunk.m_skippedFaces;
     }
+    out_indexes.reserve(indexCount);
+    out_vertexes.reserve(options.m_deduplicateVertices ? (std::max<size_t>)(positionCount, uvCount) : indexCount);
 
-    // 在 Load 函數的最後，變換矩陣應用之前添加：
-    if (normals.empty() && out_hasNormals)
+    bool const        isComputingNormals = normals.empty();
+    std::vector<Vec3> positionNormalSums(isComputingNormals ? vertPositions.size() : 0);
+
+    ObjVertexBuilder builder(vertPositions, textureCoords, normals, out_vertexes, options.m_deduplicateVertices);
+    Rgba8            currentColor = Rgba8::WHITE;
+    std::vector<Rgba8> slotColors;
+
+    for (sObjChunk const& chunk : chunks)
     {
-        // 如果我們計算了法線，進行平滑化處理
-        std::unordered_map<Vec3, std::vector<Vec3>, Vec3Hasher> positionToNormals;
+        slotColors.clear();
+        for (std::string_view const materialName : chunk.m_materialNames)
+        {
+            auto const iter = materialMap.find(String(materialName));
+            slotColors.push_back(iter != materialMap.end() ? iter->second : Rgba8::WHITE);
+        }
 
-        // 收集每個位置的所有法線
-        for (const auto& vertex : out_vertexes)
+        for (sObjFace const& face : chunk.m_faces)
         {
-            positionToNormals[vertex.m_position].push_back(vertex.m_normal);
+            Rgba8 const&      color   = face.m_materialSlot >= 0 ? slotColors[face.m_materialSlot] : currentColor;
+            sObjCorner const* corners = chunk.m_corners.data() + face.m_firstCorner;
+
+            // 三角化多邊形（扇形三角化）
+            for (uint32_t i = 1; i + 1 < face.m_cornerCount; ++i)
+            {
+                sObjCorner const& corner0 = corners[0];
+                sObjCorner const& corner1 = corners[i];
+                sObjCorner const& corner2 = corners[i + 1];
+
+                out_hasUVs     = out_hasUVs || corner0.m_uv != OBJ_NO_INDEX || corner1.m_uv != OBJ_NO_INDEX || corner2.m_uv != OBJ_NO_INDEX;
+                out_hasNormals = out_hasNormals || corner0.m_normal != OBJ_NO_INDEX || corner1.m_normal != OBJ_NO_INDEX || corner2.m_normal != OBJ_NO_INDEX;
+
+                // 如果沒有法線資料，累加三角形法線到每個位置
+                if (isComputingNormals)
+                {
+                    Vec3 const edge1          = vertPositions[corner1.m_position] - vertPositions[corner0.m_position];
+                    Vec3 const edge2          = vertPositions[corner2.m_position] - vertPositions[corner0.m_position];
+                    Vec3 const triangleNormal = CrossProduct3D(edge1, edge2).GetNormalized();
+
+                    positionNormalSums[corner0.m_position] += triangleNormal;
+                    positionNormalSums[corner1.m_position] += triangleNormal;
+                    positionNormalSums[corner2.m_position] += triangleNormal;
+                    out_hasNormals = true;
+                }
+
+                out_indexes.push_back(builder.GetOrAddVertex(corner0, color));
+                out_indexes.push_back(builder.GetOrAddVertex(corner1, color));
+                out_indexes.push_back(builder.GetOrAddVertex(corner2, color));
+            }
+        }
+
+        if (!slotColors.empty())
+        {
+            currentColor = slotColors.back();
         }
+    }
 
-        // 計算每個位置的平均法線
-        std::unordered_map<Vec3, Vec3, Vec3Hasher> positionToAverageNormal;
-        for (const auto& pair : positionToNormals)
+    // 平滑化：每個頂點使用其位置上所有三角形法線的平均
+    // Sums are per position index; fold each into the first index with the same value so coincident
+    // duplicates share one normal (welds[i] <= i, so one forward pass leaves every sum on its root)
+    if (isComputingNormals && out_hasNormals)
+    {
+        std::vector<uint32_t> const welds = BuildObjPositionWelds(vertPositions);
+        for (size_t positionIndex = 0; positionIndex < welds.size(); ++positionIndex)
         {
-            Vec3 sum = Vec3::ZERO;
-            for (const Vec3& normal : pair.second)
+            if (welds[positionIndex] != positionIndex)
             {
-                sum += normal;
+                positionNormalSums[welds[positionIndex]] += positionNormalSums[positionIndex];
             }
-            positionToAverageNormal[pair.first] = sum.GetNormalized();
         }
 
-        // 更新所有頂點的法線
-        for (auto& vertex : out_vertexes)
+        for (size_t positionIndex = 0; positionIndex < welds.size(); ++positionIndex)
+        {
+            uint32_t const root = welds[positionIndex];
+            positionNormalSums[positionIndex] = root == positionIndex ? positionNormalSums[positionIndex].GetNormalized() : positionNormalSums[root];
+        }
+
+        std::vector<sObjVertexKey> const& keys = builder.GetKeys();
+        for (size_t vertexIndex = 0; vertexIndex < out_vertexes.size(); ++vertexIndex)
         {
-            vertex.m_normal = positionToAverageNormal[vertex.m_position];
+            out_vertexes[vertexIndex].m_normal = positionNormalSums[keys[vertexIndex].m_position];
         }
     }
 
@@ -236,81 +709,75 @@ bool ObjModelLoader::Load(String const&      fileName,
         }
     }
 
-    double endTime = GetCurrentTimeSeconds();
-
-    DebuggerPrintf("                            positions: %d  uvs: %d  normals: %d  faces: %d\n",
-                   vertPositions.size(), textureCoords.size(), normals.size(), numOfFaces);
-    DebuggerPrintf("                            vertexes: %d triangles: %d time: %fs\n",
-                   out_vertexes.size(), out_indexes.size() / 3, startTime - loadStartTime);
-    DebuggerPrintf("Created CPU mesh            time: %fs\n", endTime - startTime);
+    double const endTime = GetCurrentTimeSeconds();
+
+    stats.m_positionCount = vertPositions.size();
+    stats.m_uvCount       = textureCoords.size();
+    stats.m_normalCount   = normals.size();
+    stats.m_cornerCount   = out_indexes.size();
+    stats.m_vertexCount   = out_vertexes.size();
+    stats.m_chunkCount    = chunks.size();
+    stats.m_parseSeconds  = mergeStartTime - startTime;
+    stats.m_mergeSeconds  = endTime - mergeStartTime;
+
+    double const totalSeconds = endTime - startTime;
+    DebuggerPrintf("                            positions: %zu  uvs: %zu  normals: %zu  faces: %zu  chunks: %zu\n",
+                   stats.m_positionCount, stats.m_uvCount, stats.m_normalCount, stats.m_faceCount, stats.m_chunkCount);
+    DebuggerPrintf("                            vertexes: %zu triangles: %zu skipped faces: %zu\n",
+                   stats.m_vertexCount, stats.m_cornerCount / 3, stats.m_skippedFaces);
+    DebuggerPrintf("Created CPU mesh            parse: %fs  merge: %fs  (%.1f MB/s)\n",
+                   stats.m_parseSeconds, stats.m_mergeSeconds,
+                   totalSeconds > 0.0 ? static_cast<double>(stats.m_fileBytes) / (1024.0 * 1024.0) / totalSeconds : 0.0);
+
+    if (out_stats)
+    {
+        *out_stats = stats;
+    }
 
     return true;
 }
 
-// 進一步優化版本：使用更快的字串解析
+//----------------------------------------------------------------------------------------------------
 bool ObjModelLoader::LoadMaterial(std::string const& path, std::unordered_map<std::string, Rgba8>& materialMap) noexcept
 {
     materialMap.clear();
 
     std::string rawMtlFile;
     FileReadToString(rawMtlFile, path);
-    //
-    // if (rawMtlFile.empty())
-    // {
-    //     return false;
-    // }
 
-    // 現在可以使用 reserve() 了！
     materialMap.reserve(50);  // 根據預期材質數量調整
 
-    std::string        currentMtlName;
-    std::istringstream stream(rawMtlFile);
-    std::string        line;
+    std::string_view currentMtlName;
+    char const*      cursor = rawMtlFile.data();
+    char const*      end    = rawMtlFile.data() + rawMtlFile.size();
 
-    while (std::getline(stream, line))
+    while (cursor < end)
     {
-        // 跳過空行和註解
-        if (line.empty() || line[0] == '#') continue;
+        char const*       lineEnd  = nullptr;
+        char const* const nextLine = NextObjLine(cursor, end, lineEnd);
 
-        // 移除行尾的空白字符
-        while (!line.empty() && std::isspace(line.back()))
+        std::string_view const keyword = ReadObjToken(cursor, lineEnd);
+        if (keyword == "newmtl")
         {
-            line.pop_back();
-        }
-
-        // 快速檢查前綴
-        if (line.length() >= 6 && line.substr(0, 6) == "newmtl")
-        {
-            // 找到第一個空格後的材質名稱
-            size_t spacePos = line.find(' ');
-            if (spacePos != std::string::npos && spacePos + 1 < line.length())
+            // 材質名稱為該行其餘部分（去除前後空白）
+            SkipObjSpaces(cursor, lineEnd);
+            char const* nameEnd = lineEnd;
+            while (nameEnd > cursor && IsObjSpace(nameEnd[-1]))
             {
-                currentMtlName = line.substr(spacePos + 1);
-                // 移除材質名稱前後的空白
-                currentMtlName.erase(0, currentMtlName.find_first_not_of(" \t"));
-                currentMtlName.erase(currentMtlName.find_last_not_of(" \t") + 1);
+                --nameEnd;
             }
+            currentMtlName = std::string_view(cursor, static_cast<size_t>(nameEnd - cursor));
         }
-        else if (line.length() >= 2 && line.substr(0, 2) == "Kd")
+        else if (keyword == "Kd" && !currentMtlName.empty())
         {
-            if (!currentMtlName.empty())
+            float r = 0.f, g = 0.f, b = 0.f;
+            if (ParseObjFloat(cursor, lineEnd, r) && ParseObjFloat(cursor, lineEnd, g) && ParseObjFloat(cursor, lineEnd, b))
             {
-                // 使用istringstream解析顏色值
-                std::istringstream colorStream(line.substr(2)); // 跳過 "Kd"
-                float              r, g, b;
-
-                if (colorStream >> r >> g >> b)
-                {
-                    // 直接構造Rgba8對象並插入
-                    materialMap[currentMtlName] = Rgba8(
-                        DenormalizeByte(r),
-                        DenormalizeByte(g),
-                        DenormalizeByte(b),
-                        255  // Alpha值
-                    );
-                }
+                materialMap[String(currentMtlName)] = Rgba8(DenormalizeByte(r), DenormalizeByte(g), DenormalizeByte(b), 255);
             }
         }
+
+        cursor = nextLine;
     }
 
     return true;
@@ -1,5 +1,26 @@
 //----------------------------------------------------------------------------------------------------
 // ObjModelLoader.hpp
+//
+// Purpose:
+//   Wavefront .obj (+ .mtl diffuse colors) loader producing an indexed Vertex_PCUTBN mesh.
+//
+// Design Rationale:
+//   - The file is read once into a byte buffer and tokenized in place (string_view + std::from_chars);
+//     no per-line or per-corner string streams, no std::stoi
+//   - Face corners with the same (position, uv, normal, material color) share one output vertex, so
+//     the index buffer references a compact vertex buffer instead of 0..N-1 over one vertex per corner
+//   - Large files are split at line boundaries into chunks parsed in parallel via ParallelFor; a
+//     cheap counting pass gives each chunk its global v/vt/vn offsets, so chunks write straight into
+//     the shared attribute arrays and relative (negative) indices resolve during the parse. The merge
+//     (material resolve, triangulation, deduplication) runs serially in file order, so the output
+//     is identical to a serial parse.
+//   - Files without normals get smooth normals: normalized face normals accumulated per position index
+//
+// Thread Safety:
+//   - Load() is reentrant; it may be called from a job (the calling thread helps ParallelFor)
+//
+// Author: OBJ Loader Tokenizer
+// Date: 2026-10-16
 //----------------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------
@@ -10,6 +31,34 @@
 #include "Engine/Renderer/VertexUtils.hpp"
 #include "Engine/Resource/IResourceLoader.hpp"
 
+//-Forward-Declaration--------------------------------------------------------------------------------
+class JobSystem;
+
+//----------------------------------------------------------------------------------------------------
+struct sObjLoadOptions
+{
+    bool       m_deduplicateVertices = true;              // false = one vertex per face corner (legacy layout)
+    bool       m_parseInParallel     = true;              // Chunked parse on the JobSystem for large files
+    size_t     m_parallelChunkBytes  = 4 * 1024 * 1024;   // Files smaller than this parse serially
+    JobSystem* m_jobSystem           = nullptr;           // nullptr = g_jobSystem
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sObjLoadStats
+{
+    size_t m_fileBytes     = 0;
+    size_t m_positionCount = 0;
+    size_t m_uvCount       = 0;
+    size_t m_normalCount   = 0;
+    size_t m_faceCount     = 0;
+    size_t m_cornerCount   = 0;     // Triangle corners emitted (index count)
+    size_t m_vertexCount   = 0;     // Unique vertices after deduplication
+    size_t m_chunkCount    = 0;
+    size_t m_skippedFaces  = 0;     // Faces with out-of-range indices
+    double m_parseSeconds  = 0.0;   // Tokenize (excluding file read)
+    double m_mergeSeconds  = 0.0;   // Triangulate + deduplicate + normals
+};
+
 //----------------------------------------------------------------------------------------------------
 class ObjModelLoader : public IResourceLoader
 {
@@ -19,12 +68,25 @@ public:
     std::vector<String>        GetSupportedExtensions() const override;
 
     // 保留原有的靜態方法供直接使用或內部使用
-    static bool Load(const String&      fileName,
-                     VertexList_PCUTBN& out_vertexes,
-                     IndexList&         out_indexes,
-                     bool&              out_hasNormals,
-                     bool&              out_hasUVs,
-                     const Mat44&       transform = Mat44()) noexcept;
+    static bool Load(const String&          fileName,
+                     VertexList_PCUTBN&     out_vertexes,
+                     IndexList&             out_indexes,
+                     bool&                  out_hasNormals,
+                     bool&                  out_hasUVs,
+                     const Mat44&           transform = Mat44(),
+                     sObjLoadOptions const& options   = sObjLoadOptions(),
+                     sObjLoadStats*         out_stats = nullptr) noexcept;
+
+    // Parse an in-memory .obj; mtllib paths resolve relative to fileName's directory
+    static bool LoadFromBuffer(std::string_view       objText,
+                               const String&          fileName,
+                               VertexList_PCUTBN&     out_vertexes,
+                               IndexList&             out_indexes,
+                               bool&                  out_hasNormals,
+                               bool&                  out_hasUVs,
+                               const Mat44&           transform = Mat44(),
+                               sObjLoadOptions const& options   = sObjLoadOptions(),
+                               sObjLoadStats*         out_stats = nullptr) noexcept;
 
     static bool LoadMaterial(const String&                      path,
                              std::unordered_map<String, Rgba8>& materialMap) noexcept;
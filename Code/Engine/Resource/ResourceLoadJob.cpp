@@ -14,16 +14,40 @@
 
 #include <variant>
 
+//----------------------------------------------------------------------------------------------------
+// GetCommandPriority
+//
+// Extracts the -100..100 load priority carried by the command payload.
+// Payloads without a priority (unload, monostate) run at JOB_PRIORITY_NORMAL.
+//----------------------------------------------------------------------------------------------------
+static int GetCommandPriority(sResourceCommand const& command)
+{
+	return std::visit(
+	    [](auto const& payload) -> int
+	    {
+		    if constexpr (requires { payload.priority; })
+		    {
+			    return payload.priority;
+		    }
+		    else
+		    {
+			    return JOB_PRIORITY_NORMAL;
+		    }
+	    },
+	    command.data);
+}
+
 //----------------------------------------------------------------------------------------------------
 // Constructor
 //
 // Initializes ResourceLoadJob with command, ResourceSubsystem, and CallbackQueue pointers.
 // Inherits from Job(JOB_TYPE_IO) to ensure execution on I/O worker threads.
+// The command's load priority becomes the job priority, so JobSystem serves critical loads first.
 //----------------------------------------------------------------------------------------------------
 ResourceLoadJob::ResourceLoadJob(sResourceCommand const& command,
                                  ResourceSubsystem* resourceSubsystem,
                                  CallbackQueue* callbackQueue)
-	: Job(JOB_TYPE_IO)  // Designate as I/O job for JobSystem worker thread assignment
+	: Job(JOB_TYPE_IO, GetCommandPriority(command))  // I/O worker assignment, priority lane from payload
 	, m_command(command)
 	, m_resourceSubsystem(resourceSubsystem)
 	, m_callbackQueue(callbackQueue)
@@ -41,8 +65,8 @@ ResourceLoadJob::ResourceLoadJob(sResourceCommand const& command,
 
 	// Log job creation for debugging/profiling
 	DAEMON_LOG(LogResource, eLogVerbosity::Verbose,
-	           Stringf("ResourceLoadJob: Created for command type %d",
-	               static_cast<int>(m_command.type)));
+	           Stringf("ResourceLoadJob: Created for command type %d (priority=%d)",
+	               static_cast<int>(m_command.type), GetPriority()));
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -423,8 +447,11 @@ void ResourceLoadJob::SubmitErrorCallback(uint64_t callbackId, String const& err
 //   - Model loading: Geometry parsed on worker, buffer creation on main thread
 //   - Reason: DirectX requires all GPU resource creation on main thread
 //
+// Priority-Based Execution:
+//   - Payload priority (-100..100) is passed to Job, JobSystem claims higher lanes first
+//   - Starvation protection in JobSystem keeps background prefetches moving under load
+//
 // Future Enhancements:
-//   - Priority-based execution: JobSystem could sort jobs by priority field
 //   - Async flag handling: Separate immediate vs deferred loading paths
 //   - Progress callbacks: Incremental loading updates for large resources
 //   - Retry logic: Automatic retry for transient I/O errors
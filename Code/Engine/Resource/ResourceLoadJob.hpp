@@ -174,7 +174,7 @@ private:
 //   - Eliminates custom worker threads in ResourceSubsystem (~150 lines removed)
 //   - Unified thread pool management (JobSystem handles all I/O workers)
 //   - Automatic work distribution across available I/O workers
-//   - Job prioritization via JobSystem (high-priority resources loaded first)
+//   - Job prioritization via JobSystem (payload priority maps to a JobSystem priority lane)
 //
 // GPU Upload Deferral Strategy:
 //   - Worker thread: Load file data, parse/decompress, store in CPU memory
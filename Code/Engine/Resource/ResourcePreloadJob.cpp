@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------------------------------
+// ResourcePreloadJob.cpp
+// Resource Preloading - JobSystem Integration
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Resource/ResourcePreloadJob.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Resource/ResourceSubsystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+sResourcePreloadProgress::sResourcePreloadProgress(int const totalCount)
+	: m_totalCount(totalCount)
+	, m_startTime(std::chrono::steady_clock::now())
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sResourcePreloadProgress::ReportPathFinished(bool const isLoaded)
+{
+	std::atomic<int>& counter = isLoaded ? m_loadedCount : m_failedCount;
+	counter.fetch_add(1, std::memory_order_acq_rel);
+
+	if (!IsComplete())
+	{
+		return false;
+	}
+
+	// Last path: stamp the finish time, then wake Wait() (under the mutex so a waiter cannot miss it)
+	int64_t    expected       = 0;
+	bool const isLastFinisher = m_finishTicks.compare_exchange_strong(expected, std::chrono::steady_clock::now().time_since_epoch().count());
+	{
+		std::lock_guard<std::mutex> lock(m_completionMutex);
+	}
+	m_completionCondition.notify_all();
+
+	return isLastFinisher;
+}
+
+//----------------------------------------------------------------------------------------------------
+double sResourcePreloadProgress::GetElapsedSeconds() const
+{
+	int64_t const finishTicks = m_finishTicks.load(std::memory_order_acquire);
+	auto const    endTime     = finishTicks != 0 ? std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(finishTicks))
+	                                             : std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(endTime - m_startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+double sResourcePreloadProgress::GetPathsPerSecond() const
+{
+	double const elapsedSeconds = GetElapsedSeconds();
+	return elapsedSeconds > 0.0 ? static_cast<double>(GetFinishedCount()) / elapsedSeconds : 0.0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void sResourcePreloadProgress::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_completionMutex);
+	m_completionCondition.wait(lock, [this]() { return IsComplete(); });
+}
+
+//----------------------------------------------------------------------------------------------------
+// ResourcePreloadJob
+//----------------------------------------------------------------------------------------------------
+ResourcePreloadJob::ResourcePreloadJob(std::vector<String>                       paths,
+                                       ResourceSubsystem*                        resourceSubsystem,
+                                       std::shared_ptr<sResourcePreloadProgress> progress,
+                                       int const                                 priority)
+	: Job(JOB_TYPE_IO, priority)
+	, m_paths(std::move(paths))
+	, m_resourceSubsystem(resourceSubsystem)
+	, m_progress(std::move(progress))
+{
+	if (!m_resourceSubsystem || !m_progress)
+	{
+		ERROR_AND_DIE("ResourcePreloadJob: ResourceSubsystem or progress pointer is null");
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+ResourcePreloadJob::~ResourcePreloadJob()
+{
+	// Never ran (JobSystem shut down first): Wait() must still return
+	for (; m_reportedPathCount < m_paths.size(); ++m_reportedPathCount)
+	{
+		m_progress->ReportPathFinished(false);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+void ResourcePreloadJob::Execute()
+{
+	for (String const& path : m_paths)
+	{
+		bool isLoaded = false;
+		try
+		{
+			isLoaded = m_resourceSubsystem->PreloadResource(path);
+		}
+		catch (std::exception const& e)
+		{
+			DAEMON_LOG(LogResource, eLogVerbosity::Warning,
+			           Stringf("ResourcePreloadJob: Exception while loading '%s': %s", path.c_str(), e.what()));
+		}
+		catch (...)
+		{
+			DAEMON_LOG(LogResource, eLogVerbosity::Warning,
+			           Stringf("ResourcePreloadJob: Unknown exception while loading '%s'", path.c_str()));
+		}
+
+		++m_reportedPathCount;
+		if (m_progress->ReportPathFinished(isLoaded))
+		{
+			DAEMON_LOG(LogResource, eLogVerbosity::Log,
+			           Stringf("ResourcePreloadJob: Preloaded %d resources (%d failed) in %.1f ms (%.0f/s)",
+			               m_progress->m_totalCount, m_progress->m_failedCount.load(),
+			               m_progress->GetElapsedSeconds() * 1000.0, m_progress->GetPathsPerSecond()));
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// ResourceAsyncLoadJob
+//----------------------------------------------------------------------------------------------------
+ResourceAsyncLoadJob::ResourceAsyncLoadJob(std::function<void()> load, int const priority)
+	: Job(JOB_TYPE_IO, priority)
+	, m_load(std::move(load))
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void ResourceAsyncLoadJob::Execute()
+{
+	// The closure owns error reporting (LoadResourceAsync forwards exceptions through its promise)
+	m_load();
+}
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------------------------
+// ResourcePreloadJob.hpp
+// Resource Preloading - JobSystem Integration
+//
+// Purpose:
+//   I/O jobs behind ResourceSubsystem::PreloadResources / PreloadResourcesAsync / LoadResourceAsync.
+//   Replaces the std::async(std::launch::async) thread-per-path implementation.
+//
+// Design Rationale:
+//   - Inherits from Job with JOB_TYPE_IO, so concurrency is bounded by the I/O worker count
+//     (sJobSubsystemConfig::m_ioThreadNum) instead of one OS thread per path
+//   - Paths are batched (sResourceSubsystemConfig::m_preloadBatchSize per job) so a 2,000 asset
+//     preload is a few hundred jobs, not 2,000 threads
+//   - Loads go through ResourceSubsystem::LoadResource semantics (cache + single-flight), so
+//     preloaded resources land in the cache and duplicate paths load once
+//   - Progress is a shared sResourcePreloadProgress the caller can poll or Wait() on; the job
+//     that finishes the last path logs the batch throughput
+//   - Fire-and-forget (SetDeleteOnCompletion): jobs never reach RetrieveCompletedJob()
+//   - A job deleted before it ran reports its paths as failed, so progress always completes
+//
+// Thread Safety:
+//   - Job creation / submission: any thread
+//   - Execute(): I/O worker threads only
+//   - sResourcePreloadProgress: counters are atomic, Wait() is safe from any thread
+//
+// Author: Resource Preloading - JobSystem Integration
+// Date: 2026-10-15
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations
+class ResourceSubsystem;
+
+//----------------------------------------------------------------------------------------------------
+// sResourcePreloadProgress
+//
+// Shared by every ResourcePreloadJob of one preload request. Poll from the main thread
+// (loading screen) or block with Wait().
+//----------------------------------------------------------------------------------------------------
+struct sResourcePreloadProgress
+{
+	explicit sResourcePreloadProgress(int totalCount);
+
+	// Called by ResourcePreloadJob after each path (worker threads); true for the call that finished the last path
+	bool ReportPathFinished(bool isLoaded);
+
+	bool   IsComplete() const { return GetFinishedCount() >= m_totalCount; }
+	int    GetFinishedCount() const { return m_loadedCount.load(std::memory_order_acquire) + m_failedCount.load(std::memory_order_acquire); }
+	float  GetFraction() const { return m_totalCount > 0 ? static_cast<float>(GetFinishedCount()) / static_cast<float>(m_totalCount) : 1.f; }
+	double GetElapsedSeconds() const;
+	double GetPathsPerSecond() const;
+
+	// Block until every path has finished (loaded or failed)
+	void Wait();
+
+	int const                                   m_totalCount;
+	std::atomic<int>                            m_loadedCount = 0;
+	std::atomic<int>                            m_failedCount = 0;
+	std::chrono::steady_clock::time_point const m_startTime;
+	std::atomic<int64_t>                        m_finishTicks = 0;  // steady_clock ticks when the last path finished
+
+private:
+	std::mutex              m_completionMutex;
+	std::condition_variable m_completionCondition;
+};
+
+//----------------------------------------------------------------------------------------------------
+// ResourcePreloadJob
+//
+// Loads one batch of paths into the ResourceSubsystem cache on an I/O worker.
+//
+// Usage (see ResourceSubsystem::PreloadResourcesAsync):
+//   auto progress = std::make_shared<sResourcePreloadProgress>(pathCount);
+//   auto* job     = new ResourcePreloadJob(batchPaths, resourceSubsystem, progress, priority);
+//   job->SetDeleteOnCompletion(true);
+//   jobSystem->SubmitJob(job);
+//----------------------------------------------------------------------------------------------------
+class ResourcePreloadJob : public Job
+{
+public:
+	ResourcePreloadJob(std::vector<String>                       paths,
+	                   ResourceSubsystem*                        resourceSubsystem,
+	                   std::shared_ptr<sResourcePreloadProgress> progress,
+	                   int                                       priority = JOB_PRIORITY_NORMAL);
+	~ResourcePreloadJob() override;   // Reports paths never loaded as failed (job deleted unrun, e.g. JobSystem shutdown)
+
+	// Load every path in the batch; failures are counted, never thrown
+	void Execute() override;
+
+	ResourcePreloadJob(ResourcePreloadJob const&)            = delete;
+	ResourcePreloadJob& operator=(ResourcePreloadJob const&) = delete;
+
+private:
+	std::vector<String>                       m_paths;
+	ResourceSubsystem*                        m_resourceSubsystem = nullptr;
+	std::shared_ptr<sResourcePreloadProgress> m_progress;
+	size_t                                    m_reportedPathCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// ResourceAsyncLoadJob
+//
+// Runs one load closure on an I/O worker. Used by the LoadResourceAsync<T> template, which fulfils
+// its std::promise inside the closure.
+//----------------------------------------------------------------------------------------------------
+class ResourceAsyncLoadJob : public Job
+{
+public:
+	explicit ResourceAsyncLoadJob(std::function<void()> load, int priority = JOB_PRIORITY_NORMAL);
+	~ResourceAsyncLoadJob() override = default;
+
+	void Execute() override;
+
+	ResourceAsyncLoadJob(ResourceAsyncLoadJob const&)            = delete;
+	ResourceAsyncLoadJob& operator=(ResourceAsyncLoadJob const&) = delete;
+
+private:
+	std::function<void()> m_load;
+};
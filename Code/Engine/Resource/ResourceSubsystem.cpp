@@ -4,6 +4,7 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Resource/ResourceSubsystem.hpp"
+#include <algorithm>
 #include <filesystem>
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Rgba8.hpp"
@@ -24,6 +25,7 @@
 // Phase 3: JobSystem Integration
 #include "Engine/Core/JobSystem.hpp"
 #include "Engine/Resource/ResourceLoadJob.hpp"
+#include "Engine/Resource/ResourcePreloadJob.hpp"
 
 #ifdef ENGINE_SCRIPTING_ENABLED
 #include "Engine/Resource/ResourceCommandQueue.hpp"
@@ -84,6 +86,75 @@ std::shared_ptr<IResource> ResourceSubsystem::LoadResourceInternal(String const&
     return nullptr;
 }
 
+//----------------------------------------------------------------------------------------------------
+std::shared_ptr<IResource> ResourceSubsystem::AcquireResource(String const&           cacheKey,
+                                                              ResourceLoadFunc const& load,
+                                                              bool const              isEvictable)
+{
+    // 檢查快取
+    if (std::shared_ptr<IResource> cached = m_cache.Get(cacheKey))
+    {
+        return cached;
+    }
+
+    std::promise<std::shared_ptr<IResource>>       promise;
+    std::shared_future<std::shared_ptr<IResource>> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+
+        auto const inFlight = m_inFlightLoads.find(cacheKey);
+        if (inFlight != m_inFlightLoads.end())
+        {
+            pending = inFlight->second;
+        }
+        else
+        {
+            // The previous loader may have published and left the table since our cache miss
+            // (Peek: that miss is already counted, and this is not a new use of the entry)
+            if (std::shared_ptr<IResource> cached = m_cache.Peek(cacheKey))
+            {
+                return cached;
+            }
+
+            m_inFlightLoads.emplace(cacheKey, promise.get_future().share());
+        }
+    }
+
+    // Another caller is loading cacheKey: wait for its result instead of loading again
+    if (pending.valid())
+    {
+        m_joinedLoadCount.fetch_add(1, std::memory_order_relaxed);
+        return pending.get();
+    }
+
+    // This caller is the loader for cacheKey
+    std::shared_ptr<IResource> resource;
+    try
+    {
+        resource = load();
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        m_inFlightLoads.erase(cacheKey);
+        throw;
+    }
+
+    // Publish to the cache before leaving the table, so later callers find it in one place or the other
+    if (resource)
+    {
+        m_cache.Add(cacheKey, resource, isEvictable);
+    }
+    promise.set_value(resource);
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        m_inFlightLoads.erase(cacheKey);
+    }
+
+    return resource;
+}
+
 std::string ResourceSubsystem::GetFileExtension(String const& path) const
 {
     std::filesystem::path filePath(path);
@@ -94,49 +165,83 @@ std::string ResourceSubsystem::GetFileExtension(String const& path) const
 // Phase 3: WorkerThread() REMOVED - JobSystem now handles worker thread management
 //----------------------------------------------------------------------------------------------------
 
-void ResourceSubsystem::PreloadResources(const std::vector<std::string>& paths)
+bool ResourceSubsystem::PreloadResource(String const& path)
 {
-    // Phase 3: Use JobSystem for async loading instead of custom worker threads
-    if (!m_jobSystem)
+    return AcquireResource(path, [this, &path]() { return LoadResourceInternal(path); }) != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::shared_ptr<sResourcePreloadProgress> ResourceSubsystem::PreloadResourcesAsync(std::vector<String> const& paths, int const priority)
+{
+    auto progress = std::make_shared<sResourcePreloadProgress>(static_cast<int>(paths.size()));
+
+    if (!HasIOWorkers())
     {
-        DebuggerPrintf("Warning: PreloadResources called without JobSystem - loading synchronously\n");
-        for (const auto& path : paths)
-        {
-            LoadResourceInternal(path);
-        }
-        return;
+        DebuggerPrintf("Warning: PreloadResources called without JobSystem I/O workers - loading synchronously\n");
+        ResourcePreloadJob job(paths, this, progress, priority);
+        job.Execute();
+        return progress;
     }
 
-    // Submit jobs to JobSystem for async loading
-    std::vector<std::future<void>> futures;
-    for (const auto& path : paths)
+    // Spread small requests over every I/O worker; cap batches so progress stays fine-grained
+    int const ioWorkerCount = m_jobSystem->GetIOWorkerThreadCount();
+    int const pathCount     = static_cast<int>(paths.size());
+    int const batchSize     = std::clamp((pathCount + ioWorkerCount - 1) / ioWorkerCount, 1, (std::max)(m_config.m_preloadBatchSize, 1));
+
+    std::vector<Job*> jobs;
+    jobs.reserve(static_cast<size_t>((pathCount + batchSize - 1) / batchSize));
+    for (int first = 0; first < pathCount; first += batchSize)
     {
-        // Create a simple lambda-based job for preloading
-        // Note: This uses std::async temporarily until we create a dedicated PreloadJob class
-        futures.push_back(std::async(std::launch::async, [this, path]()
-        {
-            LoadResourceInternal(path);
-        }));
+        int const last = (std::min)(first + batchSize, pathCount);
+        Job*      job  = new ResourcePreloadJob(std::vector<String>(paths.begin() + first, paths.begin() + last), this, progress, priority);
+        job->SetDeleteOnCompletion(true);
+        jobs.push_back(job);
     }
 
-    // Wait for all preload tasks to complete
-    for (auto& f : futures)
+    // The JobSystem may have stopped since HasIOWorkers(): the jobs were not taken, so run them here
+    if (!m_jobSystem->SubmitJobs(jobs))
     {
-        f.get();
+        DebuggerPrintf("Warning: PreloadResources could not submit to the JobSystem - loading synchronously\n");
+        for (Job* job : jobs)
+        {
+            job->Execute();
+            delete job;
+        }
     }
+
+    return progress;
 }
 
-void ResourceSubsystem::UnloadUnusedResources()
+//----------------------------------------------------------------------------------------------------
+void ResourceSubsystem::PreloadResources(const std::vector<std::string>& paths)
 {
-    m_cache.RemoveUnused();
+    PreloadResourcesAsync(paths)->Wait();
+}
 
-    // 檢查記憶體限制
-    if (m_memoryLimit > 0 && GetMemoryUsage() > m_memoryLimit)
+//----------------------------------------------------------------------------------------------------
+void ResourceSubsystem::SubmitAsyncLoad(std::function<void()> load, int const priority)
+{
+    if (!HasIOWorkers())
     {
-        // 實作 LRU 或其他策略來釋放資源
-        // 這裡簡單地移除所有未使用的資源
-        m_cache.RemoveUnused();
+        load();
+        return;
     }
+
+    Job* job = new ResourceAsyncLoadJob(std::move(load), priority);
+    job->SetDeleteOnCompletion(true);
+    m_jobSystem->SubmitJob(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ResourceSubsystem::HasIOWorkers() const
+{
+    return m_jobSystem != nullptr && m_jobSystem->GetIOWorkerThreadCount() > 0;
+}
+
+void ResourceSubsystem::UnloadUnusedResources()
+{
+    // Budget eviction happens in ResourceCache::Add; this drops every unreferenced, unpinned resource
+    m_cache.RemoveUnused();
 }
 
 size_t ResourceSubsystem::GetMemoryUsage() const
@@ -169,7 +274,7 @@ void ResourceSubsystem::Startup()
         {
             RegisterLoader(std::make_unique<ObjModelLoader>());
 
-            auto textureLoader = std::make_unique<TextureLoader>(device);
+            auto textureLoader = std::make_unique<TextureLoader>(device, m_config.m_textureDecodeOptions);
             RegisterLoader(std::move(textureLoader));
             DebuggerPrintf("Info: ResourceSubsystem initialized with TextureLoader.\n");
 
@@ -228,6 +333,9 @@ Texture* ResourceSubsystem::CreateOrGetTextureFromFile(String const& path)
 
         if (textureHandle.IsValid() && textureHandle.Get())
         {
+            // Callers keep the raw pointer, so the cache must never evict this entry
+            m_cache.Pin(path);
+
             TextureResource* textureResource = textureHandle.Get();
             Texture*         rendererTexture = textureResource->GetRendererTexture();
 
@@ -254,6 +362,9 @@ BitmapFont* ResourceSubsystem::CreateOrGetBitmapFontFromFile(String const& path)
 
         if (fontHandle.IsValid() && fontHandle.Get())
         {
+            // Callers keep the raw pointer, so the cache must never evict this entry
+            m_cache.Pin(path);
+
             FontResource* fontResource       = fontHandle.Get();
             BitmapFont*   rendererBitmapFont = fontResource->GetRendererBitmapFont();
 
@@ -281,36 +392,34 @@ Shader* ResourceSubsystem::CreateOrGetShaderFromFile(String const& path, eVertex
 
     try
     {
-        // Check cache first with vertex type in key
-        String cacheKey = path + "_" + std::to_string(static_cast<int>(vertexType));
-        if (std::shared_ptr<IResource> const cached = m_cache.Get(cacheKey))
-        {
-            if (ShaderResource* shaderResource = static_cast<ShaderResource*>(cached.get()))
-            {
-                return shaderResource->GetRendererShader();
-            }
-        }
+        // Cache and single-flight key includes the vertex type
+        String const cacheKey = path + "_" + std::to_string(static_cast<int>(vertexType));
 
-        // Find ShaderLoader and load with vertex type
-        for (std::unique_ptr<IResourceLoader> const& loader : m_loaders)
+        auto const loadShader = [this, &path, vertexType]() -> std::shared_ptr<IResource>
         {
-            if (ShaderLoader* shaderLoader = dynamic_cast<ShaderLoader*>(loader.get()))
+            // Find ShaderLoader and load with vertex type
+            for (std::unique_ptr<IResourceLoader> const& loader : m_loaders)
             {
-                String const ext = GetFileExtension(path);
-                // Allow extensionless paths — ShaderLoader::LoadShader handles .hlsl fallback
-                if (ext.empty() || shaderLoader->CanLoad(ext))
+                if (ShaderLoader* shaderLoader = dynamic_cast<ShaderLoader*>(loader.get()))
                 {
-                    auto shaderResource = shaderLoader->LoadShader(path, vertexType);
-                    if (shaderResource)
+                    String const ext = GetFileExtension(path);
+                    // Allow extensionless paths — ShaderLoader::LoadShader handles .hlsl fallback
+                    if (ext.empty() || shaderLoader->CanLoad(ext))
                     {
-                        m_cache.Add(cacheKey, shaderResource);
-                        if (ShaderResource* shader = static_cast<ShaderResource*>(shaderResource.get()))
-                        {
-                            return shader->GetRendererShader();
-                        }
+                        return shaderLoader->LoadShader(path, vertexType);
                     }
+                    break;
                 }
-                break;
+            }
+            return nullptr;
+        };
+
+        // Raw Shader* is handed out, so the cache entry is pinned (never evicted)
+        if (std::shared_ptr<IResource> const resource = AcquireResource(cacheKey, loadShader, false))
+        {
+            if (ShaderResource* shaderResource = static_cast<ShaderResource*>(resource.get()))
+            {
+                return shaderResource->GetRendererShader();
             }
         }
     }
@@ -424,7 +533,7 @@ void ResourceSubsystem::CreateDefaultTexture()
         defaultTextureRes->SetName("__default_white__");
 
         // Cache as special resource
-        m_cache.Add("__default_white__", defaultTextureRes);
+        m_cache.Add("__default_white__", defaultTextureRes, false);
 
         DebuggerPrintf("[ResourceSubsystem] Created default white texture.\n");
     }
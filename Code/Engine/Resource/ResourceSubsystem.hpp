@@ -4,15 +4,20 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <atomic>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include "Game/EngineBuildPreferences.hpp"  // Phase 3: Required for ENGINE_SCRIPTING_ENABLED
+#include "Engine/Core/Job.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Resource/IResourceLoader.hpp"
 #include "Engine/Resource/ResourceCache.hpp"
 #include "Engine/Resource/ResourceHandle.hpp"
+#include "Engine/Resource/TextureCooker.hpp"
 #include "Engine/Renderer/RenderCommon.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -24,6 +29,7 @@ class Renderer;
 class TextureResource;
 class TextureLoader;
 class JobSystem;
+struct sResourcePreloadProgress;
 
 #ifdef ENGINE_SCRIPTING_ENABLED
 class ResourceCommandQueue;
@@ -33,8 +39,11 @@ class CallbackQueue;
 //----------------------------------------------------------------------------------------------------
 struct sResourceSubsystemConfig
 {
-    Renderer* m_renderer    = nullptr;
-    int       m_threadCount = 0;  // Deprecated: JobSystem now manages worker threads
+    Renderer* m_renderer         = nullptr;
+    int       m_threadCount      = 0;   // Deprecated: JobSystem now manages worker threads
+    int       m_preloadBatchSize = 16;  // Max paths per ResourcePreloadJob (PreloadResources)
+
+    sTextureDecodeOptions m_textureDecodeOptions;  // Mip generation / <source>.ctex cache for TextureLoader
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -50,19 +59,13 @@ public:
     void RegisterLoader(std::unique_ptr<IResourceLoader> loader);
 
     // 同步載入資源
+    // Concurrent calls for the same path share one load: the first caller loads and publishes to
+    // the cache, later callers block on its result instead of reading the file again.
     template <typename T>
     ResourceHandle<T> LoadResource(String const& path)
     {
-        // 檢查快取
-        if (std::shared_ptr<IResource> const cached = m_cache.Get(path))
-        {
-            return ResourceHandle<T>(std::static_pointer_cast<T>(cached));
-        }
-
-        // 載入新資源
-        if (std::shared_ptr<IResource> const resource = LoadResourceInternal(path))
+        if (std::shared_ptr<IResource> const resource = AcquireResource(path, [this, &path]() { return LoadResourceInternal(path); }))
         {
-            m_cache.Add(path, resource);
             return ResourceHandle<T>(std::static_pointer_cast<T>(resource));
         }
 
@@ -70,21 +73,37 @@ public:
     }
 
     // 異步載入資源
-    // Phase 3: Uses std::async temporarily for API compatibility
-    // TODO: Refactor to use JobSystem internally while maintaining std::future return type
+    // Runs on a JobSystem I/O worker (ResourceAsyncLoadJob); loads synchronously when no I/O worker is available
     template <typename T>
-    std::future<ResourceHandle<T>> LoadResourceAsync(String const& path)
+    std::future<ResourceHandle<T>> LoadResourceAsync(String const& path, int priority = JOB_PRIORITY_NORMAL)
     {
-        // Note: std::async creates its own thread, bypassing JobSystem
-        // This is acceptable for now to preserve existing C++ API
-        // JavaScript resource loading uses ResourceCommandQueue → JobSystem path instead
-        return std::async(std::launch::async, [this, path]()
+        auto                           promise = std::make_shared<std::promise<ResourceHandle<T>>>();
+        std::future<ResourceHandle<T>> future  = promise->get_future();
+
+        SubmitAsyncLoad([this, path, promise]()
         {
-            return LoadResource<T>(path);
-        });
+            try
+            {
+                promise->set_value(LoadResource<T>(path));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        }, priority);
+
+        return future;
     }
 
+    // Load one path into the cache without a typed handle. Returns false if the load failed.
+    bool PreloadResource(String const& path);
+
     // 預載入資源列表
+    // Batches paths into ResourcePreloadJobs on the JobSystem I/O workers and returns immediately.
+    // Poll or Wait() on the returned progress; results are in the cache as each path finishes.
+    std::shared_ptr<sResourcePreloadProgress> PreloadResourcesAsync(std::vector<String> const& paths, int priority = JOB_PRIORITY_NORMAL);
+
+    // Blocking form of PreloadResourcesAsync (do not call from an I/O job; it waits on the I/O workers)
     void PreloadResources(std::vector<std::string> const& paths);
 
     // 卸載未使用的資源
@@ -94,8 +113,15 @@ public:
     size_t GetMemoryUsage() const;
     size_t GetResourceCount() const;
 
-    // 設定記憶體限制
-    void SetMemoryLimit(size_t bytes) { m_memoryLimit = bytes; }
+    // 設定記憶體限制 (0 = unlimited). Unreferenced resources are evicted LRU-first when exceeded.
+    void SetMemoryLimit(size_t bytes) { m_cache.SetMemoryBudget(bytes); }
+    void SetTypeMemoryLimit(eResourceType type, size_t bytes) { m_cache.SetTypeMemoryBudget(type, bytes); }
+
+    // Hit/miss/eviction counters and per-type usage for monitoring
+    sResourceCacheStats GetCacheStats() const { return m_cache.GetStats(); }
+
+    // Number of LoadResource calls that joined another thread's in-flight load of the same path
+    uint64_t GetJoinedLoadCount() const { return m_joinedLoadCount.load(std::memory_order_relaxed); }
 
     // Global singleton access methods
     // static void               Initialize(Renderer* renderer, sResourceSubsystemConfig const& config = sResourceSubsystemConfig());
@@ -142,11 +168,26 @@ private:
 
     // 內部載入方法
     std::shared_ptr<IResource> LoadResourceInternal(String const& path);
+
+    // Cache lookup, then single-flight load: only one caller per cacheKey runs load(), the result
+    // is added to the cache once and handed to every caller that arrived while it was loading.
+    // Exceptions thrown by load() propagate to all of those callers.
+    using ResourceLoadFunc = std::function<std::shared_ptr<IResource>()>;
+    std::shared_ptr<IResource> AcquireResource(String const& cacheKey, ResourceLoadFunc const& load, bool isEvictable = true);
+
+    // Run load on an I/O worker as a fire-and-forget ResourceAsyncLoadJob, or inline without one
+    void SubmitAsyncLoad(std::function<void()> load, int priority);
+    bool HasIOWorkers() const;
     String                     GetFileExtension(String const& path) const;
 
     ResourceCache                                 m_cache;
     std::vector<std::unique_ptr<IResourceLoader>> m_loaders;
 
+    // Single-flight table: cache key -> result of the load currently running for it
+    std::mutex                                                                  m_inFlightMutex;
+    std::unordered_map<String, std::shared_future<std::shared_ptr<IResource>>> m_inFlightLoads;
+    std::atomic<uint64_t>                                                       m_joinedLoadCount = 0;
+
     //------------------------------------------------------------------------------------------------
     // Phase 3: JobSystem Integration (replaces custom worker threads)
     //------------------------------------------------------------------------------------------------
@@ -156,7 +197,4 @@ private:
     ResourceCommandQueue* m_commandQueue  = nullptr;  // Command queue from JavaScript
     CallbackQueue*        m_callbackQueue = nullptr;  // Callback queue to JavaScript
 #endif
-
-    // 記憶體管理
-    size_t m_memoryLimit = 0;
 };
@@ -8,17 +8,79 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Resource/IResource.hpp"
 
-void ResourceCache::Add(const std::string& path, ResourcePtr resource)
+//----------------------------------------------------------------------------------------------------
+size_t ResourceCache::GetTypeIndex(eResourceType const type)
+{
+    size_t const index = static_cast<size_t>(type);
+    return index < RESOURCE_TYPE_COUNT ? index : static_cast<size_t>(eResourceType::Unknown);
+}
+
+void ResourceCache::Add(const std::string& path, ResourcePtr resource, bool const isEvictable)
 {
+    // Replaced and evicted resources are released after the lock is dropped
+    std::vector<ResourcePtr> released;
+
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_resources[path] = resource;
+
+    auto existing = m_resources.find(path);
+    if (existing != m_resources.end())
+    {
+        EraseLocked(existing, released);
+    }
+
+    sEntry entry;
+    if (resource)
+    {
+        // Loaders that do not fill m_memorySize still get charged their estimated size
+        entry.m_bytes = resource->GetMemorySize();
+        if (entry.m_bytes == 0)
+        {
+            entry.m_bytes = resource->CalculateMemorySize();
+        }
+        entry.m_type = resource->GetType();
+    }
+    entry.m_resource    = std::move(resource);
+    entry.m_isEvictable = isEvictable;
+
+    auto [it, inserted] = m_resources.emplace(path, std::move(entry));
+    sEntry&      added     = it->second;
+    size_t const typeIndex = GetTypeIndex(added.m_type);
+
+    if (added.m_isEvictable)
+    {
+        added.m_lruIt     = m_lru.insert(m_lru.begin(), &it->first);
+        added.m_typeLruIt = m_typeLru[typeIndex].insert(m_typeLru[typeIndex].begin(), &it->first);
+    }
+
+    m_memoryUsage += added.m_bytes;
+    m_typeMemoryUsage[typeIndex] += added.m_bytes;
+    ++m_typeResourceCount[typeIndex];
+
+    if (!EnforceBudgetsLocked(added.m_type, released))
+    {
+        ++m_overBudgetAdds;
+    }
 }
 
-ResourceCache::ResourcePtr ResourceCache::Get(const std::string& path) const
+ResourceCache::ResourcePtr ResourceCache::Get(const std::string& path)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     auto                        it = m_resources.find(path);
-    return (it != m_resources.end()) ? it->second : nullptr;
+    if (it == m_resources.end())
+    {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    sEntry& entry = it->second;
+    if (entry.m_isEvictable)
+    {
+        m_lru.splice(m_lru.begin(), m_lru, entry.m_lruIt);
+        LruList& typeLru = m_typeLru[GetTypeIndex(entry.m_type)];
+        typeLru.splice(typeLru.begin(), typeLru, entry.m_typeLruIt);
+    }
+    return entry.m_resource;
 }
 
 bool ResourceCache::Contains(const std::string& path) const
@@ -27,10 +89,42 @@ bool ResourceCache::Contains(const std::string& path) const
     return m_resources.find(path) != m_resources.end();
 }
 
+ResourceCache::ResourcePtr ResourceCache::Peek(const std::string& path) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const                  it = m_resources.find(path);
+    return it != m_resources.end() ? it->second.m_resource : nullptr;
+}
+
 void ResourceCache::Remove(const std::string& path)
+{
+    std::vector<ResourcePtr> released;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        it = m_resources.find(path);
+    if (it != m_resources.end())
+    {
+        EraseLocked(it, released);
+    }
+}
+
+bool ResourceCache::Pin(const std::string& path)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_resources.erase(path);
+    auto                        it = m_resources.find(path);
+    if (it == m_resources.end())
+    {
+        return false;
+    }
+
+    sEntry& entry = it->second;
+    if (entry.m_isEvictable)
+    {
+        m_lru.erase(entry.m_lruIt);
+        m_typeLru[GetTypeIndex(entry.m_type)].erase(entry.m_typeLruIt);
+        entry.m_isEvictable = false;
+    }
+    return true;
 }
 
 void ResourceCache::Clear()
@@ -42,14 +136,22 @@ void ResourceCache::Clear()
     // Explicitly unload all resources before clearing
     for (auto& pair : m_resources)
     {
-        if (pair.second)
+        if (pair.second.m_resource)
         {
             DebuggerPrintf("[ResourceCache] Clear: Unloading resource '%s'\n", pair.first.c_str());
-            pair.second->Unload();
+            pair.second.m_resource->Unload();
         }
     }
 
     m_resources.clear();
+    m_lru.clear();
+    for (LruList& typeLru : m_typeLru)
+    {
+        typeLru.clear();
+    }
+    m_memoryUsage = 0;
+    m_typeMemoryUsage.fill(0);
+    m_typeResourceCount.fill(0);
     DebuggerPrintf("[ResourceCache] Clear: Cache cleared\n");
 }
 
@@ -62,21 +164,19 @@ size_t ResourceCache::GetSize() const
 size_t ResourceCache::GetMemoryUsage() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    size_t                      totalMemory = 0;
-
-    for (const auto& [path, resource] : m_resources)
-    {
-        if (resource)
-        {
-            totalMemory += resource->GetMemorySize();
-        }
-    }
+    return m_memoryUsage;
+}
 
-    return totalMemory;
+size_t ResourceCache::GetMemoryUsage(eResourceType const type) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_typeMemoryUsage[GetTypeIndex(type)];
 }
 
 void ResourceCache::RemoveUnused()
 {
+    std::vector<ResourcePtr> released;
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     auto it = m_resources.begin();
@@ -84,9 +184,12 @@ void ResourceCache::RemoveUnused()
     {
         // Use shared_ptr::use_count() to check references
         // use_count() == 1 means only the cache holds a reference (no external users)
-        if (it->second && it->second.use_count() == 1)
+        sEntry const& entry = it->second;
+        if (entry.m_isEvictable && entry.m_resource && entry.m_resource.use_count() == 1)
         {
-            it = m_resources.erase(it);
+            auto const next = std::next(it);
+            EraseLocked(it, released);
+            it = next;
         }
         else
         {
@@ -94,3 +197,133 @@ void ResourceCache::RemoveUnused()
         }
     }
 }
+
+void ResourceCache::SetMemoryBudget(size_t const bytes)
+{
+    std::vector<ResourcePtr> released;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryBudget = bytes;
+    if (m_memoryBudget > 0)
+    {
+        EvictFromListLocked(m_lru, m_memoryUsage, m_memoryBudget, m_lru.size(), released);
+    }
+}
+
+void ResourceCache::SetTypeMemoryBudget(eResourceType const type, size_t const bytes)
+{
+    std::vector<ResourcePtr> released;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t const typeIndex        = GetTypeIndex(type);
+    m_typeMemoryBudget[typeIndex] = bytes;
+    if (bytes > 0)
+    {
+        EvictFromListLocked(m_typeLru[typeIndex], m_typeMemoryUsage[typeIndex], bytes, m_typeLru[typeIndex].size(), released);
+    }
+}
+
+sResourceCacheStats ResourceCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    sResourceCacheStats stats;
+    stats.m_hits              = m_hits;
+    stats.m_misses            = m_misses;
+    stats.m_evictions         = m_evictions;
+    stats.m_evictedBytes      = m_evictedBytes;
+    stats.m_overBudgetAdds    = m_overBudgetAdds;
+    stats.m_resourceCount     = m_resources.size();
+    stats.m_memoryUsage       = m_memoryUsage;
+    stats.m_memoryBudget      = m_memoryBudget;
+    stats.m_typeMemoryUsage   = m_typeMemoryUsage;
+    stats.m_typeMemoryBudget  = m_typeMemoryBudget;
+    stats.m_typeResourceCount = m_typeResourceCount;
+    return stats;
+}
+
+void ResourceCache::ResetStatCounters()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hits           = 0;
+    m_misses         = 0;
+    m_evictions      = 0;
+    m_evictedBytes   = 0;
+    m_overBudgetAdds = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Unlinks the entry and moves its resource into outReleased, so the caller destroys it unlocked
+//----------------------------------------------------------------------------------------------------
+void ResourceCache::EraseLocked(EntryMap::iterator const it, std::vector<ResourcePtr>& outReleased)
+{
+    sEntry&      entry     = it->second;
+    size_t const typeIndex = GetTypeIndex(entry.m_type);
+
+    if (entry.m_isEvictable)
+    {
+        m_lru.erase(entry.m_lruIt);
+        m_typeLru[typeIndex].erase(entry.m_typeLruIt);
+    }
+
+    m_memoryUsage -= entry.m_bytes;
+    m_typeMemoryUsage[typeIndex] -= entry.m_bytes;
+    --m_typeResourceCount[typeIndex];
+
+    outReleased.push_back(std::move(entry.m_resource));
+    m_resources.erase(it);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Type budget first (only evicts that type), then the total budget (evicts any type).
+// Returns false if a budget is still exceeded.
+//----------------------------------------------------------------------------------------------------
+bool ResourceCache::EnforceBudgetsLocked(eResourceType const addedType, std::vector<ResourcePtr>& outReleased)
+{
+    bool         isWithinBudget = true;
+    size_t const typeIndex      = GetTypeIndex(addedType);
+
+    if (m_typeMemoryBudget[typeIndex] > 0)
+    {
+        isWithinBudget = EvictFromListLocked(m_typeLru[typeIndex], m_typeMemoryUsage[typeIndex], m_typeMemoryBudget[typeIndex], MAX_EVICTION_SKIPS_PER_ADD, outReleased);
+    }
+
+    if (m_memoryBudget > 0)
+    {
+        isWithinBudget = EvictFromListLocked(m_lru, m_memoryUsage, m_memoryBudget, MAX_EVICTION_SKIPS_PER_ADD, outReleased) && isWithinBudget;
+    }
+
+    return isWithinBudget;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Evicts from the tail of list until usage <= budget. Entries referenced outside the cache move to
+// the front instead (second chance); after maxSkips of those the call gives up. Budget changes pass
+// the list size, so every entry is examined once.
+//----------------------------------------------------------------------------------------------------
+bool ResourceCache::EvictFromListLocked(LruList&                  list,
+                                        size_t const&             usage,
+                                        size_t const              budget,
+                                        size_t const              maxSkips,
+                                        std::vector<ResourcePtr>& outReleased)
+{
+    size_t skipped = 0;
+
+    while (usage > budget && !list.empty() && skipped < maxSkips)
+    {
+        auto const it = m_resources.find(*list.back());
+
+        if (it->second.m_resource.use_count() > 1)
+        {
+            list.splice(list.begin(), list, std::prev(list.end()));
+            ++skipped;
+            continue;
+        }
+
+        m_evictedBytes += it->second.m_bytes;
+        ++m_evictions;
+        EraseLocked(it, outReleased);
+    }
+
+    return usage <= budget;
+}
@@ -1,33 +1,90 @@
- //----------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------
 // ResourceCache.hpp
+//
+// Purpose:
+//   Path -> resource cache with a memory budget. Unreferenced resources are evicted in LRU order
+//   when the total budget or a per-type budget (textures, models, audio, ...) is exceeded.
+//
+// Design Rationale:
+//   - Byte counters (total and per eResourceType) are updated on Add/Remove/evict, so
+//     GetMemoryUsage() is O(1) instead of a walk over every resource
+//   - Two intrusive LRU lists (global and per type); Get() moves the entry to the front of both
+//   - Eviction pops from the LRU tail; entries still referenced outside the cache
+//     (use_count() > 1) get a second chance and move to the front, CLOCK style. Add() skips at
+//     most MAX_EVICTION_SKIPS_PER_ADD of them, so it stays O(1) even when most resources are in use.
+//   - Pinned entries (Add(..., false) or Pin()) are counted but never evicted. Use this for
+//     resources handed out as raw pointers, since the cache is then their only owner.
+//   - A budget of 0 means unlimited (the default)
+//   - Evicted resources are released after the mutex is dropped
+//
+// Thread Safety:
+//   - All public methods are guarded by one mutex
+//
+// Author: Resource Cache Budgeting
+// Date: 2026-10-15
 //----------------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
-#include <unordered_map>
+#include "Engine/Resource/ResourceCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class IResource;
 
+//----------------------------------------------------------------------------------------------------
+size_t constexpr RESOURCE_TYPE_COUNT = static_cast<size_t>(eResourceType::Animation) + 1;
+
+//----------------------------------------------------------------------------------------------------
+struct sResourceCacheStats
+{
+    uint64_t m_hits           = 0;
+    uint64_t m_misses         = 0;
+    uint64_t m_evictions      = 0;
+    uint64_t m_evictedBytes   = 0;
+    uint64_t m_overBudgetAdds = 0;     // Adds that left a budget exceeded (every candidate referenced or pinned)
+    size_t   m_resourceCount  = 0;
+    size_t   m_memoryUsage    = 0;
+    size_t   m_memoryBudget   = 0;
+
+    // Indexed by eResourceType
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeMemoryUsage   = {};
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeMemoryBudget  = {};
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeResourceCount = {};
+};
+
+//----------------------------------------------------------------------------------------------------
 class ResourceCache
 {
 public:
     using ResourcePtr = std::shared_ptr<IResource>;
 
-    // 添加資源到快取
-    void Add(const std::string& path, ResourcePtr resource);
+    // 添加資源到快取 (isEvictable = false pins the resource)
+    void Add(const std::string& path, ResourcePtr resource, bool isEvictable = true);
 
-    // 從快取取得資源
-    ResourcePtr Get(const std::string& path) const;
+    // 從快取取得資源 (counts a hit or miss and refreshes the LRU position)
+    ResourcePtr Get(const std::string& path);
 
     // 檢查資源是否在快取中
     bool Contains(const std::string& path) const;
 
+    // Like Get(), but leaves hit/miss statistics and the LRU position untouched
+    ResourcePtr Peek(const std::string& path) const;
+
     // 移除資源
     void Remove(const std::string& path);
 
+    // Exclude a cached resource from eviction. Returns false if the path is not cached.
+    bool Pin(const std::string& path);
+
     // 清空快取
     void Clear();
 
@@ -36,11 +93,57 @@ public:
 
     // 取得總記憶體使用量
     size_t GetMemoryUsage() const;
+    size_t GetMemoryUsage(eResourceType type) const;
 
-    // 移除未使用的資源
+    // 移除未使用的資源 (pinned resources are kept)
     void RemoveUnused();
 
+    // Memory budgets in bytes, 0 = unlimited. Lowering a budget evicts immediately.
+    void SetMemoryBudget(size_t bytes);
+    void SetTypeMemoryBudget(eResourceType type, size_t bytes);
+
+    sResourceCacheStats GetStats() const;
+    void                ResetStatCounters();
+
 private:
-    mutable std::mutex                           m_mutex;
-    std::unordered_map<std::string, ResourcePtr> m_resources;
+    using LruList = std::list<std::string const*>;     // Points at the map key; most recent first
+
+    struct sEntry
+    {
+        ResourcePtr       m_resource;
+        size_t            m_bytes       = 0;     // Charged at Add time
+        eResourceType     m_type        = eResourceType::Unknown;
+        bool              m_isEvictable = true;  // false = pinned, not linked into the LRU lists
+        LruList::iterator m_lruIt;
+        LruList::iterator m_typeLruIt;
+    };
+
+    using EntryMap = std::unordered_map<std::string, sEntry>;
+
+    static size_t GetTypeIndex(eResourceType type);
+
+    void EraseLocked(EntryMap::iterator it, std::vector<ResourcePtr>& outReleased);
+    bool EnforceBudgetsLocked(eResourceType addedType, std::vector<ResourcePtr>& outReleased);
+    bool EvictFromListLocked(LruList& list, size_t const& usage, size_t budget, size_t maxSkips, std::vector<ResourcePtr>& outReleased);
+
+    // Referenced entries skipped per Add before giving up. Bounds Add() when most of the cache is in
+    // use; the skipped entries rotate to the front, so the next Add examines different ones.
+    static size_t constexpr MAX_EVICTION_SKIPS_PER_ADD = 32;
+
+    mutable std::mutex                       m_mutex;
+    EntryMap                                 m_resources;
+    LruList                                  m_lru;
+    std::array<LruList, RESOURCE_TYPE_COUNT> m_typeLru;
+
+    size_t                                  m_memoryUsage       = 0;
+    size_t                                  m_memoryBudget      = 0;
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeMemoryUsage   = {};
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeMemoryBudget  = {};
+    std::array<size_t, RESOURCE_TYPE_COUNT> m_typeResourceCount = {};
+
+    uint64_t m_hits           = 0;
+    uint64_t m_misses         = 0;
+    uint64_t m_evictions      = 0;
+    uint64_t m_evictedBytes   = 0;
+    uint64_t m_overBudgetAdds = 0;
 };
@@ -0,0 +1,453 @@
+//----------------------------------------------------------------------------------------------------
+// TextureCooker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Resource/TextureCooker.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/BufferParser.hpp"
+#include "Engine/Core/BufferWriter.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "ThirdParty/stb/stb_image.h"
+//----------------------------------------------------------------------------------------------------
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <system_error>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t constexpr   COOKED_TEXTURE_DATA_ALIGNMENT = 16;
+    size_t constexpr   COOKED_TEXTURE_HEADER_SIZE    = 64;
+    size_t constexpr   COOKED_TEXTURE_MIP_ENTRY_SIZE = 16;
+    uint32_t constexpr COOKED_TEXTURE_HAS_MIP_CHAIN  = 1u << 0;
+    uint32_t constexpr COOKED_TEXTURE_MIPS_KAISER    = 1u << 1;
+    uint32_t constexpr COOKED_TEXTURE_MIPS_SRGB      = 1u << 2;
+    uint32_t constexpr COOKED_TEXTURE_MIP_FLAGS      = COOKED_TEXTURE_HAS_MIP_CHAIN | COOKED_TEXTURE_MIPS_KAISER | COOKED_TEXTURE_MIPS_SRGB;
+    uint32_t constexpr MAX_COOKED_TEXTURE_MIP_COUNT  = 32;
+
+    //------------------------------------------------------------------------------------------------
+    // Fixed-size header, written/read field by field
+    struct sCookedTextureHeader
+    {
+        uint32_t m_magic           = COOKED_TEXTURE_MAGIC;
+        uint32_t m_version         = COOKED_TEXTURE_VERSION;
+        uint32_t m_format          = static_cast<uint32_t>(eCookedTextureFormat::RGBA8_UNORM);
+        uint32_t m_flags           = 0;
+        uint64_t m_sourceSize      = 0;
+        int64_t  m_sourceWriteTime = 0;
+        uint64_t m_sourceHash      = 0;
+        uint32_t m_width           = 0;
+        uint32_t m_height          = 0;
+        uint32_t m_mipCount        = 0;
+        uint32_t m_reserved[3]     = {};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct sSourceFileInfo
+    {
+        bool     m_exists    = false;
+        uint64_t m_size      = 0;
+        int64_t  m_writeTime = 0;
+    };
+
+    sSourceFileInfo GetSourceFileInfo(String const& sourcePath)
+    {
+        sSourceFileInfo info;
+        std::error_code errorCode;
+
+        uintmax_t const size = std::filesystem::file_size(sourcePath, errorCode);
+        if (errorCode)
+        {
+            return info;
+        }
+
+        std::filesystem::file_time_type const writeTime = std::filesystem::last_write_time(sourcePath, errorCode);
+        if (errorCode)
+        {
+            return info;
+        }
+
+        info.m_exists    = true;
+        info.m_size      = static_cast<uint64_t>(size);
+        info.m_writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return info;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // FNV-1a, eight bytes per step folded in as two 32-bit halves
+    uint64_t HashSourceBytes(std::vector<uint8_t> const& bytes)
+    {
+        uint64_t constexpr FNV_PRIME = 1099511628211ull;
+        uint64_t           hash      = 14695981039346656037ull;
+
+        size_t const   size = bytes.size();
+        uint8_t const* data = bytes.data();
+        size_t         i    = 0;
+
+        for (; i + 8 <= size; i += 8)
+        {
+            uint32_t halves[2];
+            std::memcpy(halves, data + i, sizeof(halves));
+            hash = (hash ^ halves[0]) * FNV_PRIME;
+            hash = (hash ^ halves[1]) * FNV_PRIME;
+        }
+        for (; i < size; ++i)
+        {
+            hash = (hash ^ data[i]) * FNV_PRIME;
+        }
+
+        return hash ^ static_cast<uint64_t>(size);
+    }
+
+    // Mip flags a cooked file must carry to satisfy options (the filter changes the texels)
+    uint32_t GetWantedMipFlags(sTextureDecodeOptions const& options)
+    {
+        return COOKED_TEXTURE_HAS_MIP_CHAIN
+               | (options.m_mipFilter == eImageDownsampleFilter::KAISER ? COOKED_TEXTURE_MIPS_KAISER : 0u)
+               | (options.m_mipColorSpace == eImageColorSpace::SRGB ? COOKED_TEXTURE_MIPS_SRGB : 0u);
+    }
+
+    void AppendPadding(BufferWriter& writer, size_t const alignment)
+    {
+        while (writer.GetTotalSize() % alignment != 0)
+        {
+            writer.AppendByte(0);
+        }
+    }
+
+    bool IsRangeInside(uint64_t const first, uint64_t const count, uint64_t const total)
+    {
+        return first <= total && count <= total - first;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Header only; ParseCookedMipLevels() validates the rest once the caller decides to use the file
+    bool ParseCookedHeader(MemoryMappedFile const& cookedFile, sCookedTextureHeader& out_header)
+    {
+        if (cookedFile.GetSize() < COOKED_TEXTURE_HEADER_SIZE)
+        {
+            return false;
+        }
+
+        BufferParser parser(cookedFile.GetData(), cookedFile.GetSize());
+        parser.SetEndianMode(eEndianMode::LITTLE);
+
+        out_header.m_magic           = parser.ParseUint32();
+        out_header.m_version         = parser.ParseUint32();
+        out_header.m_format          = parser.ParseUint32();
+        out_header.m_flags           = parser.ParseUint32();
+        out_header.m_sourceSize      = parser.ParseUint64();
+        out_header.m_sourceWriteTime = static_cast<int64_t>(parser.ParseUint64());
+        out_header.m_sourceHash      = parser.ParseUint64();
+        out_header.m_width           = parser.ParseUint32();
+        out_header.m_height          = parser.ParseUint32();
+        out_header.m_mipCount        = parser.ParseUint32();
+
+        return out_header.m_magic == COOKED_TEXTURE_MAGIC && out_header.m_version == COOKED_TEXTURE_VERSION
+               && out_header.m_format == static_cast<uint32_t>(eCookedTextureFormat::RGBA8_UNORM)
+               && out_header.m_width > 0 && out_header.m_height > 0
+               && out_header.m_mipCount > 0 && out_header.m_mipCount <= MAX_COOKED_TEXTURE_MIP_COUNT;
+    }
+
+    bool ParseCookedMipLevels(MemoryMappedFile const& cookedFile, sCookedTextureHeader const& header, std::vector<sTextureMipLevel>& out_mipLevels)
+    {
+        uint8_t const* const data = cookedFile.GetData();
+        size_t const         size = cookedFile.GetSize();
+
+        if (!IsRangeInside(COOKED_TEXTURE_HEADER_SIZE, static_cast<uint64_t>(header.m_mipCount) * COOKED_TEXTURE_MIP_ENTRY_SIZE, size))
+        {
+            return false;
+        }
+
+        BufferParser parser(data, size);
+        parser.SetEndianMode(eEndianMode::LITTLE);
+        parser.SetCurrentPosition(COOKED_TEXTURE_HEADER_SIZE);
+
+        out_mipLevels.resize(header.m_mipCount);
+        IntVec2 expected(static_cast<int>(header.m_width), static_cast<int>(header.m_height));
+
+        for (sTextureMipLevel& mipLevel : out_mipLevels)
+        {
+            uint32_t const width    = parser.ParseUint32();
+            uint32_t const height   = parser.ParseUint32();
+            uint32_t const offset   = parser.ParseUint32();
+            uint32_t const byteSize = parser.ParseUint32();
+
+            if (static_cast<int>(width) != expected.x || static_cast<int>(height) != expected.y
+                || offset % COOKED_TEXTURE_DATA_ALIGNMENT != 0
+                || static_cast<uint64_t>(byteSize) != static_cast<uint64_t>(width) * height * sizeof(Rgba8)
+                || !IsRangeInside(offset, byteSize, size))
+            {
+                return false;
+            }
+
+            mipLevel.m_dimensions = expected;
+            mipLevel.m_texels     = reinterpret_cast<Rgba8 const*>(data + offset);
+
+            expected = IntVec2((std::max)(expected.x / 2, 1), (std::max)(expected.y / 2, 1));
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool DecodeSourceBytes(std::vector<uint8_t> const& sourceBytes, String const& sourcePath, sDecodedTexture& out_texture)
+    {
+        if (sourceBytes.empty() || sourceBytes.size() > static_cast<size_t>((std::numeric_limits<int>::max)()))
+        {
+            return false;
+        }
+
+        // Per-thread flag: decodes on several I/O workers must not race on stb's global
+        stbi_set_flip_vertically_on_load_thread(1);    // We prefer uvTexCoords has origin (0,0) at BOTTOM LEFT
+
+        IntVec2       dimensions         = IntVec2::ZERO;
+        int           componentsInFile   = 0;
+        int constexpr componentsRequired = 4;           // Always expand to RGBA8
+
+        unsigned char* const texelData = stbi_load_from_memory(sourceBytes.data(),
+                                                               static_cast<int>(sourceBytes.size()),
+                                                               &dimensions.x,
+                                                               &dimensions.y,
+                                                               &componentsInFile,
+                                                               componentsRequired);
+        if (!texelData)
+        {
+            DAEMON_LOG(LogResource, eLogVerbosity::Warning,
+                       Stringf("TextureCooker: Failed to decode '%s' (%s)", sourcePath.c_str(), stbi_failure_reason()));
+            return false;
+        }
+
+        size_t const texelCount = static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y);
+        out_texture.m_texels.resize(texelCount);
+        std::memcpy(out_texture.m_texels.data(), texelData, texelCount * sizeof(Rgba8));
+        stbi_image_free(texelData);
+
+        out_texture.m_mipLevels.assign(1, sTextureMipLevel{dimensions, out_texture.m_texels.data()});
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+String TextureCooker::GetCookedPath(String const& sourcePath)
+{
+    return sourcePath + ".ctex";
+}
+
+//----------------------------------------------------------------------------------------------------
+bool TextureCooker::DecodeTexture(String const& sourcePath, sTextureDecodeOptions const& options, sDecodedTexture& out_texture)
+{
+    out_texture              = sDecodedTexture();
+    out_texture.m_sourcePath = sourcePath;
+
+    bool const            canUseCooked = options.m_useCookedCache && GetPlatformLocalEndian() == eEndianMode::LITTLE;
+    String const          cookedPath   = GetCookedPath(sourcePath);
+    sSourceFileInfo const sourceInfo   = GetSourceFileInfo(sourcePath);
+
+    // 1. Cooked file whose write time and size match the source: map it, no read or decode
+    MemoryMappedFile     cookedFile;
+    sCookedTextureHeader header;
+    bool const           hasCookedHeader = canUseCooked && cookedFile.Open(cookedPath) && ParseCookedHeader(cookedFile, header);
+    bool const           hasWantedMips   = !options.m_generateMips || (header.m_flags & COOKED_TEXTURE_MIP_FLAGS) == GetWantedMipFlags(options);
+
+    auto const useCookedFile = [&]() -> bool
+    {
+        if (!ParseCookedMipLevels(cookedFile, header, out_texture.m_mipLevels))
+        {
+            DAEMON_LOG(LogResource, eLogVerbosity::Warning, Stringf("TextureCooker: '%s' is corrupt, recooking", cookedPath.c_str()));
+            out_texture.m_mipLevels.clear();
+            return false;
+        }
+        out_texture.m_isFromCookedCache = true;
+        out_texture.m_cookedFile        = std::move(cookedFile);    // The mapping moves, its address does not
+        return true;
+    };
+
+    if (hasCookedHeader && hasWantedMips)
+    {
+        bool const isStampCurrent = !sourceInfo.m_exists    // Cooked-only distribution
+                                    || (sourceInfo.m_size == header.m_sourceSize && sourceInfo.m_writeTime == header.m_sourceWriteTime);
+        if (isStampCurrent && useCookedFile())
+        {
+            return true;
+        }
+    }
+
+    // 2. Read the source once; a matching content hash still avoids the decode (touched or copied files)
+    std::vector<uint8_t> sourceBytes;
+    if (!sourceInfo.m_exists || !FileReadToBuffer(sourceBytes, sourcePath))
+    {
+        DAEMON_LOG(LogResource, eLogVerbosity::Warning, Stringf("TextureCooker: Failed to read '%s'", sourcePath.c_str()));
+        return false;
+    }
+
+    uint64_t const sourceHash = HashSourceBytes(sourceBytes);
+    if (hasCookedHeader && hasWantedMips && cookedFile.IsOpen()
+        && header.m_sourceSize == sourceBytes.size() && header.m_sourceHash == sourceHash && useCookedFile())
+    {
+        return true;
+    }
+    cookedFile.Close();    // Release the mapping before Cook() replaces the file
+
+    // 3. Decode once, build mips, cook for the next load
+    if (!DecodeSourceBytes(sourceBytes, sourcePath, out_texture))
+    {
+        return false;
+    }
+
+    if (options.m_generateMips)
+    {
+        GenerateMipChain(out_texture, options);
+    }
+
+    if (canUseCooked && !Cook(out_texture, options, sourceBytes.size(), sourceInfo.m_writeTime, sourceHash, cookedPath))
+    {
+        DAEMON_LOG(LogResource, eLogVerbosity::Warning, Stringf("TextureCooker: Failed to write '%s'", cookedPath.c_str()));
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextureCooker::GenerateMipChain(sDecodedTexture& texture, sTextureDecodeOptions const& options)
+{
+    if (texture.m_mipLevels.size() != 1 || texture.m_isFromCookedCache)
+    {
+        return;
+    }
+
+    // Size the whole chain up front so the level pointers stay valid
+    IntVec2 const baseDimensions = texture.m_mipLevels[0].m_dimensions;
+    int const     mipCount       = ImageProcessing::GetMipCount(baseDimensions);
+
+    std::vector<IntVec2> mipDimensions(mipCount, baseDimensions);
+    std::vector<size_t>  mipOffsets(mipCount, 0);
+    size_t               totalTexels = 0;
+
+    for (int mip = 0; mip < mipCount; ++mip)
+    {
+        if (mip > 0)
+        {
+            mipDimensions[mip] = ImageProcessing::GetDownsampledDimensions(mipDimensions[mip - 1]);
+        }
+        mipOffsets[mip] = totalTexels;
+        totalTexels += static_cast<size_t>(mipDimensions[mip].x) * static_cast<size_t>(mipDimensions[mip].y);
+    }
+
+    texture.m_texels.resize(totalTexels);
+    texture.m_mipLevels.resize(mipCount);
+
+    sImageFilterOptions filterOptions;
+    filterOptions.m_colorSpace = options.m_mipColorSpace;
+
+    for (int mip = 0; mip < mipCount; ++mip)
+    {
+        Rgba8* const texels      = texture.m_texels.data() + mipOffsets[mip];
+        texture.m_mipLevels[mip] = sTextureMipLevel{mipDimensions[mip], texels};
+
+        if (mip > 0)
+        {
+            ImageProcessing::Downsample(texture.m_texels.data() + mipOffsets[mip - 1], mipDimensions[mip - 1], texels, options.m_mipFilter, filterOptions);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool TextureCooker::Cook(sDecodedTexture const&       texture,
+                         sTextureDecodeOptions const& options,
+                         uint64_t const               sourceSize,
+                         int64_t const                sourceWriteTime,
+                         uint64_t const               sourceHash,
+                         String const&                cookedPath)
+{
+    // Texels are stored in host byte order and read back as little-endian
+    if (GetPlatformLocalEndian() != eEndianMode::LITTLE || !texture.IsValid() || texture.m_mipLevels.size() > MAX_COOKED_TEXTURE_MIP_COUNT)
+    {
+        return false;
+    }
+
+    size_t texelBytes = 0;
+    for (sTextureMipLevel const& mipLevel : texture.m_mipLevels)
+    {
+        texelBytes += static_cast<size_t>(mipLevel.m_dimensions.x) * mipLevel.m_dimensions.y * sizeof(Rgba8) + COOKED_TEXTURE_DATA_ALIGNMENT;
+    }
+
+    size_t const tableSize = texture.m_mipLevels.size() * COOKED_TEXTURE_MIP_ENTRY_SIZE;
+    if (COOKED_TEXTURE_HEADER_SIZE + tableSize + texelBytes > (std::numeric_limits<uint32_t>::max)())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(COOKED_TEXTURE_HEADER_SIZE + tableSize + texelBytes);
+
+    BufferWriter writer(buffer);
+    writer.SetEndianMode(eEndianMode::LITTLE);
+
+    IntVec2 const        dimensions = texture.GetDimensions();
+    sCookedTextureHeader header;
+    header.m_format          = static_cast<uint32_t>(texture.m_format);
+    header.m_flags           = options.m_generateMips ? GetWantedMipFlags(options) : 0u;
+    header.m_sourceSize      = sourceSize;
+    header.m_sourceWriteTime = sourceWriteTime;
+    header.m_sourceHash      = sourceHash;
+    header.m_width           = static_cast<uint32_t>(dimensions.x);
+    header.m_height          = static_cast<uint32_t>(dimensions.y);
+    header.m_mipCount        = static_cast<uint32_t>(texture.m_mipLevels.size());
+
+    writer.AppendUint32(header.m_magic);
+    writer.AppendUint32(header.m_version);
+    writer.AppendUint32(header.m_format);
+    writer.AppendUint32(header.m_flags);
+    writer.AppendUint64(header.m_sourceSize);
+    writer.AppendInt64(header.m_sourceWriteTime);
+    writer.AppendUint64(header.m_sourceHash);
+    writer.AppendUint32(header.m_width);
+    writer.AppendUint32(header.m_height);
+    writer.AppendUint32(header.m_mipCount);
+    for (uint32_t const reserved : header.m_reserved)
+    {
+        writer.AppendUint32(reserved);
+    }
+
+    // Mip table with offsets computed up front (the texel data follows it)
+    size_t offset = COOKED_TEXTURE_HEADER_SIZE + tableSize;
+    for (sTextureMipLevel const& mipLevel : texture.m_mipLevels)
+    {
+        offset                = (offset + COOKED_TEXTURE_DATA_ALIGNMENT - 1) & ~(COOKED_TEXTURE_DATA_ALIGNMENT - 1);
+        size_t const byteSize = static_cast<size_t>(mipLevel.m_dimensions.x) * mipLevel.m_dimensions.y * sizeof(Rgba8);
+
+        writer.AppendUint32(static_cast<uint32_t>(mipLevel.m_dimensions.x));
+        writer.AppendUint32(static_cast<uint32_t>(mipLevel.m_dimensions.y));
+        writer.AppendUint32(static_cast<uint32_t>(offset));
+        writer.AppendUint32(static_cast<uint32_t>(byteSize));
+        offset += byteSize;
+    }
+
+    for (sTextureMipLevel const& mipLevel : texture.m_mipLevels)
+    {
+        AppendPadding(writer, COOKED_TEXTURE_DATA_ALIGNMENT);
+        writer.AppendBytes(mipLevel.m_texels, static_cast<size_t>(mipLevel.m_dimensions.x) * mipLevel.m_dimensions.y * sizeof(Rgba8));
+    }
+
+    // Write-then-rename so a concurrent DecodeTexture() never maps a partial file
+    String const tempPath = cookedPath + ".tmp";
+    if (!FileWriteFromBuffer(buffer, tempPath))
+    {
+        return false;
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(tempPath, cookedPath, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(tempPath, errorCode);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------------------------------
+// TextureCooker.hpp
+//
+// Purpose:
+//   CPU half of texture loading: decode the source image once, flip rows to the engine's
+//   bottom-left UV origin, optionally build the mip chain, and keep the result in a cooked
+//   <source>.ctex cache that later loads map instead of decoding.
+//
+// Design Rationale:
+//   - DecodeTexture() touches no D3D11 state, so it can run on an I/O worker; the caller uploads
+//     the result with TextureLoader::CreateTextureFromDecoded() (the only GPU step)
+//   - The source file is read once and decoded from memory (stbi_load_from_memory), with a
+//     per-thread flip flag instead of stb's process-wide one
+//   - The cache is keyed by the source's write time and size; when the time differs (checkout,
+//     copy, touch) the source bytes are hashed and compared with the cooked hash, so an unchanged
+//     image is still served from the cache without decoding
+//   - Cooked texels are stored per mip, 16-byte aligned, behind a format tag (RGBA8 today), so a
+//     block-compressed encoder can be added without changing the loader. A cooked hit maps the
+//     file and the upload reads the texels in place.
+//
+// Layout (little-endian):
+//   header { magic, version, format, flags, sourceSize, sourceWriteTime, sourceHash, width, height, mipCount }
+//   mipCount x { width, height, offset, byteSize }
+//   per mip: pad to 16, texels (rows bottom to top)
+//
+// Thread Safety:
+//   - Stateless; safe from any thread for different paths
+//
+// Author: Texture Decode Pipeline
+// Date: 2026-10-16
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/MemoryMappedFile.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Renderer/ImageProcessing.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+uint32_t constexpr COOKED_TEXTURE_MAGIC   = 0x58455443;    // "CTEX"
+uint32_t constexpr COOKED_TEXTURE_VERSION = 1;
+
+//----------------------------------------------------------------------------------------------------
+enum class eCookedTextureFormat : uint32_t
+{
+    RGBA8_UNORM = 0
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureDecodeOptions
+{
+    bool                   m_generateMips   = false;
+    bool                   m_useCookedCache = true;                            // Read and write <source>.ctex
+    eImageDownsampleFilter m_mipFilter      = eImageDownsampleFilter::BOX;
+    eImageColorSpace       m_mipColorSpace  = eImageColorSpace::SRGB;          // LINEAR for normal maps / data textures
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureMipLevel
+{
+    IntVec2      m_dimensions = IntVec2::ZERO;
+    Rgba8 const* m_texels     = nullptr;    // Rows bottom to top, tightly packed
+};
+
+//----------------------------------------------------------------------------------------------------
+// Result of DecodeTexture(). Mip texels point into m_texels (fresh decode) or m_cookedFile (cache
+// hit); both keep their address when the struct is moved.
+//----------------------------------------------------------------------------------------------------
+struct sDecodedTexture
+{
+    String                        m_sourcePath;
+    eCookedTextureFormat          m_format            = eCookedTextureFormat::RGBA8_UNORM;
+    std::vector<sTextureMipLevel> m_mipLevels;
+    bool                          m_isFromCookedCache = false;
+
+    std::vector<Rgba8> m_texels;
+    MemoryMappedFile   m_cookedFile;
+
+    IntVec2 GetDimensions() const { return m_mipLevels.empty() ? IntVec2::ZERO : m_mipLevels[0].m_dimensions; }
+    bool    IsValid() const { return !m_mipLevels.empty(); }
+};
+
+//----------------------------------------------------------------------------------------------------
+class TextureCooker
+{
+public:
+    // Data/Images/Test.png -> Data/Images/Test.png.ctex
+    static String GetCookedPath(String const& sourcePath);
+
+    // CPU stage: cooked cache hit, or read + decode once + flip + mips (+ cook). Any thread.
+    static bool DecodeTexture(String const& sourcePath, sTextureDecodeOptions const& options, sDecodedTexture& out_texture);
+
+    // Mip chain below level 0 (appended to m_texels / m_mipLevels of a fresh decode), built with
+    // ImageProcessing::Downsample on the JobSystem
+    static void GenerateMipChain(sDecodedTexture& texture, sTextureDecodeOptions const& options);
+
+    // options only record how the mip chain was built (checked by later DecodeTexture calls)
+    static bool Cook(sDecodedTexture const& texture, sTextureDecodeOptions const& options, uint64_t sourceSize, int64_t sourceWriteTime, uint64_t sourceHash, String const& cookedPath);
+};
@@ -11,12 +11,12 @@
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Resource/ResourceCommon.hpp"
 #include "Engine/Resource/TextureResource.hpp"
-#include "ThirdParty/stb/stb_image.h"
 #include <d3d11.h>
 
 //----------------------------------------------------------------------------------------------------
-TextureLoader::TextureLoader(ID3D11Device* device)
+TextureLoader::TextureLoader(ID3D11Device* device, sTextureDecodeOptions const& decodeOptions)
     : m_device(device)
+    , m_decodeOptions(decodeOptions)
 {
     GUARANTEE_OR_DIE(m_device != nullptr, "TextureLoader requires a valid D3D11 device");
 }
@@ -65,63 +65,71 @@ StringList TextureLoader::GetSupportedExtensions() const
 //----------------------------------------------------------------------------------------------------
 Texture* TextureLoader::CreateTextureFromFile(char const* imageFilePath)
 {
-    IntVec2 dimensions    = IntVec2::ZERO; // This will be filled in for us to indicate image width & height
-    int     bytesPerTexel = 0;
-    // This will be filled in for us to indicate how many color components the image had (e.g. 3=RGB=24bit, 4=RGBA=32bit)
-    int constexpr numComponentsRequested = 0; // don't care; we support 3 (24-bit RGB) or 4 (32-bit RGBA)
+    // One read + one decode (or a mapped cooked file); rows are already flipped to a BOTTOM LEFT origin
+    sDecodedTexture decodedTexture;
+    bool const      isDecoded = TextureCooker::DecodeTexture(imageFilePath, m_decodeOptions, decodedTexture);
 
-    // Load (and decompress) the image RGB(A) bytes from a file on disk into a memory buffer (array of bytes)
-    stbi_set_flip_vertically_on_load(1); // We prefer uvTexCoords has origin (0,0) at BOTTOM LEFT
-    unsigned char* texelData = stbi_load(imageFilePath,
-                                         &dimensions.x,
-                                         &dimensions.y,
-                                         &bytesPerTexel,
-                                         numComponentsRequested);
+    GUARANTEE_OR_DIE(isDecoded, Stringf("Failed to load image \"%s\"", imageFilePath))
 
-    GUARANTEE_OR_DIE(texelData, Stringf("Failed to load image \"%s\"", imageFilePath))
+    return CreateTextureFromDecoded(decodedTexture);
+}
 
-    Image const fileImage(imageFilePath);
-    Texture*    newTexture = CreateTextureFromImage(fileImage);
+//----------------------------------------------------------------------------------------------------
+Texture* TextureLoader::CreateTextureFromImage(Image const& image)
+{
+    std::vector<sTextureMipLevel> const mipLevels = {
+        sTextureMipLevel{image.GetDimensions(), static_cast<Rgba8 const*>(image.GetRawData())}
+    };
 
-    // Free the raw image texel data now that we've sent a copy of it down to the GPU to be stored in video memory
-    stbi_image_free(texelData);
+    return CreateTextureFromMipLevels(image.GetImageFilePath(), mipLevels);
+}
 
-    return newTexture;
+//----------------------------------------------------------------------------------------------------
+Texture* TextureLoader::CreateTextureFromDecoded(sDecodedTexture const& decodedTexture)
+{
+    return CreateTextureFromMipLevels(decodedTexture.m_sourcePath, decodedTexture.m_mipLevels);
 }
 
 //----------------------------------------------------------------------------------------------------
-Texture* TextureLoader::CreateTextureFromImage(Image const& image)
+Texture* TextureLoader::CreateTextureFromMipLevels(String const& name, std::vector<sTextureMipLevel> const& mipLevels)
 {
+    GUARANTEE_OR_DIE(!mipLevels.empty(), Stringf("CreateTextureFromMipLevels: no texels for \"%s\".", name.c_str()))
+
     Texture* newTexture      = new Texture();
-    newTexture->m_name       = image.GetImageFilePath();
-    newTexture->m_dimensions = image.GetDimensions();
+    newTexture->m_name       = name;
+    newTexture->m_dimensions = mipLevels[0].m_dimensions;
 
     D3D11_TEXTURE2D_DESC textureDesc = {};
-    textureDesc.Width                = image.GetDimensions().x;
-    textureDesc.Height               = image.GetDimensions().y;
-    textureDesc.MipLevels            = 1;
+    textureDesc.Width                = mipLevels[0].m_dimensions.x;
+    textureDesc.Height               = mipLevels[0].m_dimensions.y;
+    textureDesc.MipLevels            = static_cast<UINT>(mipLevels.size());
     textureDesc.ArraySize            = 1;
     textureDesc.Format               = DXGI_FORMAT_R8G8B8A8_UNORM;
     textureDesc.SampleDesc.Count     = 1;
     textureDesc.Usage                = D3D11_USAGE_IMMUTABLE;
     textureDesc.BindFlags            = D3D11_BIND_SHADER_RESOURCE;
 
-    D3D11_SUBRESOURCE_DATA textureData;
-    textureData.pSysMem     = image.GetRawData();
-    textureData.SysMemPitch = 4 * image.GetDimensions().x;
+    // Texels are read in place (decode buffer or mapped cooked file); D3D11 copies them during creation
+    std::vector<D3D11_SUBRESOURCE_DATA> textureData(mipLevels.size());
+    for (size_t mip = 0; mip < mipLevels.size(); ++mip)
+    {
+        textureData[mip].pSysMem          = mipLevels[mip].m_texels;
+        textureData[mip].SysMemPitch      = static_cast<UINT>(sizeof(Rgba8) * mipLevels[mip].m_dimensions.x);
+        textureData[mip].SysMemSlicePitch = 0;
+    }
 
-    HRESULT hr = m_device->CreateTexture2D(&textureDesc, &textureData, &newTexture->m_texture);
+    HRESULT hr = m_device->CreateTexture2D(&textureDesc, textureData.data(), &newTexture->m_texture);
 
     if (!SUCCEEDED(hr))
     {
-        ERROR_AND_DIE(Stringf("CreateTextureFromImage failed for image file \"%s\".", image.GetImageFilePath().c_str()))
+        ERROR_AND_DIE(Stringf("CreateTextureFromImage failed for image file \"%s\".", name.c_str()))
     }
 
     hr = m_device->CreateShaderResourceView(newTexture->m_texture, NULL, &newTexture->m_shaderResourceView);
 
     if (!SUCCEEDED(hr))
     {
-        ERROR_AND_DIE(Stringf("CreateShaderResourceView failed for image file \"%s\".", image.GetImageFilePath().c_str()))
+        ERROR_AND_DIE(Stringf("CreateShaderResourceView failed for image file \"%s\".", name.c_str()))
     }
 
     // No caching here - ResourceCache handles that!
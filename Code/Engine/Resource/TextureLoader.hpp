@@ -8,6 +8,7 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Resource/IResourceLoader.hpp"
+#include "Engine/Resource/TextureCooker.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Image;
@@ -17,7 +18,7 @@ class TextureResource;
 class TextureLoader : public IResourceLoader
 {
 public:
-    explicit TextureLoader(ID3D11Device* device);
+    explicit TextureLoader(ID3D11Device* device, sTextureDecodeOptions const& decodeOptions = {});
     ~TextureLoader() override;
 
     // IResourceLoader interface implementation
@@ -29,11 +30,16 @@ public:
     // Create a GPU texture from an in-memory Image (no caching — ResourceCache handles that)
     Texture* CreateTextureFromImage(Image const& image);
 
+    // GPU upload of a TextureCooker::DecodeTexture() result (every mip level); the only D3D11 step
+    Texture* CreateTextureFromDecoded(sDecodedTexture const& decodedTexture);
+
 private:
-    ID3D11Device* m_device = nullptr;
+    ID3D11Device*         m_device = nullptr;
+    sTextureDecodeOptions m_decodeOptions;
 
-    // Internal texture creation
+    // Internal texture creation: decode once (or map the cooked file), then upload
     Texture* CreateTextureFromFile(char const* imageFilePath);
+    Texture* CreateTextureFromMipLevels(String const& name, std::vector<sTextureMipLevel> const& mipLevels);
 
     // Helper methods
     bool LoadTextureFromFile(String const& path, TextureResource* textureResource);
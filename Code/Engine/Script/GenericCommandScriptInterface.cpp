@@ -137,11 +137,11 @@ bool GenericCommandScriptInterface::SetProperty(String const& propertyName,
 //
 // JS: commandQueue.submit(type, payloadJson, agentId, callback?)
 //
-// Inbound V8→std::any conversion:
-//   - type: string → String
-//   - payloadJson: string → std::any (wrapping JSON string for handler to parse)
-//   - agentId: string → String
-//   - callback: function → std::any (opaque, stored for later delivery)
+// Inbound V8→C++ conversion:
+//   - type: string → InternedStringID (looked up, never interned: registration interned it)
+//   - payloadJson: string → GenericCommandPayload (JSON string stored inline for handler to parse)
+//   - agentId: string → InternedStringID (interned on the agent's first submit only)
+//   - callback: function → std::any (opaque, stored in the executor for later delivery)
 //
 // Returns: callbackId as double (0 if no callback)
 //----------------------------------------------------------------------------------------------------
@@ -164,28 +164,25 @@ ScriptMethodResult GenericCommandScriptInterface::ExecuteSubmit(ScriptArgs const
 
 		// Handle optional callback
 		uint64_t callbackId = 0;
-		std::any callback;
 
 		if (args.size() == 4)
 		{
 			callbackId = GenerateCallbackID();
-			callback   = args[3];  // Store as-is (opaque std::any wrapping V8 function)
 
-			// Store callback in executor for later retrieval
-			m_executor->StoreCallback(callbackId, callback);
+			// Store callback in executor for later retrieval (opaque std::any wrapping V8 function)
+			m_executor->StoreCallback(callbackId, args[3]);
 		}
 
-		// Create GenericCommand with JSON payload as std::any
+		// Create GenericCommand with JSON payload stored inline
 		GenericCommand command(
-			std::move(type),
-			std::any(std::move(payload)),  // Wrap JSON string in std::any
-			std::move(agentId),
-			callbackId,
-			std::move(callback)
+			ResolveCommandTypeId(type),
+			GenericCommandPayload(std::move(payload)),
+			ResolveAgentId(agentId),
+			callbackId
 		);
 
 		// Submit to queue
-		bool submitted = m_commandQueue->Submit(command);
+		bool submitted = m_commandQueue->Submit(std::move(command));
 
 		if (!submitted)
 		{
@@ -214,7 +211,7 @@ ScriptMethodResult GenericCommandScriptInterface::ExecuteSubmit(ScriptArgs const
 // JS: commandQueue.registerHandler(type, handlerFunc)
 //
 // The handlerFunc is a JavaScript function that will be wrapped as a C++ HandlerFunc.
-// The wrapper converts std::any payload (JSON string) back to the handler.
+// The wrapper passes the GenericCommandPayload (JSON string) back to the handler.
 //
 // Note: In the current architecture, handlers are registered from C++ side (App/APIs).
 // This JS method is provided for future extensibility where JS can register handlers
@@ -234,14 +231,14 @@ ScriptMethodResult GenericCommandScriptInterface::ExecuteRegisterHandler(ScriptA
 		String type = std::any_cast<std::string>(args[0]);
 
 		// Store the JS function as std::any — it will be invoked by the executor
-		// The handler receives std::any payload (JSON string) and returns HandlerResult
+		// The handler receives the GenericCommandPayload (JSON string) and returns HandlerResult
 		std::any jsHandler = args[1];
 
 		// Create a C++ HandlerFunc wrapper
 		// Note: The JS function is stored as std::any; actual V8 invocation
 		// would require V8Subsystem access, which is a future enhancement.
 		// For now, handlers are registered from C++ side (EntityAPI, CameraAPI, etc.)
-		HandlerFunc handler = [jsHandler](std::any const& payload) -> HandlerResult
+		HandlerFunc handler = [jsHandler](GenericCommandPayload const& payload) -> HandlerResult
 		{
 			UNUSED(payload)
 			// Placeholder: JS-registered handlers are a future enhancement
@@ -319,3 +316,35 @@ uint64_t GenericCommandScriptInterface::GenerateCallbackID()
 {
 	return m_nextCallbackId++;
 }
+
+//----------------------------------------------------------------------------------------------------
+InternedStringID GenericCommandScriptInterface::ResolveCommandTypeId(String const& commandType)
+{
+	if (m_lastCommandTypeId != INTERNED_STRING_ID_EMPTY && commandType == m_lastCommandType)
+	{
+		return m_lastCommandTypeId;
+	}
+
+	// Only registered types are cached: a type registered later must still be found
+	InternedStringID const typeId = FindInternedString(commandType);
+	if (typeId != INTERNED_STRING_ID_EMPTY)
+	{
+		m_lastCommandType   = commandType;
+		m_lastCommandTypeId = typeId;
+	}
+	return typeId;
+}
+
+//----------------------------------------------------------------------------------------------------
+InternedStringID GenericCommandScriptInterface::ResolveAgentId(String const& agentName)
+{
+	if (agentName == m_lastAgentName)
+	{
+		return m_lastAgentId;
+	}
+
+	// Takes the exclusive intern lock only for a name never seen before
+	m_lastAgentName = agentName;
+	m_lastAgentId   = InternString(agentName);
+	return m_lastAgentId;
+}
@@ -4,8 +4,8 @@
 //
 // Purpose:
 //   Single universal V8 bridge for all GenericCommand operations.
-//   This is the anti-corruption layer where V8 types are converted to std::any:
-//     - Inbound (JS→C++): submit() extracts V8 args and converts to std::any payload
+//   This is the anti-corruption layer where V8 types are converted to engine types:
+//     - Inbound (JS→C++): submit() extracts V8 args and converts to a GenericCommandPayload
 //   Outbound callback delivery (C++→JS) is handled by the existing
 //   CallbackQueueScriptInterface.dequeueAll(), which already supports GENERIC type.
 //
@@ -21,7 +21,8 @@
 //
 // Thread Safety:
 //   - All methods called from JavaScript worker thread
-//   - submit() enqueues to GenericCommandQueue (SPSC, lock-free)
+//   - submit() enqueues to GenericCommandQueue (MPMC, lock-free); it resolves the type and agent
+//     names through a one-entry cache each, so repeated submits never touch the intern table
 //   - registerHandler() uses executor's mutex (infrequent, startup only)
 //
 // Author: GenericCommand System - Phase 3
@@ -31,6 +32,7 @@
 #pragma once
 
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Core/InternedString.hpp"
 #include "Engine/Script/IScriptableObject.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -100,6 +102,13 @@ private:
 	// Generate unique callback ID (atomic counter)
 	uint64_t GenerateCallbackID();
 
+	// Types are interned by GenericCommandExecutor::RegisterHandler, so this lookup never inserts
+	// (an unregistered type resolves to INTERNED_STRING_ID_EMPTY and is answered with ERR_NO_HANDLER)
+	InternedStringID ResolveCommandTypeId(String const& commandType);
+
+	// Agents are not registered: a new agent name is interned on its first submit only
+	InternedStringID ResolveAgentId(String const& agentName);
+
 	//------------------------------------------------------------------------------------------------
 	// Dependencies (all owned by App, not by this interface)
 	//------------------------------------------------------------------------------------------------
@@ -108,4 +117,10 @@ private:
 
 	// Atomic callback ID counter
 	uint64_t m_nextCallbackId = 1;
+
+	// Last names submit() resolved (JS worker thread only); scripts mostly repeat the same ones
+	String           m_lastCommandType;
+	InternedStringID m_lastCommandTypeId = INTERNED_STRING_ID_EMPTY;
+	String           m_lastAgentName;
+	InternedStringID m_lastAgentId       = INTERNED_STRING_ID_EMPTY;
 };